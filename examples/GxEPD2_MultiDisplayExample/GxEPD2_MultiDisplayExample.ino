@@ -35,6 +35,8 @@
 // (or use separate RST pins for each display),
 // each instance with different BUSY line, or BUSY lines or-ed to one pin
 // disable reset line to disable cross resets by multiple instances
+// with a BUSY line each and full buffer size, GxEPD2_MultiDisplay (GxEPD2_MultiDisplay.h) sends the data of one display
+// while the others refresh, instead of one display() after the other
 
 #if defined (ESP8266)
 #define RST_PIN 0 // D3(0)
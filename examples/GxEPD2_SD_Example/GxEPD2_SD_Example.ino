@@ -55,6 +55,8 @@
 #include <GxEPD2_BW.h>
 #include <GxEPD2_3C.h>
 #include <GxEPD2_7C.h>
+#include <GxEPD2_BmpReader.h>
+#include <GxEPD2_NativeReader.h>
 #include <Fonts/FreeMonoBold9pt7b.h>
 
 #if defined(ESP32)
@@ -134,6 +136,10 @@ void drawBitmapFromSD(const char *filename, int16_t x, int16_t y, bool with_colo
 // overwrite = true does not clear buffer before drawing, use only if buffer is full height
 void drawBitmapFromSD_Buffered(const char *filename, int16_t x, int16_t y, bool with_color = true, bool partial_update = false, bool overwrite = false);
 
+// images precompiled for the panel with extras/host/tools/GxEPD2_NativeConvert, copied to the panel without conversion
+// e.g. drawNativeFromSD("parrot.gxn", 0, 0) after: GxEPD2_NativeConvert -f 7c parrot.bmp parrot.gxn
+void drawNativeFromSD(const char *filename, int16_t x, int16_t y);
+
 void setup()
 {
   delay(5000);
@@ -433,7 +439,6 @@ uint8_t output_row_mono_buffer[max_row_width / 8]; // buffer for at least one ro
 uint8_t output_row_color_buffer[max_row_width / 8]; // buffer for at least one row of color bits
 uint8_t mono_palette_buffer[max_palette_pixels / 8]; // palette buffer for depth <= 8 b/w
 uint8_t color_palette_buffer[max_palette_pixels / 8]; // palette buffer for depth <= 8 c/w
-uint16_t rgb_palette_buffer[max_palette_pixels]; // palette buffer for depth <= 8 for buffered graphics, needed for 7-color display
 
 void drawBitmapFromSD(const char *filename, int16_t x, int16_t y, bool with_color)
 {
@@ -636,12 +641,10 @@ void drawBitmapFromSD(const char *filename, int16_t x, int16_t y, bool with_colo
   }
 }
 
+// decodes only the rows that fall into the current page, see GxEPD2_BmpReader.h
 void drawBitmapFromSD_Buffered(const char *filename, int16_t x, int16_t y, bool with_color, bool partial_update, bool overwrite)
 {
   File file;
-  bool valid = false; // valid format to be handled
-  bool flip = true; // bitmap is stored bottom-to-top
-  bool has_multicolors = (display.epd2.panel == GxEPD2::ACeP565) || (display.epd2.panel == GxEPD2::GDEY073D46);
   uint32_t startTime = millis();
   if ((x >= display.width()) || (y >= display.height())) return;
   Serial.println();
@@ -663,186 +666,75 @@ void drawBitmapFromSD_Buffered(const char *filename, int16_t x, int16_t y, bool
     return;
   }
 #endif
-  // Parse BMP header
-  if (read16(file) == 0x4D42) // BMP signature
+  GxEPD2_FileSource<File> source(file);
+  GxEPD2_BmpReader bmp(source);
+  if (bmp.begin(with_color))
   {
-    uint32_t fileSize = read32(file);
-    uint32_t creatorBytes = read32(file); (void)creatorBytes; //unused
-    uint32_t imageOffset = read32(file); // Start of image data
-    uint32_t headerSize = read32(file);
-    uint32_t width  = read32(file);
-    int32_t height = (int32_t) read32(file);
-    uint16_t planes = read16(file);
-    uint16_t depth = read16(file); // bits per pixel
-    uint32_t format = read32(file);
-    if ((planes == 1) && ((format == 0) || (format == 3))) // uncompressed is handled, 565 also
+    Serial.print("Bit Depth: "); Serial.println(bmp.depth());
+    Serial.print("Image size: ");
+    Serial.print(bmp.width());
+    Serial.print('x');
+    Serial.println(bmp.height());
+    uint16_t w = bmp.width();
+    uint16_t h = bmp.height();
+    if ((x + w - 1) >= display.width())  w = display.width()  - x;
+    if ((y + h - 1) >= display.height()) h = display.height() - y;
+    if (partial_update) display.setPartialWindow(x, y, w, h);
+    else display.setFullWindow();
+    display.firstPage();
+    do
     {
-      Serial.print("File size: "); Serial.println(fileSize);
-      Serial.print("Image Offset: "); Serial.println(imageOffset);
-      Serial.print("Header size: "); Serial.println(headerSize);
-      Serial.print("Bit Depth: "); Serial.println(depth);
-      Serial.print("Image size: ");
-      Serial.print(width);
-      Serial.print('x');
-      Serial.println(height);
-      // BMP rows are padded (if needed) to 4-byte boundary
-      uint32_t rowSize = (width * depth / 8 + 3) & ~3;
-      if (depth < 8) rowSize = ((width * depth + 8 - depth) / 8 + 3) & ~3;
-      if (height < 0)
-      {
-        height = -height;
-        flip = false;
-      }
-      uint16_t w = width;
-      uint16_t h = height;
-      if ((x + w - 1) >= display.width())  w = display.width()  - x;
-      if ((y + h - 1) >= display.height()) h = display.height() - y;
-      //if (w <= max_row_width) // handle with direct drawing
-      {
-        valid = true;
-        uint8_t bitmask = 0xFF;
-        uint8_t bitshift = 8 - depth;
-        uint16_t red, green, blue;
-        bool whitish = false;
-        bool colored = false;
-        if (depth == 1) with_color = false;
-        if (depth <= 8)
-        {
-          if (depth < 8) bitmask >>= depth;
-          //file.seek(54); //palette is always @ 54
-          file.seek(imageOffset - (4 << depth)); //54 for regular, diff for colorsimportant
-          for (uint16_t pn = 0; pn < (1 << depth); pn++)
-          {
-            blue  = file.read();
-            green = file.read();
-            red   = file.read();
-            file.read();
-            whitish = with_color ? ((red > 0x80) && (green > 0x80) && (blue > 0x80)) : ((red + green + blue) > 3 * 0x80); // whitish
-            colored = (red > 0xF0) || ((green > 0xF0) && (blue > 0xF0)); // reddish or yellowish?
-            if (0 == pn % 8) mono_palette_buffer[pn / 8] = 0;
-            mono_palette_buffer[pn / 8] |= whitish << pn % 8;
-            if (0 == pn % 8) color_palette_buffer[pn / 8] = 0;
-            color_palette_buffer[pn / 8] |= colored << pn % 8;
-            rgb_palette_buffer[pn] = ((red & 0xF8) << 8) | ((green & 0xFC) << 3) | ((blue & 0xF8) >> 3);
-          }
-        }
-        if (partial_update) display.setPartialWindow(x, y, w, h);
-        else display.setFullWindow();
-        display.firstPage();
-        do
-        {
-          //if (!overwrite) display.fillScreen(GxEPD_WHITE);
-          uint32_t rowPosition = flip ? imageOffset + (height - h) * rowSize : imageOffset;
-          for (uint16_t row = 0; row < h; row++, rowPosition += rowSize) // for each line
-          {
-            uint32_t in_remain = rowSize;
-            uint32_t in_idx = 0;
-            uint32_t in_bytes = 0;
-            uint8_t in_byte = 0; // for depth <= 8
-            uint8_t in_bits = 0; // for depth <= 8
-            uint16_t color = GxEPD_WHITE;
-            file.seek(rowPosition);
-            for (uint16_t col = 0; col < w; col++) // for each pixel
-            {
-              // Time to read more pixel data?
-              if (in_idx >= in_bytes) // ok, exact match for 24bit also (size IS multiple of 3)
-              {
-                in_bytes = file.read(input_buffer, in_remain > sizeof(input_buffer) ? sizeof(input_buffer) : in_remain);
-                in_remain -= in_bytes;
-                in_idx = 0;
-              }
-              switch (depth)
-              {
-                case 32:
-                  blue = input_buffer[in_idx++];
-                  green = input_buffer[in_idx++];
-                  red = input_buffer[in_idx++];
-                  in_idx++; // skip alpha
-                  whitish = with_color ? ((red > 0x80) && (green > 0x80) && (blue > 0x80)) : ((red + green + blue) > 3 * 0x80); // whitish
-                  colored = (red > 0xF0) || ((green > 0xF0) && (blue > 0xF0)); // reddish or yellowish?
-                  color = ((red & 0xF8) << 8) | ((green & 0xFC) << 3) | ((blue & 0xF8) >> 3);
-                  break;
-                case 24:
-                  blue = input_buffer[in_idx++];
-                  green = input_buffer[in_idx++];
-                  red = input_buffer[in_idx++];
-                  whitish = with_color ? ((red > 0x80) && (green > 0x80) && (blue > 0x80)) : ((red + green + blue) > 3 * 0x80); // whitish
-                  colored = (red > 0xF0) || ((green > 0xF0) && (blue > 0xF0)); // reddish or yellowish?
-                  color = ((red & 0xF8) << 8) | ((green & 0xFC) << 3) | ((blue & 0xF8) >> 3);
-                  break;
-                case 16:
-                  {
-                    uint8_t lsb = input_buffer[in_idx++];
-                    uint8_t msb = input_buffer[in_idx++];
-                    if (format == 0) // 555
-                    {
-                      blue  = (lsb & 0x1F) << 3;
-                      green = ((msb & 0x03) << 6) | ((lsb & 0xE0) >> 2);
-                      red   = (msb & 0x7C) << 1;
-                      color = ((red & 0xF8) << 8) | ((green & 0xFC) << 3) | ((blue & 0xF8) >> 3);
-                    }
-                    else // 565
-                    {
-                      blue  = (lsb & 0x1F) << 3;
-                      green = ((msb & 0x07) << 5) | ((lsb & 0xE0) >> 3);
-                      red   = (msb & 0xF8);
-                      color = (msb << 8) | lsb;
-                    }
-                    whitish = with_color ? ((red > 0x80) && (green > 0x80) && (blue > 0x80)) : ((red + green + blue) > 3 * 0x80); // whitish
-                    colored = (red > 0xF0) || ((green > 0xF0) && (blue > 0xF0)); // reddish or yellowish?
-                  }
-                  break;
-                case 1:
-                case 2:
-                case 4:
-                case 8:
-                  {
-                    if (0 == in_bits)
-                    {
-                      in_byte = input_buffer[in_idx++];
-                      in_bits = 8;
-                    }
-                    uint16_t pn = (in_byte >> bitshift) & bitmask;
-                    whitish = mono_palette_buffer[pn / 8] & (0x1 << pn % 8);
-                    colored = color_palette_buffer[pn / 8] & (0x1 << pn % 8);
-                    in_byte <<= depth;
-                    in_bits -= depth;
-                    color = rgb_palette_buffer[pn];
-                  }
-                  break;
-              }
-              if (with_color && has_multicolors)
-              {
-                // keep color
-              }
-              else if (whitish)
-              {
-                color = GxEPD_WHITE;
-              }
-              else if (colored && with_color)
-              {
-                color = GxEPD_COLORED;
-              }
-              else
-              {
-                color = GxEPD_BLACK;
-              }
-              uint16_t yrow = y + (flip ? h - row - 1 : row);
-              display.drawPixel(x + col, yrow, color);
-            } // end pixel
-          } // end line
-          Serial.print("page loaded in "); Serial.print(millis() - startTime); Serial.println(" ms");
-        }
-        while (display.nextPage());
-        Serial.print("loaded in "); Serial.print(millis() - startTime); Serial.println(" ms");
-      }
+      //if (!overwrite) display.fillScreen(GxEPD_WHITE);
+      if (!bmp.draw(display, x, y)) Serial.println("read error");
+      Serial.print("page loaded in "); Serial.print(millis() - startTime); Serial.println(" ms");
     }
+    while (display.nextPage());
+    Serial.print("loaded in "); Serial.print(millis() - startTime); Serial.println(" ms");
   }
-  file.close();
-  if (!valid)
+  else
   {
     Serial.println("bitmap format not handled.");
   }
+  file.close();
+}
+
+void drawNativeFromSD(const char *filename, int16_t x, int16_t y)
+{
+  File file;
+  uint32_t startTime = millis();
+  Serial.println();
+  Serial.print("Loading image '");
+  Serial.print(filename);
+  Serial.println('\'');
+#if defined(ESP32)
+  file = SD.open(String("/") + filename, FILE_READ);
+#else
+  file = SD.open(filename);
+#endif
+  if (!file)
+  {
+    Serial.print("File not found");
+    return;
+  }
+  GxEPD2_FileSource<File> source(file);
+  GxEPD2_NativeReader image(source);
+  if (image.begin())
+  {
+    Serial.print("Format: "); Serial.println(image.format());
+    Serial.print("Image size: ");
+    Serial.print(image.width());
+    Serial.print('x');
+    Serial.println(image.height());
+    // straight to controller memory, rows collected in input_buffer
+    if (image.write(display, x, y, input_buffer, sizeof(input_buffer))) display.refresh();
+    else Serial.println("read error");
+    Serial.print("loaded in "); Serial.print(millis() - startTime); Serial.println(" ms");
+  }
+  else
+  {
+    Serial.println("image format not handled.");
+  }
+  file.close();
 }
 
 uint16_t read16(File& f)
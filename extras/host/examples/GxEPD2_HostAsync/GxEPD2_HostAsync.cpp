@@ -0,0 +1,175 @@
+// GxEPD2_HostAsync.cpp by Jean-Marc Zingg
+
+// purpose is to check displayAsync() against display(), and to show how much of a refresh is left to the application
+// the application loop does its "work" in steps of 10ms while the panel refreshes, polled and with the BUSY interrupt
+// and to compare display() one panel after another with GxEPD2_MultiDisplay for three panels on one bus
+
+// build and run with: make run EXAMPLE=GxEPD2_HostAsync, see README.md of extras/host
+// exit code is 1 if any picture differs
+
+#include <GxEPD2_BW.h>
+#include <GxEPD2_3C.h>
+#include <GxEPD2_MultiDisplay.h>
+#include <GxEPD2_Host.h>
+#include <GxEPD2_HostPanel.h>
+
+#define EPD_CS 5
+#define EPD_DC 17
+#define EPD_RST 16
+#define EPD_BUSY 4
+
+GxEPD2_BW<GxEPD2_290_T94, GxEPD2_290_T94::HEIGHT> display_290(GxEPD2_290_T94(EPD_CS, EPD_DC, EPD_RST, EPD_BUSY)); // SSD1680
+GxEPD2_HostSSD16xx panel_290(GxEPD2_HostPanel::config<GxEPD2_290_T94>(EPD_CS, EPD_DC, EPD_RST, EPD_BUSY));
+
+GxEPD2_BW<GxEPD2_750_GDEY075T7, GxEPD2_750_GDEY075T7::HEIGHT> display_750(GxEPD2_750_GDEY075T7(EPD_CS, EPD_DC, EPD_RST, EPD_BUSY)); // UC8179
+GxEPD2_HostUC81xx panel_750(GxEPD2_HostPanel::config<GxEPD2_750_GDEY075T7>(EPD_CS, EPD_DC, EPD_RST, EPD_BUSY));
+
+GxEPD2_3C<GxEPD2_290_C90c, GxEPD2_290_C90c::HEIGHT> display_290c(GxEPD2_290_C90c(EPD_CS, EPD_DC, EPD_RST, EPD_BUSY)); // SSD1680
+GxEPD2_HostSSD16xx panel_290c(GxEPD2_HostPanel::config<GxEPD2_290_C90c>(EPD_CS, EPD_DC, EPD_RST, EPD_BUSY));
+
+// three panels on one bus, each with CS, RST and BUSY of its own
+GxEPD2_BW<GxEPD2_290_T94, GxEPD2_290_T94::HEIGHT> multi_290(GxEPD2_290_T94(EPD_CS, EPD_DC, EPD_RST, EPD_BUSY));
+GxEPD2_HostSSD16xx multi_panel_290(GxEPD2_HostPanel::config<GxEPD2_290_T94>(EPD_CS, EPD_DC, EPD_RST, EPD_BUSY));
+GxEPD2_BW<GxEPD2_750_GDEY075T7, GxEPD2_750_GDEY075T7::HEIGHT> multi_750(GxEPD2_750_GDEY075T7(18, EPD_DC, 25, 21));
+GxEPD2_HostUC81xx multi_panel_750(GxEPD2_HostPanel::config<GxEPD2_750_GDEY075T7>(18, EPD_DC, 25, 21));
+GxEPD2_3C<GxEPD2_290_C90c, GxEPD2_290_C90c::HEIGHT> multi_290c(GxEPD2_290_C90c(19, EPD_DC, 26, 22));
+GxEPD2_HostSSD16xx multi_panel_290c(GxEPD2_HostPanel::config<GxEPD2_290_C90c>(19, EPD_DC, 26, 22));
+GxEPD2_MultiDisplay multi;
+
+uint16_t refreshes_done, updates_done;
+
+void refreshDone(const void*)
+{
+  refreshes_done++;
+}
+
+template<typename GxEPD2_Type> void drawPicture(GxEPD2_Type& display, uint16_t variant)
+{
+  display.fillScreen(GxEPD_WHITE);
+  display.fillRect(8 + variant, 8, display.width() / 3, display.height() / 4, GxEPD_BLACK);
+  for (int16_t y = display.height() / 2; y < display.height() - 8; y += 6 + variant)
+  {
+    display.drawFastHLine(3 + variant, y, display.width() - 13, GxEPD_BLACK);
+  }
+  if (display.epd2.hasColor) display.fillRect(display.width() / 2, display.height() / 3, 41, 23 + variant, GxEPD_RED);
+}
+
+// returns the number of 10ms work steps done while the panel was busy
+template<typename GxEPD2_Type> uint32_t displayAsync(GxEPD2_Type& display, bool partial, uint32_t& blocked_ms)
+{
+  uint32_t start = millis();
+  display.displayAsync(partial);
+  blocked_ms = millis() - start;
+  uint32_t steps = 0;
+  while (display.isBusy())
+  {
+    delay(10); // the application's work
+    steps++;
+  }
+  return steps;
+}
+
+template<typename GxEPD2_Type> bool check(GxEPD2_Type& display, GxEPD2_HostPanel& panel, const char* name, bool partial, bool interrupt)
+{
+  uint32_t reference, blocked_ms;
+  uint16_t variant = partial ? 3 : 0;
+  drawPicture(display, variant);
+  uint32_t start = millis();
+  display.display(partial);
+  uint32_t display_ms = millis() - start;
+  reference = panel.checksum();
+  drawPicture(display, variant + 1); // something else in between
+  display.display(partial);
+  display.epd2.enableBusyInterrupt(interrupt);
+  drawPicture(display, variant);
+  uint16_t refreshes = refreshes_done;
+  uint32_t steps = displayAsync(display, partial, blocked_ms);
+  bool ok = (panel.checksum() == reference) && (refreshes_done == refreshes + 1) && !panel.isPowerOn() == !partial;
+  Serial.printf("%-22s %-8s %-9s display() %5" PRIu32 " ms, displayAsync() %4" PRIu32 " ms, %3" PRIu32 " steps of work %s\n",
+                name, partial ? "partial" : "full", interrupt ? "interrupt" : "polled", display_ms, blocked_ms, steps, ok ? "ok" : "DIFFERS");
+  display.epd2.enableBusyInterrupt(false);
+  return ok;
+}
+
+template<typename GxEPD2_Type> bool run(GxEPD2_Type& display, GxEPD2_HostPanel& panel, const char* name)
+{
+  bool ok = true;
+  GxEPD2Host.attach(panel);
+  display.init(0);
+  display.epd2.setRefreshCallback(refreshDone);
+  ok = check(display, panel, name, false, false) && ok;
+  ok = check(display, panel, name, false, true) && ok;
+  if (display.epd2.hasFastPartialUpdate)
+  {
+    ok = check(display, panel, name, true, false) && ok;
+    ok = check(display, panel, name, true, true) && ok;
+  }
+  display.hibernate();
+  GxEPD2Host.detach(panel);
+  return ok;
+}
+
+void updateDone(uint8_t, const void*)
+{
+  updates_done++;
+}
+
+void drawPictures(uint16_t variant)
+{
+  drawPicture(multi_290, variant);
+  drawPicture(multi_750, variant);
+  drawPicture(multi_290c, variant);
+}
+
+bool checkMulti()
+{
+  GxEPD2Host.attach(multi_panel_290);
+  GxEPD2Host.attach(multi_panel_750);
+  GxEPD2Host.attach(multi_panel_290c);
+  multi_290.init(0);
+  multi_750.init(0);
+  multi_290c.init(0);
+  multi.add(multi_290);
+  multi.add(multi_750);
+  multi.add(multi_290c);
+  multi.setDoneCallback(updateDone);
+  drawPictures(0);
+  uint32_t start = millis();
+  multi_290.display();
+  multi_750.display();
+  multi_290c.display();
+  uint32_t display_ms = millis() - start;
+  uint32_t reference[] = {multi_panel_290.checksum(), multi_panel_750.checksum(), multi_panel_290c.checksum()};
+  drawPictures(1); // something else in between
+  multi_290.display();
+  multi_750.display();
+  multi_290c.display();
+  drawPictures(0);
+  start = millis();
+  for (uint8_t i = 0; i < 3; i++) multi.queue(i);
+  multi.runAll();
+  uint32_t multi_ms = millis() - start;
+  bool ok = (multi_panel_290.checksum() == reference[0]) && (multi_panel_750.checksum() == reference[1]) &&
+            (multi_panel_290c.checksum() == reference[2]) && (updates_done == 3) &&
+            multi.isDone(0) && multi.isDone(1) && multi.isDone(2) && !multi_panel_750.isPowerOn();
+  Serial.printf("%-22s %-8s %-9s display() %5" PRIu32 " ms, GxEPD2_MultiDisplay %5" PRIu32 " ms %s\n",
+                "3 panels on one bus", "full", "polled", display_ms, multi_ms, ok ? "ok" : "DIFFERS");
+  multi_290.hibernate();
+  multi_750.hibernate();
+  multi_290c.hibernate();
+  GxEPD2Host.detach(multi_panel_290);
+  GxEPD2Host.detach(multi_panel_750);
+  GxEPD2Host.detach(multi_panel_290c);
+  return ok;
+}
+
+int main()
+{
+  bool ok = true;
+  ok = run(display_290, panel_290, "GxEPD2_290_T94") && ok;
+  ok = run(display_750, panel_750, "GxEPD2_750_GDEY075T7") && ok;
+  ok = run(display_290c, panel_290c, "GxEPD2_290_C90c") && ok;
+  ok = checkMulti() && ok;
+  Serial.println(ok ? "all pictures equal" : "pictures differ");
+  return ok ? 0 : 1;
+}
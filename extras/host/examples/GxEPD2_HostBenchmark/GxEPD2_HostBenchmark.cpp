@@ -0,0 +1,172 @@
+// GxEPD2_HostBenchmark.cpp by Jean-Marc Zingg
+
+// purpose is to get repeatable numbers for changes to paging or transfer code
+// reports SPI bytes, transactions, CS selects, commands, BUSY waits and times for the common display operations
+// of representative panels, with the virtual clock of the host emulation
+
+// build and run with: make run EXAMPLE=GxEPD2_HostBenchmark, see README.md of extras/host
+// option -c prints comma separated values, e.g. for diff or a spreadsheet
+// see extras/tests/GxEPD2_Benchmark for the same on a real processor and panel
+
+#include <GxEPD2_BW.h>
+#include <GxEPD2_3C.h>
+#include <GxEPD2_Host.h>
+#include <GxEPD2_HostPanel.h>
+
+#define EPD_CS 5
+#define EPD_DC 17
+#define EPD_RST 16
+#define EPD_BUSY 4
+
+// full screen buffer and paged for each panel, on the same pins
+GxEPD2_BW<GxEPD2_290_T94, GxEPD2_290_T94::HEIGHT> full_290(GxEPD2_290_T94(EPD_CS, EPD_DC, EPD_RST, EPD_BUSY)); // SSD1680
+GxEPD2_BW<GxEPD2_290_T94, GxEPD2_290_T94::HEIGHT / 4> paged_290(GxEPD2_290_T94(EPD_CS, EPD_DC, EPD_RST, EPD_BUSY));
+GxEPD2_HostSSD16xx panel_290(GxEPD2_HostPanel::config<GxEPD2_290_T94>(EPD_CS, EPD_DC, EPD_RST, EPD_BUSY));
+
+GxEPD2_BW<GxEPD2_750_GDEY075T7, GxEPD2_750_GDEY075T7::HEIGHT> full_750(GxEPD2_750_GDEY075T7(EPD_CS, EPD_DC, EPD_RST, EPD_BUSY)); // UC8179
+GxEPD2_BW<GxEPD2_750_GDEY075T7, GxEPD2_750_GDEY075T7::HEIGHT / 4> paged_750(GxEPD2_750_GDEY075T7(EPD_CS, EPD_DC, EPD_RST, EPD_BUSY));
+GxEPD2_HostUC81xx panel_750(GxEPD2_HostPanel::config<GxEPD2_750_GDEY075T7>(EPD_CS, EPD_DC, EPD_RST, EPD_BUSY));
+
+GxEPD2_3C<GxEPD2_290_C90c, GxEPD2_290_C90c::HEIGHT> full_290c(GxEPD2_290_C90c(EPD_CS, EPD_DC, EPD_RST, EPD_BUSY)); // SSD1680
+GxEPD2_3C<GxEPD2_290_C90c, GxEPD2_290_C90c::HEIGHT / 4> paged_290c(GxEPD2_290_C90c(EPD_CS, EPD_DC, EPD_RST, EPD_BUSY));
+GxEPD2_HostSSD16xx panel_290c(GxEPD2_HostPanel::config<GxEPD2_290_C90c>(EPD_CS, EPD_DC, EPD_RST, EPD_BUSY));
+
+GxEPD2_3C<GxEPD2_420c, GxEPD2_420c::HEIGHT> full_420c(GxEPD2_420c(EPD_CS, EPD_DC, EPD_RST, EPD_BUSY)); // UC8176
+GxEPD2_3C<GxEPD2_420c, GxEPD2_420c::HEIGHT / 4> paged_420c(GxEPD2_420c(EPD_CS, EPD_DC, EPD_RST, EPD_BUSY));
+GxEPD2_HostUC81xx panel_420c(GxEPD2_HostPanel::config<GxEPD2_420c>(EPD_CS, EPD_DC, EPD_RST, EPD_BUSY));
+
+GxEPD2_BW<GxEPD2_it60, GxEPD2_it60::HEIGHT> full_it60(GxEPD2_it60(EPD_CS, EPD_DC, EPD_RST, EPD_BUSY)); // IT8951
+GxEPD2_BW<GxEPD2_it60, GxEPD2_it60::HEIGHT / 4> paged_it60(GxEPD2_it60(EPD_CS, EPD_DC, EPD_RST, EPD_BUSY));
+GxEPD2_HostIT8951 panel_it60(GxEPD2_HostPanel::config<GxEPD2_it60>(EPD_CS, -1, EPD_RST, EPD_BUSY));
+
+uint8_t shadow[(GxEPD2_it60::WIDTH / 8) * GxEPD2_it60::HEIGHT]; // for the largest GxEPD2_BW panel here
+
+const uint16_t image_size = 64; // drawImage() bitmap, square
+uint8_t image[image_size * image_size / 8];
+
+bool csv = false;
+
+template<typename GxEPD2_Type> void drawPicture(GxEPD2_Type& display)
+{
+  display.fillScreen(GxEPD_WHITE);
+  display.fillRect(8, 8, display.width() / 3, display.height() / 4, GxEPD_BLACK);
+  for (int16_t y = display.height() / 2; y < display.height() - 8; y += 6)
+  {
+    display.drawFastHLine(3, y, display.width() - 13, GxEPD_BLACK);
+  }
+  if (display.epd2.hasColor) display.fillRect(display.width() / 2, display.height() / 3, 41, 23, GxEPD_RED);
+}
+
+void printHeader()
+{
+  if (csv) Serial.println("panel,operation,spi bytes,transactions,cs selects,commands,busy waits,busy ms,spi ms,elapsed ms,full refreshes,partial refreshes");
+  else Serial.printf("%-22s %-14s %9s %7s %7s %6s %5s %8s %8s %8s %5s\n",
+                       "panel", "operation", "bytes", "trans", "cs", "cmds", "busy", "busy ms", "spi ms", "total ms", "f/p");
+}
+
+template<typename GxEPD2_Type> void start(GxEPD2_Type& display)
+{
+  GxEPD2Host.resetStats();
+  display.epd2.resetStatistics();
+}
+
+// wire counters from the host emulation, BUSY time as measured in _waitWhileBusy()
+template<typename GxEPD2_Type> void report(GxEPD2_Type& display, const char* panel, const char* operation)
+{
+  const GxEPD2_HostStats& s = GxEPD2Host.stats();
+  GxEPD2_EPD::Statistics e = display.epd2.getStatistics();
+  if (csv) Serial.printf("%s,%s,%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%.1f,%.1f,%.1f,%" PRIu32 ",%" PRIu32 "\n",
+                           panel, operation, s.spi_bytes, s.transactions, s.cs_selects, s.commands, e.busy_waits,
+                           e.busy_time_us / 1000.0, s.spi_time_us / 1000.0, s.elapsed_us / 1000.0, s.full_refreshes, s.partial_refreshes);
+  else Serial.printf("%-22s %-14s %9" PRIu32 " %7" PRIu32 " %7" PRIu32 " %6" PRIu32 " %5" PRIu32 " %8.1f %8.1f %8.1f %2" PRIu32 "/%-2" PRIu32 "\n",
+                       panel, operation, s.spi_bytes, s.transactions, s.cs_selects, s.commands, e.busy_waits,
+                       e.busy_time_us / 1000.0, s.spi_time_us / 1000.0, s.elapsed_us / 1000.0, s.full_refreshes, s.partial_refreshes);
+}
+
+template<typename Paged> void pagedLoop(Paged& paged)
+{
+  paged.firstPage();
+  do
+  {
+    drawPicture(paged);
+  }
+  while (paged.nextPage());
+}
+
+// each panel is measured after a first full update, as in normal use
+template<typename Full, typename Paged> void benchmark(Full& full, Paged& paged, GxEPD2_HostPanel& panel, const char* name)
+{
+  uint16_t x = 8 * (full.width() / 32), y = full.height() / 3, w = 8 * (full.width() / 16), h = full.height() / 4;
+  GxEPD2Host.attach(panel);
+  full.init(0);
+  drawPicture(full);
+  full.display();
+  start(full);
+  full.display();
+  report(full, name, "display()");
+  start(full);
+  full.display(true);
+  report(full, name, "display(true)");
+  start(full);
+  full.displayWindow(x, y, w, h);
+  report(full, name, "displayWindow");
+  start(full);
+  full.drawImage(image, x, y, image_size, image_size);
+  report(full, name, "drawImage");
+  paged.init(0);
+  paged.setFullWindow();
+  pagedLoop(paged);
+  start(paged);
+  pagedLoop(paged);
+  report(paged, name, "paged full");
+  paged.setPartialWindow(x, y, w, h);
+  start(paged);
+  pagedLoop(paged);
+  report(paged, name, "paged window");
+  paged.hibernate();
+  GxEPD2Host.detach(panel);
+}
+
+// GxEPD2_BW only: a small change, like a clock digit, with auto partial display, and with the whole picture redrawn and a shadow buffer
+template<typename Full> void benchmarkChanges(Full& full, GxEPD2_HostPanel& panel, const char* name)
+{
+  GxEPD2Host.attach(panel);
+  full.init(0);
+  drawPicture(full);
+  full.display();
+  full.autoPartial(true);
+  full.fillRect(full.width() / 2, 16, 24, 32, GxEPD_BLACK);
+  start(full);
+  full.display(true);
+  report(full, name, "auto partial");
+  full.autoPartial(false);
+  full.setShadowBuffer(shadow);
+  full.display(true);
+  drawPicture(full);
+  full.fillRect(full.width() / 2, 16, 24, 32, GxEPD_WHITE);
+  start(full);
+  full.display(true);
+  report(full, name, "shadow diff");
+  full.setShadowBuffer(0);
+  full.hibernate();
+  GxEPD2Host.detach(panel);
+}
+
+int main(int argc, char* argv[])
+{
+  csv = (argc > 1) && (strcmp(argv[1], "-c") == 0);
+  for (uint16_t i = 0; i < sizeof(image); i++)
+  {
+    image[i] = ((i / (image_size / 8)) / 8) % 2 ? 0x0F : 0xF0; // 4x8 checkers
+  }
+  printHeader();
+  benchmark(full_290, paged_290, panel_290, "GxEPD2_290_T94");
+  benchmark(full_750, paged_750, panel_750, "GxEPD2_750_GDEY075T7");
+  benchmark(full_290c, paged_290c, panel_290c, "GxEPD2_290_C90c");
+  benchmark(full_420c, paged_420c, panel_420c, "GxEPD2_420c");
+  benchmark(full_it60, paged_it60, panel_it60, "GxEPD2_it60");
+  benchmarkChanges(full_290, panel_290, "GxEPD2_290_T94");
+  benchmarkChanges(full_750, panel_750, "GxEPD2_750_GDEY075T7");
+  benchmarkChanges(full_it60, panel_it60, "GxEPD2_it60");
+  return 0;
+}
@@ -0,0 +1,88 @@
+// GxEPD2_HostExample.cpp by Jean-Marc Zingg
+
+// purpose is to run GxEPD2 on a Linux host, with emulated controllers on the SPI wires
+// shows the byte stream and the counters of the host emulation for a full and a partial paged update
+
+// build and run with: make run EXAMPLE=GxEPD2_HostExample, see README.md of extras/host
+// option -t prints all controller commands with their first data bytes
+
+#include <GxEPD2_BW.h>
+#include <GxEPD2_Host.h>
+#include <GxEPD2_HostPanel.h>
+
+// two panels on the same SPI bus, with shared DC and separate CS, RST, BUSY
+#define EPD_CS1 5
+#define EPD_CS2 15
+#define EPD_DC 17
+#define EPD_RST1 16
+#define EPD_RST2 26
+#define EPD_BUSY1 4
+#define EPD_BUSY2 25
+
+// paged, to show the effect of page_height
+GxEPD2_BW<GxEPD2_290_T94, GxEPD2_290_T94::HEIGHT / 2> display1(GxEPD2_290_T94(EPD_CS1, EPD_DC, EPD_RST1, EPD_BUSY1)); // GDEM029T94 SSD1680
+GxEPD2_BW<GxEPD2_750_GDEY075T7, GxEPD2_750_GDEY075T7::HEIGHT / 4> display2(GxEPD2_750_GDEY075T7(EPD_CS2, EPD_DC, EPD_RST2, EPD_BUSY2)); // GDEY075T7 UC8179
+
+GxEPD2_HostSSD16xx panel1(GxEPD2_HostPanel::config<GxEPD2_290_T94>(EPD_CS1, EPD_DC, EPD_RST1, EPD_BUSY1));
+GxEPD2_HostUC81xx panel2(GxEPD2_HostPanel::config<GxEPD2_750_GDEY075T7>(EPD_CS2, EPD_DC, EPD_RST2, EPD_BUSY2));
+
+template<typename GxEPD2_Type> void drawFull(GxEPD2_Type& display)
+{
+  display.setRotation(1);
+  display.setFullWindow();
+  display.firstPage();
+  do
+  {
+    display.fillScreen(GxEPD_WHITE);
+    display.fillRect(10, 10, display.width() / 2, display.height() / 4, GxEPD_BLACK);
+    display.drawRect(0, 0, display.width(), display.height(), GxEPD_BLACK);
+  }
+  while (display.nextPage());
+}
+
+template<typename GxEPD2_Type> void drawPartial(GxEPD2_Type& display)
+{
+  display.setPartialWindow(16, 40, 96, 32);
+  display.firstPage();
+  do
+  {
+    display.fillScreen(GxEPD_WHITE);
+    display.fillRect(20, 44, 40, 24, GxEPD_BLACK);
+  }
+  while (display.nextPage());
+}
+
+template<typename GxEPD2_Type> void run(GxEPD2_Type& display, const char* name)
+{
+  Serial.println(name);
+  GxEPD2Host.resetStats();
+  display.init(0, true, 2, false);
+  GxEPD2Host.printStats(Serial, "init");
+  GxEPD2Host.resetStats();
+  drawFull(display);
+  GxEPD2Host.printStats(Serial, "full paged");
+  GxEPD2Host.resetStats();
+  drawPartial(display);
+  GxEPD2Host.printStats(Serial, "partial window paged");
+  GxEPD2Host.resetStats();
+  display.hibernate();
+  GxEPD2Host.printStats(Serial, "hibernate");
+}
+
+int main(int argc, char* argv[])
+{
+  bool trace = (argc > 1) && (strcmp(argv[1], "-t") == 0);
+  GxEPD2Host.attach(panel1);
+  GxEPD2Host.attach(panel2);
+  if (trace)
+  {
+    panel1.setTrace(&Serial);
+    panel2.setTrace(&Serial);
+  }
+  run(display1, "GxEPD2_290_T94");
+  panel1.flushTrace();
+  run(display2, "GxEPD2_750_GDEY075T7");
+  panel2.flushTrace();
+  Serial.print("virtual time "); Serial.print(millis()); Serial.println(" ms");
+  return 0;
+}
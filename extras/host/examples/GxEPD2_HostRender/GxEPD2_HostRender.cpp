@@ -0,0 +1,382 @@
+// GxEPD2_HostRender.cpp by Jean-Marc Zingg
+
+// purpose is to check that different write paths produce the same picture on the panel
+// draws the same picture with a full screen buffer and paged, full and in a partial window,
+// compares what the emulated controllers show and writes it as PNG
+// checks drawBitmap() and drawInvertedBitmap() of GxEPD2_BW against drawing pixel by pixel, in all rotations, mirrored,
+// in a partial window
+// checks that a partial window in a corner of GxEPD2_1248 is written to and refreshed by one of its four controllers
+
+// build and run with: make run EXAMPLE=GxEPD2_HostRender ARGS=<output directory>, see README.md of extras/host
+// exit code is 1 if any picture differs
+
+#include <GxEPD2_BW.h>
+#include <GxEPD2_3C.h>
+#include <GxEPD2_16G.h>
+#include <GxEPD2_Host.h>
+#include <GxEPD2_HostPanel.h>
+
+#define EPD_CS 5
+#define EPD_DC 17
+#define EPD_RST 16
+#define EPD_BUSY 4
+
+// full screen buffer and paged for each panel, on the same pins
+GxEPD2_BW<GxEPD2_290_T94, GxEPD2_290_T94::HEIGHT> full_290(GxEPD2_290_T94(EPD_CS, EPD_DC, EPD_RST, EPD_BUSY));
+GxEPD2_BW<GxEPD2_290_T94, GxEPD2_290_T94::HEIGHT / 5> paged_290(GxEPD2_290_T94(EPD_CS, EPD_DC, EPD_RST, EPD_BUSY));
+GxEPD2_HostSSD16xx panel_290(GxEPD2_HostPanel::config<GxEPD2_290_T94>(EPD_CS, EPD_DC, EPD_RST, EPD_BUSY));
+
+GxEPD2_BW<GxEPD2_750_GDEY075T7, GxEPD2_750_GDEY075T7::HEIGHT> full_750(GxEPD2_750_GDEY075T7(EPD_CS, EPD_DC, EPD_RST, EPD_BUSY));
+GxEPD2_BW<GxEPD2_750_GDEY075T7, GxEPD2_750_GDEY075T7::HEIGHT / 7> paged_750(GxEPD2_750_GDEY075T7(EPD_CS, EPD_DC, EPD_RST, EPD_BUSY));
+GxEPD2_HostUC81xx panel_750(GxEPD2_HostPanel::config<GxEPD2_750_GDEY075T7>(EPD_CS, EPD_DC, EPD_RST, EPD_BUSY));
+
+GxEPD2_3C<GxEPD2_290_C90c, GxEPD2_290_C90c::HEIGHT> full_290c(GxEPD2_290_C90c(EPD_CS, EPD_DC, EPD_RST, EPD_BUSY));
+GxEPD2_3C<GxEPD2_290_C90c, GxEPD2_290_C90c::HEIGHT / 3> paged_290c(GxEPD2_290_C90c(EPD_CS, EPD_DC, EPD_RST, EPD_BUSY));
+GxEPD2_HostSSD16xx panel_290c(GxEPD2_HostPanel::config<GxEPD2_290_C90c>(EPD_CS, EPD_DC, EPD_RST, EPD_BUSY));
+
+GxEPD2_3C<GxEPD2_420c, GxEPD2_420c::HEIGHT> full_420c(GxEPD2_420c(EPD_CS, EPD_DC, EPD_RST, EPD_BUSY));
+GxEPD2_3C<GxEPD2_420c, GxEPD2_420c::HEIGHT / 4> paged_420c(GxEPD2_420c(EPD_CS, EPD_DC, EPD_RST, EPD_BUSY));
+GxEPD2_HostUC81xx panel_420c(GxEPD2_HostPanel::config<GxEPD2_420c>(EPD_CS, EPD_DC, EPD_RST, EPD_BUSY));
+
+GxEPD2_BW<GxEPD2_it60, GxEPD2_it60::HEIGHT> full_it60(GxEPD2_it60(EPD_CS, EPD_DC, EPD_RST, EPD_BUSY));
+GxEPD2_BW<GxEPD2_it60, GxEPD2_it60::HEIGHT / 6> paged_it60(GxEPD2_it60(EPD_CS, EPD_DC, EPD_RST, EPD_BUSY));
+GxEPD2_HostIT8951 panel_it60(GxEPD2_HostPanel::config<GxEPD2_it60>(EPD_CS, -1, EPD_RST, EPD_BUSY));
+
+GxEPD2_16G<GxEPD2_it60, GxEPD2_it60::HEIGHT> full_it60g(GxEPD2_it60(EPD_CS, EPD_DC, EPD_RST, EPD_BUSY));
+GxEPD2_16G<GxEPD2_it60, GxEPD2_it60::HEIGHT / 6> paged_it60g(GxEPD2_it60(EPD_CS, EPD_DC, EPD_RST, EPD_BUSY));
+
+// GxEPD2_1248, four controllers on their own CS and BUSY pins: S2 top left, M2 top right, M1 bottom left, S1 bottom right
+GxEPD2_BW<GxEPD2_1248, GxEPD2_1248::HEIGHT> full_1248(GxEPD2_1248(10, 11, 12, 13, 14, 15, 16, 17, 20, 21, 22, 23));
+GxEPD2_BW<GxEPD2_1248, GxEPD2_1248::HEIGHT / 8> paged_1248(GxEPD2_1248(10, 11, 12, 13, 14, 15, 16, 17, 20, 21, 22, 23));
+
+// one controller of GxEPD2_1248, w x 492 pixels
+GxEPD2_HostPanel::Config config_1248(int16_t cs, int16_t dc, int16_t rst, int16_t busy, uint16_t w)
+{
+  GxEPD2_HostPanel::Config c = {cs, dc, rst, busy, w, GxEPD2_1248::HEIGHT / 2, false,
+                                GxEPD2_1248::power_on_time, GxEPD2_1248::power_off_time,
+                                GxEPD2_1248::full_refresh_time, GxEPD2_1248::partial_refresh_time
+                               };
+  return c;
+}
+
+GxEPD2_HostUC81xx panel_1248_m1(config_1248(10, 14, 16, 20, 648));
+GxEPD2_HostUC81xx panel_1248_s1(config_1248(11, 14, 16, 21, 656));
+GxEPD2_HostUC81xx panel_1248_m2(config_1248(12, 15, 17, 22, 656));
+GxEPD2_HostUC81xx panel_1248_s2(config_1248(13, 15, 17, 23, 648));
+GxEPD2_HostPanel* const panels_1248[] = {&panel_1248_m1, &panel_1248_s1, &panel_1248_m2, &panel_1248_s2};
+const char* const parts_1248[] = {"m1", "s1", "m2", "s2"};
+
+const char* output_directory = ".";
+
+// RGB565 of gray level 0 .. 15
+uint16_t grayColor(uint8_t level)
+{
+  uint8_t v = level * 17;
+  return ((v >> 3) << 11) | ((v >> 2) << 5) | (v >> 3);
+}
+
+// bars of the 16 gray levels, mostly in the partial window, only for the grayscale display class
+template<typename GxEPD2_Type> void drawGrays(GxEPD2_Type& display, uint16_t variant)
+{
+  (void) display;
+  (void) variant;
+}
+
+template<typename GxEPD2_Type, const uint16_t page_height> void drawGrays(GxEPD2_16G<GxEPD2_Type, page_height>& display, uint16_t variant)
+{
+  for (uint8_t level = 0; level < 16; level++)
+  {
+    display.fillRect(display.width() / 2 + 16 * level + variant, display.height() / 3 + 8, 16, display.height() / 6, grayColor(level));
+  }
+}
+
+// the bars show the gray levels, after the refresh of the paged partial window
+bool checkGrays(GxEPD2_HostPanel& panel, const char* name)
+{
+  bool ok = true;
+  for (uint8_t level = 0; level < 16; level++)
+  {
+    uint32_t gray = 0x111111 * level;
+    ok = (panel.pixel(panel.cfg.width / 2 + 16 * level + 8, panel.cfg.height / 3 + 16) == gray) && ok;
+  }
+  Serial.printf("%-24s %-8s %-6s %-8s %s\n", name, "grays", "paged", "", ok ? "ok" : "DIFFERS");
+  return ok;
+}
+
+template<typename GxEPD2_Type> void drawPicture(GxEPD2_Type& display, uint16_t variant)
+{
+  display.fillScreen(GxEPD_WHITE);
+  display.fillRect(8 + variant, 8, display.width() / 3, display.height() / 4, GxEPD_BLACK);
+  for (int16_t y = display.height() / 2; y < display.height() - 8; y += 6 + variant)
+  {
+    display.drawFastHLine(3 + variant, y, display.width() - 13, GxEPD_BLACK);
+  }
+  for (int16_t x = 5; x < display.width() / 2; x += 9)
+  {
+    display.drawFastVLine(x, display.height() / 3, display.height() / 6 + variant, GxEPD_BLACK);
+  }
+  if (display.epd2.hasColor) display.fillRect(display.width() / 2, display.height() / 3, 41, 23 + variant, GxEPD_RED);
+  drawGrays(display, variant);
+}
+
+// bitmap of 37 x 29 pixels, rows padded to bytes, filled in main()
+const int16_t bitmap_w = 37, bitmap_h = 29;
+uint8_t test_bitmap[((bitmap_w + 7) / 8) * bitmap_h];
+
+// the bits of the bitmap drawn one pixel at a time, as the drawBitmap() of Adafruit_GFX; bg < 0 for transparent
+template<typename GxEPD2_Type> void drawBitmapPixels(GxEPD2_Type& display, int16_t x, int16_t y, uint16_t color, int32_t bg, bool invert)
+{
+  for (int16_t j = 0; j < bitmap_h; j++)
+  {
+    for (int16_t i = 0; i < bitmap_w; i++)
+    {
+      bool set = test_bitmap[j * ((bitmap_w + 7) / 8) + i / 8] & (0x80 >> (i % 8));
+      if (set != invert) display.drawPixel(x + i, y + j, color);
+      else if (bg >= 0) display.drawPixel(x + i, y + j, bg);
+    }
+  }
+}
+
+// bitmaps at odd positions, across the edges of the screen and of the partial window
+template<typename GxEPD2_Type> void drawBitmaps(GxEPD2_Type& display, bool pixels)
+{
+  const int16_t xs[] = {-5, 3, int16_t(display.width() / 5 - 11), int16_t(display.width() / 2 + 1), int16_t(display.width() - 20)};
+  const int16_t ys[] = {-3, int16_t(display.height() / 4 - 6), int16_t(display.height() / 2 + 2), int16_t(3 * display.height() / 4 - 3), int16_t(display.height() - 10)};
+  display.fillScreen(GxEPD_WHITE);
+  display.fillRect(0, display.height() / 2, display.width(), display.height() / 2, GxEPD_BLACK);
+  for (uint8_t k = 0; k < 5; k++)
+  {
+    for (uint8_t l = 0; l < 5; l++)
+    {
+      int16_t x = xs[k], y = ys[l];
+      switch ((k + l) % 4)
+      {
+        case 0: // transparent, PROGMEM
+          if (pixels) drawBitmapPixels(display, x, y, GxEPD_BLACK, -1, false);
+          else display.drawBitmap(x, y, (const uint8_t*)test_bitmap, bitmap_w, bitmap_h, GxEPD_BLACK);
+          break;
+        case 1: // opaque
+          if (pixels) drawBitmapPixels(display, x, y, GxEPD_WHITE, GxEPD_BLACK, false);
+          else display.drawBitmap(x, y, test_bitmap, bitmap_w, bitmap_h, GxEPD_WHITE, GxEPD_BLACK);
+          break;
+        case 2: // transparent, RAM
+          if (pixels) drawBitmapPixels(display, x, y, GxEPD_WHITE, -1, false);
+          else display.drawBitmap(x, y, test_bitmap, bitmap_w, bitmap_h, GxEPD_WHITE);
+          break;
+        case 3:
+          if (pixels) drawBitmapPixels(display, x, y, GxEPD_BLACK, -1, true);
+          else display.drawInvertedBitmap(x, y, test_bitmap, bitmap_w, bitmap_h, GxEPD_BLACK);
+          break;
+      }
+    }
+  }
+}
+
+// in a partial window, on the last page of the paged display class it ends inside the page
+template<typename GxEPD2_Type> uint32_t drawBitmapWindow(GxEPD2_Type& display, GxEPD2_HostPanel& panel, bool pixels)
+{
+  display.setPartialWindow(display.width() / 5, display.height() / 4 + 3, display.width() / 2, display.height() / 2 + 5);
+  display.firstPage();
+  do
+  {
+    drawBitmaps(display, pixels);
+  }
+  while (display.nextPage());
+  return panel.checksum();
+}
+
+template<typename Full, typename Paged> bool compareBitmaps(Full& full, Paged& paged, GxEPD2_HostPanel& panel, const char* name)
+{
+  bool ok = true;
+  GxEPD2Host.attach(panel);
+  full.init(0);
+  paged.init(0);
+  for (uint8_t rotation = 0; rotation < 4; rotation++)
+  {
+    for (uint8_t m = 0; m < 2; m++)
+    {
+      char step[16];
+      snprintf(step, sizeof(step), "bitmap%u%s", rotation, m ? "m" : "");
+      full.setRotation(rotation);
+      full.mirror(m);
+      paged.setRotation(rotation);
+      paged.mirror(m);
+      uint32_t reference = drawBitmapWindow(full, panel, true);
+      uint32_t checksum = drawBitmapWindow(full, panel, false);
+      ok = (checksum == reference) && ok;
+      Serial.printf("%-24s %-8s %-6s %08" PRIX32 " %s\n", name, step, "full", checksum, checksum == reference ? "ok" : "DIFFERS");
+      reference = drawBitmapWindow(paged, panel, true);
+      checksum = drawBitmapWindow(paged, panel, false);
+      ok = (checksum == reference) && ok;
+      Serial.printf("%-24s %-8s %-6s %08" PRIX32 " %s\n", name, step, "paged", checksum, checksum == reference ? "ok" : "DIFFERS");
+    }
+  }
+  full.setRotation(0);
+  full.mirror(false);
+  paged.setRotation(0);
+  paged.mirror(false);
+  paged.hibernate();
+  GxEPD2Host.detach(panel);
+  return ok;
+}
+
+bool check(uint32_t checksum, const char* name, const char* step, uint32_t& reference, bool first)
+{
+  if (first) reference = checksum;
+  bool ok = checksum == reference;
+  Serial.printf("%-24s %-8s %-6s %08" PRIX32 " %s\n", name, step, first ? "full" : "paged", checksum, ok ? "ok" : "DIFFERS");
+  return ok;
+}
+
+bool check(GxEPD2_HostPanel& panel, const char* name, const char* step, uint32_t& reference, bool first)
+{
+  char path[256];
+  snprintf(path, sizeof(path), "%s/%s_%s_%s.png", output_directory, name, step, first ? "full" : "paged");
+  panel.writeImage(path);
+  return check(panel.checksum(), name, step, reference, first);
+}
+
+template<typename Full, typename Paged> bool compare(Full& full, Paged& paged, GxEPD2_HostPanel& panel, const char* name)
+{
+  bool ok = true;
+  uint32_t reference[2];
+  // x and w on byte boundaries: setPartialWindow() widens the window to byte boundaries, displayWindow() of some drivers doesn't
+  uint16_t x = 8 * (full.width() / 32), y = full.height() / 3 + 1, w = 8 * (full.width() / 16), h = full.height() / 4;
+  GxEPD2Host.attach(panel);
+  // full screen buffer, display() and displayWindow()
+  full.init(0);
+  drawPicture(full, 0);
+  full.display();
+  ok = check(panel, name, "screen", reference[0], true) && ok;
+  drawPicture(full, 2);
+  full.displayWindow(x, y, w, h);
+  ok = check(panel, name, "window", reference[1], true) && ok;
+  // paged
+  paged.init(0);
+  paged.setFullWindow();
+  paged.firstPage();
+  do
+  {
+    drawPicture(paged, 0);
+  }
+  while (paged.nextPage());
+  ok = check(panel, name, "screen", reference[0], false) && ok;
+  paged.setPartialWindow(x, y, w, h);
+  paged.firstPage();
+  do
+  {
+    drawPicture(paged, 2);
+  }
+  while (paged.nextPage());
+  ok = check(panel, name, "window", reference[1], false) && ok;
+  paged.hibernate();
+  GxEPD2Host.detach(panel);
+  return ok;
+}
+
+// the four controllers of GxEPD2_1248 as one picture, one PNG for each
+bool check1248(const char* name, const char* step, uint32_t& reference, bool first)
+{
+  uint32_t checksum = 2166136261UL;
+  for (uint8_t i = 0; i < 4; i++)
+  {
+    char path[256];
+    snprintf(path, sizeof(path), "%s/%s_%s_%s_%s.png", output_directory, name, step, first ? "full" : "paged", parts_1248[i]);
+    panels_1248[i]->writeImage(path);
+    checksum = (checksum ^ panels_1248[i]->checksum()) * 16777619UL;
+  }
+  return check(checksum, name, step, reference, first);
+}
+
+// a window in the bottom left corner: one refresh, the RAM and screen of S1, M2 and S2 don't change
+template<typename GxEPD2_Type> bool cornerWindow1248(GxEPD2_Type& display, bool paged, const char* name, uint32_t& reference)
+{
+  uint32_t before[4][2];
+  for (uint8_t i = 0; i < 4; i++)
+  {
+    before[i][0] = panels_1248[i]->checksum(GxEPD2_HostPanel::Current);
+    before[i][1] = panels_1248[i]->checksum(GxEPD2_HostPanel::Screen);
+  }
+  GxEPD2Host.resetStats();
+  if (paged)
+  {
+    display.setPartialWindow(0, display.height() - 64, 64, 64);
+    display.firstPage();
+    do
+    {
+      drawPicture(display, 4);
+    }
+    while (display.nextPage());
+  }
+  else
+  {
+    drawPicture(display, 4);
+    display.displayWindow(0, display.height() - 64, 64, 64);
+  }
+  const GxEPD2_HostStats& stats = GxEPD2Host.stats();
+  bool one = (stats.full_refreshes == 0) && (stats.partial_refreshes == 1);
+  for (uint8_t i = 1; i < 4; i++)
+  {
+    one = (panels_1248[i]->checksum(GxEPD2_HostPanel::Current) == before[i][0]) && one;
+    one = (panels_1248[i]->checksum(GxEPD2_HostPanel::Screen) == before[i][1]) && one;
+  }
+  Serial.printf("%-24s %-8s %-6s %-8s %s\n", name, "corner", paged ? "paged" : "full", "m1 only", one ? "ok" : "DIFFERS");
+  return check1248(name, "corner", reference, !paged) && one;
+}
+
+template<typename Full, typename Paged> bool compare1248(Full& full, Paged& paged, const char* name)
+{
+  bool ok = true;
+  uint32_t reference[3];
+  uint16_t x = 8 * (full.width() / 32), y = full.height() / 3 + 1, w = 8 * (full.width() / 16), h = full.height() / 4;
+  for (uint8_t i = 0; i < 4; i++) GxEPD2Host.attach(*panels_1248[i]);
+  // full screen buffer, display(), displayWindow() across the four parts and in a corner
+  full.init(0);
+  drawPicture(full, 0);
+  full.display();
+  ok = check1248(name, "screen", reference[0], true) && ok;
+  drawPicture(full, 2);
+  full.displayWindow(x, y, w, h);
+  ok = check1248(name, "window", reference[1], true) && ok;
+  ok = cornerWindow1248(full, false, name, reference[2]) && ok;
+  // paged
+  paged.init(0);
+  paged.setFullWindow();
+  paged.firstPage();
+  do
+  {
+    drawPicture(paged, 0);
+  }
+  while (paged.nextPage());
+  ok = check1248(name, "screen", reference[0], false) && ok;
+  paged.setPartialWindow(x, y, w, h);
+  paged.firstPage();
+  do
+  {
+    drawPicture(paged, 2);
+  }
+  while (paged.nextPage());
+  ok = check1248(name, "window", reference[1], false) && ok;
+  ok = cornerWindow1248(paged, true, name, reference[2]) && ok;
+  paged.hibernate();
+  for (uint8_t i = 0; i < 4; i++) GxEPD2Host.detach(*panels_1248[i]);
+  return ok;
+}
+
+int main(int argc, char* argv[])
+{
+  if (argc > 1) output_directory = argv[1];
+  bool ok = true;
+  ok = compare(full_290, paged_290, panel_290, "GxEPD2_290_T94") && ok;
+  ok = compare(full_750, paged_750, panel_750, "GxEPD2_750_GDEY075T7") && ok;
+  ok = compare(full_290c, paged_290c, panel_290c, "GxEPD2_290_C90c") && ok;
+  ok = compare(full_420c, paged_420c, panel_420c, "GxEPD2_420c") && ok;
+  ok = compare(full_it60, paged_it60, panel_it60, "GxEPD2_it60") && ok;
+  ok = compare(full_it60g, paged_it60g, panel_it60, "GxEPD2_it60 16G") && ok;
+  ok = checkGrays(panel_it60, "GxEPD2_it60 16G") && ok;
+  ok = compare1248(full_1248, paged_1248, "GxEPD2_1248") && ok;
+  for (uint16_t k = 0; k < sizeof(test_bitmap); k++) test_bitmap[k] = (k * 37 + 11) ^ (k >> 2);
+  ok = compareBitmaps(full_290, paged_290, panel_290, "GxEPD2_290_T94") && ok;
+  Serial.println(ok ? "all pictures equal" : "pictures differ");
+  return ok ? 0 : 1;
+}
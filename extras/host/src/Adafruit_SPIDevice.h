@@ -0,0 +1,15 @@
+// Display Library for SPI e-paper panels from Dalian Good Display and boards from Waveshare.
+// Requires HW SPI and Adafruit_GFX. Caution: the e-paper panels require 3.3V supply AND data lines!
+//
+// Host emulation: Adafruit_GFX.h includes this header of Adafruit BusIO, not used by GxEPD2.
+//
+// Author: Jean-Marc Zingg
+//
+// Version: see library.properties
+//
+// Library: https://github.com/ZinggJM/GxEPD2
+
+#ifndef _GxEPD2_Host_Adafruit_SPIDevice_H_
+#define _GxEPD2_Host_Adafruit_SPIDevice_H_
+
+#endif
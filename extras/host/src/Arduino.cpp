@@ -0,0 +1,272 @@
+// Display Library for SPI e-paper panels from Dalian Good Display and boards from Waveshare.
+// Requires HW SPI and Adafruit_GFX. Caution: the e-paper panels require 3.3V supply AND data lines!
+//
+// Host emulation: minimal Arduino core for running GxEPD2 in a Linux process.
+//
+// Author: Jean-Marc Zingg
+//
+// Version: see library.properties
+//
+// Library: https://github.com/ZinggJM/GxEPD2
+
+#include <Arduino.h>
+#include <stdarg.h>
+#include "GxEPD2_Host.h"
+
+HardwareSerial Serial;
+
+void pinMode(int16_t pin, uint8_t mode)
+{
+  GxEPD2Host.pinMode(pin, mode);
+}
+
+void digitalWrite(int16_t pin, uint8_t val)
+{
+  GxEPD2Host.digitalWrite(pin, val);
+}
+
+int digitalRead(int16_t pin)
+{
+  return GxEPD2Host.digitalRead(pin);
+}
+
+void delay(unsigned long ms)
+{
+  GxEPD2Host.advance(uint64_t(ms) * 1000000);
+}
+
+void delayMicroseconds(unsigned int us)
+{
+  GxEPD2Host.advance(uint64_t(us) * 1000);
+}
+
+unsigned long millis()
+{
+  return GxEPD2Host.nanos() / 1000000;
+}
+
+unsigned long micros()
+{
+  return GxEPD2Host.nanos() / 1000;
+}
+
+void yield()
+{
+}
+
+int digitalPinToInterrupt(int16_t pin)
+{
+  return pin;
+}
+
+// interrupt number is the pin, edges of BUSY pins only
+void attachInterrupt(int irq, void (*isr)(), int mode)
+{
+  GxEPD2Host.attachInterrupt(irq, isr, mode);
+}
+
+void detachInterrupt(int irq)
+{
+  GxEPD2Host.detachInterrupt(irq);
+}
+
+void noInterrupts()
+{
+}
+
+void interrupts()
+{
+}
+
+// String
+
+String::String(double value, unsigned char decimals)
+{
+  char buf[64];
+  snprintf(buf, sizeof(buf), "%.*f", decimals, value);
+  _s = buf;
+}
+
+std::string String::_format(long value, unsigned char base)
+{
+  if ((base == 10) && (value < 0)) return std::string("-") + _format((unsigned long)(-value), base);
+  return _format((unsigned long)(value), base);
+}
+
+std::string String::_format(unsigned long value, unsigned char base)
+{
+  if (base < 2) base = 10;
+  char buf[8 * sizeof(long) + 1];
+  char* p = &buf[sizeof(buf) - 1];
+  *p = 0;
+  do
+  {
+    char c = value % base;
+    value /= base;
+    *--p = c < 10 ? c + '0' : c + 'A' - 10;
+  }
+  while (value);
+  return std::string(p);
+}
+
+// Print
+
+size_t Print::write(const uint8_t* buffer, size_t size)
+{
+  size_t n = 0;
+  while (size--) n += write(*buffer++);
+  return n;
+}
+
+int Print::printf(const char* format, ...)
+{
+  char buf[256];
+  va_list args;
+  va_start(args, format);
+  int len = vsnprintf(buf, sizeof(buf), format, args);
+  va_end(args);
+  if (len < 0) return len;
+  if (size_t(len) < sizeof(buf)) return write((const uint8_t*)buf, len);
+  std::string s(len + 1, 0);
+  va_start(args, format);
+  vsnprintf(&s[0], s.size(), format, args);
+  va_end(args);
+  return write((const uint8_t*)s.c_str(), len);
+}
+
+size_t Print::print(const __FlashStringHelper* s)
+{
+  return write(reinterpret_cast<const char*>(s));
+}
+
+size_t Print::print(const String& s)
+{
+  return write(s.c_str(), s.length());
+}
+
+size_t Print::print(const char s[])
+{
+  return write(s);
+}
+
+size_t Print::print(char c)
+{
+  return write(uint8_t(c));
+}
+
+size_t Print::print(unsigned char n, int base)
+{
+  return print((unsigned long) n, base);
+}
+
+size_t Print::print(int n, int base)
+{
+  return print((long) n, base);
+}
+
+size_t Print::print(unsigned int n, int base)
+{
+  return print((unsigned long) n, base);
+}
+
+size_t Print::print(long n, int base)
+{
+  if (base == 0) return write(uint8_t(n));
+  if ((base == 10) && (n < 0)) return write('-') + _printNumber(-n, 10);
+  return _printNumber(n, base);
+}
+
+size_t Print::print(unsigned long n, int base)
+{
+  if (base == 0) return write(uint8_t(n));
+  return _printNumber(n, base);
+}
+
+size_t Print::print(double n, int digits)
+{
+  return printf("%.*f", digits, n);
+}
+
+size_t Print::println(const __FlashStringHelper* s)
+{
+  return print(s) + println();
+}
+
+size_t Print::println(const String& s)
+{
+  return print(s) + println();
+}
+
+size_t Print::println(const char s[])
+{
+  return print(s) + println();
+}
+
+size_t Print::println(char c)
+{
+  return print(c) + println();
+}
+
+size_t Print::println(unsigned char n, int base)
+{
+  return print(n, base) + println();
+}
+
+size_t Print::println(int n, int base)
+{
+  return print(n, base) + println();
+}
+
+size_t Print::println(unsigned int n, int base)
+{
+  return print(n, base) + println();
+}
+
+size_t Print::println(long n, int base)
+{
+  return print(n, base) + println();
+}
+
+size_t Print::println(unsigned long n, int base)
+{
+  return print(n, base) + println();
+}
+
+size_t Print::println(double n, int digits)
+{
+  return print(n, digits) + println();
+}
+
+size_t Print::println(void)
+{
+  return write("\r\n");
+}
+
+size_t Print::_printNumber(unsigned long n, uint8_t base)
+{
+  return print(String(n, base));
+}
+
+// Serial goes to stdout
+
+void HardwareSerial::begin(unsigned long baud)
+{
+  (void) baud;
+}
+
+size_t HardwareSerial::write(uint8_t c)
+{
+  if (c == '\r') return 1; // keep output readable on the host
+  return fputc(c, stdout) == EOF ? 0 : 1;
+}
+
+size_t HardwareSerial::write(const uint8_t* buffer, size_t size)
+{
+  for (size_t i = 0; i < size; i++) write(buffer[i]);
+  return size;
+}
+
+void HardwareSerial::flush()
+{
+  fflush(stdout);
+}
@@ -0,0 +1,109 @@
+// Display Library for SPI e-paper panels from Dalian Good Display and boards from Waveshare.
+// Requires HW SPI and Adafruit_GFX. Caution: the e-paper panels require 3.3V supply AND data lines!
+//
+// Host emulation: minimal Arduino core for running GxEPD2 in a Linux process.
+// Pins, delays and the clock are emulated by GxEPD2_Host, see GxEPD2_Host.h
+//
+// Author: Jean-Marc Zingg
+//
+// Version: see library.properties
+//
+// Library: https://github.com/ZinggJM/GxEPD2
+
+#ifndef _GxEPD2_Host_Arduino_H_
+#define _GxEPD2_Host_Arduino_H_
+
+#ifndef ARDUINO
+#define ARDUINO 10819
+#endif
+
+#define GxEPD2_HOST_EMULATION 1
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <inttypes.h>
+
+#include "avr/pgmspace.h"
+
+#define HIGH 0x1
+#define LOW  0x0
+
+#define INPUT 0x0
+#define OUTPUT 0x1
+#define INPUT_PULLUP 0x2
+#define INPUT_PULLDOWN 0x3
+
+#define CHANGE 1
+#define FALLING 2
+#define RISING 3
+
+#define DEC 10
+#define HEX 16
+#define OCT 8
+#define BIN 2
+
+// default SPI pins, not used by the emulation
+#define SS 5
+#define SCK 18
+#define MISO 19
+#define MOSI 23
+
+typedef bool boolean;
+typedef uint8_t byte;
+typedef unsigned int word;
+
+#ifndef __cplusplus
+#error "GxEPD2 host emulation needs C++"
+#endif
+
+#include <algorithm>
+using std::min;
+using std::max;
+
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+#define lowByte(w) ((uint8_t) ((w) & 0xff))
+#define highByte(w) ((uint8_t) ((w) >> 8))
+#define bitRead(value, bit) (((value) >> (bit)) & 0x01)
+#define _BV(bit) (1 << (bit))
+
+void pinMode(int16_t pin, uint8_t mode);
+void digitalWrite(int16_t pin, uint8_t val);
+int digitalRead(int16_t pin);
+
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+unsigned long millis();
+unsigned long micros();
+void yield();
+
+int digitalPinToInterrupt(int16_t pin);
+void attachInterrupt(int irq, void (*isr)(), int mode);
+void detachInterrupt(int irq);
+void noInterrupts();
+void interrupts();
+
+#include "WString.h"
+#include "Print.h"
+
+class HardwareSerial : public Print
+{
+  public:
+    void begin(unsigned long baud);
+    void end() {};
+    size_t write(uint8_t c);
+    size_t write(const uint8_t* buffer, size_t size);
+    using Print::write;
+    void flush();
+    operator bool()
+    {
+      return true;
+    };
+};
+
+extern HardwareSerial Serial;
+
+#endif
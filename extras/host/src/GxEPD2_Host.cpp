@@ -0,0 +1,243 @@
+// Display Library for SPI e-paper panels from Dalian Good Display and boards from Waveshare.
+// Requires HW SPI and Adafruit_GFX. Caution: the e-paper panels require 3.3V supply AND data lines!
+//
+// Host emulation: recording SPI/GPIO backend with a virtual clock, for running GxEPD2 in a Linux process.
+//
+// Author: Jean-Marc Zingg
+//
+// Version: see library.properties
+//
+// Library: https://github.com/ZinggJM/GxEPD2
+
+#include "GxEPD2_Host.h"
+
+GxEPD2_Host GxEPD2Host;
+
+bool GxEPD2_HostDevice::isBusy() const
+{
+  return GxEPD2Host.nanos() < _busy_until_ns;
+}
+
+void GxEPD2_HostDevice::_setBusy(uint32_t us)
+{
+  uint64_t until = GxEPD2Host.nanos() + uint64_t(us) * 1000;
+  if (until > _busy_until_ns) _busy_until_ns = until;
+}
+
+GxEPD2_Host::GxEPD2_Host() :
+  _now_ns(0), _stats_start_ns(0), _spi_time_ns(0), _gpio_ns(100), _transaction_ns(500), _recording(false)
+{
+  memset(_pin_level, HIGH, sizeof(_pin_level));
+  memset(&_stats, 0, sizeof(_stats));
+}
+
+void GxEPD2_Host::attach(GxEPD2_HostDevice& device)
+{
+  detach(device);
+  _devices.push_back(&device);
+}
+
+void GxEPD2_Host::detach(GxEPD2_HostDevice& device)
+{
+  for (size_t i = 0; i < _devices.size(); i++)
+  {
+    if (_devices[i] == &device)
+    {
+      _devices.erase(_devices.begin() + i);
+      return;
+    }
+  }
+}
+
+void GxEPD2_Host::pinMode(int16_t pin, uint8_t mode)
+{
+  if ((pin < 0) || (pin >= max_pins)) return;
+  if (mode == INPUT_PULLUP) _pin_level[pin] = HIGH;
+  if (mode == INPUT_PULLDOWN) _pin_level[pin] = LOW;
+}
+
+void GxEPD2_Host::digitalWrite(int16_t pin, uint8_t val)
+{
+  if ((pin < 0) || (pin >= max_pins)) return;
+  _now_ns += _gpio_ns;
+  uint8_t level = val ? HIGH : LOW;
+  uint8_t previous = _pin_level[pin];
+  _pin_level[pin] = level;
+  if (level == previous) return;
+  _record(GxEPD2_HostEvent::PinWrite, pin, level);
+  bool dc_counted = false;
+  for (size_t i = 0; i < _devices.size(); i++)
+  {
+    GxEPD2_HostDevice* device = _devices[i];
+    if (device->cs == pin)
+    {
+      if (level == LOW) _stats.cs_selects++;
+      device->select(level == LOW);
+    }
+    if ((device->dc == pin) && !dc_counted)
+    {
+      _stats.dc_toggles++;
+      dc_counted = true; // shared DC pin counts once
+    }
+    if ((device->rst == pin) && (level == HIGH)) device->reset();
+  }
+}
+
+int GxEPD2_Host::digitalRead(int16_t pin)
+{
+  if ((pin < 0) || (pin >= max_pins)) return LOW;
+  _now_ns += _gpio_ns;
+  for (size_t i = 0; i < _devices.size(); i++)
+  {
+    GxEPD2_HostDevice* device = _devices[i];
+    if (device->busy != pin) continue;
+    bool active = device->isBusy();
+    if (active && !device->_waiting)
+    {
+      device->_waiting = true;
+      device->_busy_wait_start_ns = _now_ns;
+      _stats.busy_waits++;
+      _record(GxEPD2_HostEvent::BusyStart, pin, device->busy_level);
+    }
+    else if (!active && device->_waiting)
+    {
+      device->_waiting = false;
+      _stats.busy_wait_us += (_now_ns - device->_busy_wait_start_ns) / 1000;
+      _record(GxEPD2_HostEvent::BusyEnd, pin, !device->busy_level);
+    }
+    return active ? device->busy_level : !device->busy_level;
+  }
+  return _pin_level[pin];
+}
+
+void GxEPD2_Host::attachInterrupt(int16_t pin, void (*isr)(), int mode)
+{
+  detachInterrupt(pin);
+  Interrupt irq = {pin, isr, mode, 0xFF}; // no edge on attach
+  _interrupts.push_back(irq);
+  _checkInterrupts();
+}
+
+void GxEPD2_Host::detachInterrupt(int16_t pin)
+{
+  for (size_t i = 0; i < _interrupts.size(); i++)
+  {
+    if (_interrupts[i].pin == pin)
+    {
+      _interrupts.erase(_interrupts.begin() + i);
+      return;
+    }
+  }
+}
+
+void GxEPD2_Host::_checkInterrupts()
+{
+  for (size_t i = 0; i < _interrupts.size(); i++)
+  {
+    Interrupt& irq = _interrupts[i];
+    uint8_t level = _pin_level[irq.pin];
+    for (size_t j = 0; j < _devices.size(); j++)
+    {
+      if (_devices[j]->busy == irq.pin) level = _devices[j]->isBusy() ? _devices[j]->busy_level : !_devices[j]->busy_level;
+    }
+    if (level == irq.level) continue;
+    bool edge = irq.level != 0xFF;
+    bool fire = (irq.mode == CHANGE) || ((irq.mode == RISING) && (level == HIGH)) || ((irq.mode == FALLING) && (level == LOW));
+    irq.level = level;
+    if (edge && fire && (irq.isr != 0)) irq.isr();
+  }
+}
+
+void GxEPD2_Host::beginTransaction(const SPISettings& settings)
+{
+  _now_ns += _transaction_ns;
+  _stats.transactions++;
+  _record(GxEPD2_HostEvent::BeginTransaction, -1, settings._clock / 1000);
+}
+
+void GxEPD2_Host::endTransaction()
+{
+  _now_ns += _transaction_ns;
+  _record(GxEPD2_HostEvent::EndTransaction, -1, 0);
+}
+
+uint8_t GxEPD2_Host::transfer(uint8_t value, uint32_t clock)
+{
+  uint64_t byte_ns = 8000000000ULL / (clock > 0 ? clock : 1);
+  _now_ns += byte_ns;
+  _spi_time_ns += byte_ns;
+  _stats.spi_bytes++;
+  GxEPD2_HostDevice* device = _selected();
+  if (!device) return 0xFF; // nobody drives MISO
+  bool data = (device->dc < 0) || (_pin_level[device->dc] == HIGH);
+  if (data) _stats.data_bytes++;
+  else _stats.command_bytes++;
+  _record(GxEPD2_HostEvent::SpiByte, device->cs, value | (data ? 0x100 : 0));
+  uint8_t rv = device->transfer(value, data);
+  // other devices selected at the same time get the byte too, e.g. the controllers of GxEPD2_1248; the first drives MISO
+  for (size_t i = 0; i < _devices.size(); i++)
+  {
+    GxEPD2_HostDevice* other = _devices[i];
+    if ((other == device) || (other->cs < 0) || (_pin_level[other->cs] != LOW)) continue;
+    other->transfer(value, (other->dc < 0) || (_pin_level[other->dc] == HIGH));
+  }
+  return rv;
+}
+
+void GxEPD2_Host::countRefresh(bool partial)
+{
+  if (partial) _stats.partial_refreshes++;
+  else _stats.full_refreshes++;
+  _record(GxEPD2_HostEvent::Refresh, -1, partial);
+}
+
+const GxEPD2_HostStats& GxEPD2_Host::stats()
+{
+  _stats.elapsed_us = (_now_ns - _stats_start_ns) / 1000;
+  _stats.spi_time_us = _spi_time_ns / 1000;
+  return _stats;
+}
+
+void GxEPD2_Host::resetStats()
+{
+  memset(&_stats, 0, sizeof(_stats));
+  _stats_start_ns = _now_ns;
+  _spi_time_ns = 0;
+  for (size_t i = 0; i < _devices.size(); i++)
+  {
+    if (_devices[i]->_waiting) _devices[i]->_busy_wait_start_ns = _now_ns; // count from here
+  }
+}
+
+void GxEPD2_Host::printStats(Print& out, const char* label)
+{
+  const GxEPD2_HostStats& s = stats();
+  out.printf("%-24s bytes %8" PRIu32 " (cmd %6" PRIu32 ", data %8" PRIu32 ") commands %6" PRIu32 " transactions %7" PRIu32
+             " cs %7" PRIu32 " dc %7" PRIu32 "\n", label ? label : "", s.spi_bytes, s.command_bytes, s.data_bytes,
+             s.commands, s.transactions, s.cs_selects, s.dc_toggles);
+  out.printf("%-24s refresh full %" PRIu32 " partial %" PRIu32 " power on %" PRIu32 " off %" PRIu32
+             " busy %" PRIu32 " x %" PRIu64 "us spi %" PRIu64 "us elapsed %" PRIu64 "us\n", "",
+             s.full_refreshes, s.partial_refreshes, s.power_ons, s.power_offs, s.busy_waits, s.busy_wait_us,
+             s.spi_time_us, s.elapsed_us);
+}
+
+void GxEPD2_Host::_record(GxEPD2_HostEvent::Type type, int16_t pin, uint16_t value)
+{
+  if (!_recording) return;
+  GxEPD2_HostEvent event;
+  event.time_ns = _now_ns;
+  event.type = type;
+  event.pin = pin;
+  event.value = value;
+  _events.push_back(event);
+}
+
+GxEPD2_HostDevice* GxEPD2_Host::_selected()
+{
+  for (size_t i = 0; i < _devices.size(); i++)
+  {
+    GxEPD2_HostDevice* device = _devices[i];
+    if ((device->cs < 0) || (_pin_level[device->cs] == LOW)) return device;
+  }
+  return 0;
+}
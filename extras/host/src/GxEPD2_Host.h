@@ -0,0 +1,163 @@
+// Display Library for SPI e-paper panels from Dalian Good Display and boards from Waveshare.
+// Requires HW SPI and Adafruit_GFX. Caution: the e-paper panels require 3.3V supply AND data lines!
+//
+// Host emulation: recording SPI/GPIO backend with a virtual clock, for running GxEPD2 in a Linux process.
+// Emulated devices (see GxEPD2_HostPanel.h) are attached by their pins, SPI bytes go to the selected device.
+//
+// Author: Jean-Marc Zingg
+//
+// Version: see library.properties
+//
+// Library: https://github.com/ZinggJM/GxEPD2
+
+#ifndef _GxEPD2_Host_H_
+#define _GxEPD2_Host_H_
+
+#include <Arduino.h>
+#include <SPI.h>
+#include <vector>
+
+// counters, reset with GxEPD2Host.resetStats()
+struct GxEPD2_HostStats
+{
+  uint32_t spi_bytes;         // bytes on the wire, all devices
+  uint32_t command_bytes;     // bytes sent with DC low
+  uint32_t data_bytes;        // bytes sent with DC high (or without DC)
+  uint32_t commands;          // controller commands, as decoded by the devices
+  uint32_t transactions;      // SPI beginTransaction() calls
+  uint32_t cs_selects;        // CS high to low transitions
+  uint32_t dc_toggles;        // DC level changes
+  uint32_t busy_waits;        // waits seen on an active BUSY
+  uint64_t busy_wait_us;      // time from first active to first inactive BUSY read
+  uint32_t full_refreshes;
+  uint32_t partial_refreshes;
+  uint32_t power_ons;
+  uint32_t power_offs;
+  uint64_t spi_time_us;       // time on the wire, from SPISettings clock
+  uint64_t elapsed_us;        // virtual time since resetStats()
+};
+
+// recorded events, if enabled with GxEPD2Host.record(true)
+struct GxEPD2_HostEvent
+{
+  enum Type : uint8_t {PinWrite, SpiByte, BeginTransaction, EndTransaction, BusyStart, BusyEnd, Refresh};
+  uint64_t time_ns;
+  Type type;
+  int16_t pin;     // pin, or CS pin of the selected device for SpiByte
+  uint16_t value;  // pin level, byte value (bit 8 set for data), clock in kHz, refresh partial
+};
+
+class GxEPD2_HostDevice
+{
+  public:
+    GxEPD2_HostDevice(int16_t cs, int16_t dc, int16_t rst, int16_t busy, int16_t busy_level) :
+      cs(cs), dc(dc), rst(rst), busy(busy), busy_level(busy_level), _busy_until_ns(0), _busy_wait_start_ns(0), _waiting(false) {};
+    virtual ~GxEPD2_HostDevice() {};
+    // CS edge, selected is true for CS low
+    virtual void select(bool selected)
+    {
+      (void) selected;
+    };
+    // one byte on the wire, data is the DC level; returns the byte on MISO
+    virtual uint8_t transfer(uint8_t value, bool data) = 0;
+    // RST rising edge after low
+    virtual void reset() {};
+    bool isBusy() const;
+    const int16_t cs, dc, rst, busy, busy_level;
+  protected:
+    void _setBusy(uint32_t us);
+  private:
+    friend class GxEPD2_Host;
+    uint64_t _busy_until_ns;
+    uint64_t _busy_wait_start_ns;
+    bool _waiting;
+};
+
+class GxEPD2_Host
+{
+  public:
+    GxEPD2_Host();
+    void attach(GxEPD2_HostDevice& device);
+    void detach(GxEPD2_HostDevice& device);
+    // virtual clock
+    uint64_t nanos() const
+    {
+      return _now_ns;
+    };
+    void advance(uint64_t ns)
+    {
+      _now_ns += ns;
+      if (!_interrupts.empty()) _checkInterrupts();
+    };
+    // emulated cost of pin access and transaction begin/end, in ns
+    void setOverheads(uint32_t gpio_ns, uint32_t transaction_ns)
+    {
+      _gpio_ns = gpio_ns;
+      _transaction_ns = transaction_ns;
+    };
+    // GPIO
+    void pinMode(int16_t pin, uint8_t mode);
+    void digitalWrite(int16_t pin, uint8_t val);
+    int digitalRead(int16_t pin);
+    // interrupts on BUSY pins of attached devices, checked when the virtual clock advances, e.g. in delay()
+    void attachInterrupt(int16_t pin, void (*isr)(), int mode);
+    void detachInterrupt(int16_t pin);
+    // SPI
+    void beginTransaction(const SPISettings& settings);
+    void endTransaction();
+    uint8_t transfer(uint8_t value, uint32_t clock);
+    // statistics, reported by the devices
+    void countCommand()
+    {
+      _stats.commands++;
+    };
+    void countRefresh(bool partial);
+    void countPower(bool on)
+    {
+      if (on) _stats.power_ons++;
+      else _stats.power_offs++;
+    };
+    const GxEPD2_HostStats& stats();
+    void resetStats();
+    void printStats(Print& out, const char* label);
+    // recording
+    void record(bool enable)
+    {
+      _recording = enable;
+    };
+    const std::vector<GxEPD2_HostEvent>& events() const
+    {
+      return _events;
+    };
+    void clearEvents()
+    {
+      _events.clear();
+    };
+  private:
+    static const int16_t max_pins = 256;
+    void _record(GxEPD2_HostEvent::Type type, int16_t pin, uint16_t value);
+    GxEPD2_HostDevice* _selected();
+    void _checkInterrupts();
+    struct Interrupt
+    {
+      int16_t pin;
+      void (*isr)();
+      int mode;
+      uint8_t level;
+    };
+    std::vector<Interrupt> _interrupts;
+    std::vector<GxEPD2_HostDevice*> _devices;
+    uint8_t _pin_level[max_pins];
+    uint64_t _now_ns;
+    uint64_t _stats_start_ns;
+    uint64_t _spi_time_ns;
+    uint32_t _gpio_ns;
+    uint32_t _transaction_ns;
+    GxEPD2_HostStats _stats;
+    bool _recording;
+    std::vector<GxEPD2_HostEvent> _events;
+};
+
+extern GxEPD2_Host GxEPD2Host;
+
+#endif
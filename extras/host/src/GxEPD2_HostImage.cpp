@@ -0,0 +1,160 @@
+// Display Library for SPI e-paper panels from Dalian Good Display and boards from Waveshare.
+// Requires HW SPI and Adafruit_GFX. Caution: the e-paper panels require 3.3V supply AND data lines!
+//
+// Host emulation: writes images as PBM, PGM, PPM or PNG, without external libraries.
+//
+// Author: Jean-Marc Zingg
+//
+// Version: see library.properties
+//
+// Library: https://github.com/ZinggJM/GxEPD2
+
+#include "GxEPD2_HostImage.h"
+#include <string.h>
+#include <vector>
+
+bool GxEPD2_HostImage::write(const char* path, const uint32_t* pixels, uint16_t width, uint16_t height)
+{
+  const char* ext = strrchr(path, '.');
+  Format format = PNG;
+  if (ext && (strcmp(ext, ".pbm") == 0)) format = PBM;
+  else if (ext && (strcmp(ext, ".pgm") == 0)) format = PGM;
+  else if (ext && (strcmp(ext, ".ppm") == 0)) format = PPM;
+  return write(path, pixels, width, height, format);
+}
+
+bool GxEPD2_HostImage::write(const char* path, const uint32_t* pixels, uint16_t width, uint16_t height, Format format)
+{
+  FILE* f = fopen(path, "wb");
+  if (!f) return false;
+  bool ok = true;
+  switch (format)
+  {
+    case PBM:
+      {
+        fprintf(f, "P4\n%u %u\n", width, height);
+        std::vector<uint8_t> row((width + 7) / 8);
+        for (uint16_t y = 0; y < height; y++)
+        {
+          memset(row.data(), 0, row.size());
+          for (uint16_t x = 0; x < width; x++)
+          {
+            if (_luminance(pixels[uint32_t(y) * width + x]) < 128) row[x / 8] |= 0x80 >> (x % 8); // 1 is black
+          }
+          ok = ok && (fwrite(row.data(), 1, row.size(), f) == row.size());
+        }
+      }
+      break;
+    case PGM:
+    case PPM:
+      {
+        uint8_t channels = format == PGM ? 1 : 3;
+        fprintf(f, "P%c\n%u %u\n255\n", format == PGM ? '5' : '6', width, height);
+        std::vector<uint8_t> row(uint32_t(width) * channels);
+        for (uint16_t y = 0; y < height; y++)
+        {
+          for (uint16_t x = 0; x < width; x++)
+          {
+            uint32_t rgb = pixels[uint32_t(y) * width + x];
+            if (channels == 1) row[x] = _luminance(rgb);
+            else
+            {
+              row[3 * x] = rgb >> 16;
+              row[3 * x + 1] = rgb >> 8;
+              row[3 * x + 2] = rgb;
+            }
+          }
+          ok = ok && (fwrite(row.data(), 1, row.size(), f) == row.size());
+        }
+      }
+      break;
+    case PNG:
+      ok = _writePNG(f, pixels, width, height);
+      break;
+  }
+  return (fclose(f) == 0) && ok;
+}
+
+// RGB 8 bit, deflate with stored blocks only, no zlib needed
+bool GxEPD2_HostImage::_writePNG(FILE* f, const uint32_t* pixels, uint16_t width, uint16_t height)
+{
+  static const uint8_t signature[] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+  fwrite(signature, 1, sizeof(signature), f);
+  // 32 bit big endian width and height, 8 bit depth, RGB
+  uint8_t ihdr[13] = {0, 0, uint8_t(width >> 8), uint8_t(width), 0, 0, uint8_t(height >> 8), uint8_t(height), 8, 2, 0, 0, 0};
+  _chunk(f, "IHDR", ihdr, sizeof(ihdr));
+  std::vector<uint8_t> raw; // filter byte 0 and RGB for each row
+  raw.reserve(uint32_t(height) * (1 + 3 * uint32_t(width)));
+  for (uint16_t y = 0; y < height; y++)
+  {
+    raw.push_back(0);
+    for (uint16_t x = 0; x < width; x++)
+    {
+      uint32_t rgb = pixels[uint32_t(y) * width + x];
+      raw.push_back(rgb >> 16);
+      raw.push_back(rgb >> 8);
+      raw.push_back(rgb);
+    }
+  }
+  std::vector<uint8_t> z;
+  z.push_back(0x78); // deflate, 32k window
+  z.push_back(0x01);
+  uint32_t a = 1, b = 0; // adler32
+  for (uint32_t i = 0; i < raw.size(); i++)
+  {
+    a = (a + raw[i]) % 65521;
+    b = (b + a) % 65521;
+  }
+  uint32_t pos = 0;
+  do
+  {
+    uint32_t n = raw.size() - pos < 65535 ? raw.size() - pos : 65535;
+    z.push_back(pos + n == raw.size() ? 1 : 0); // final block flag, stored
+    z.push_back(n & 0xFF);
+    z.push_back(n >> 8);
+    z.push_back(~n & 0xFF);
+    z.push_back((~n >> 8) & 0xFF);
+    z.insert(z.end(), raw.begin() + pos, raw.begin() + pos + n);
+    pos += n;
+  }
+  while (pos < raw.size());
+  uint32_t adler = (b << 16) | a;
+  for (int8_t i = 3; i >= 0; i--) z.push_back(adler >> (8 * i));
+  _chunk(f, "IDAT", z.data(), z.size());
+  _chunk(f, "IEND", 0, 0);
+  return !ferror(f);
+}
+
+void GxEPD2_HostImage::_chunk(FILE* f, const char* type, const uint8_t* data, uint32_t length)
+{
+  uint8_t header[8] = {uint8_t(length >> 24), uint8_t(length >> 16), uint8_t(length >> 8), uint8_t(length),
+                       uint8_t(type[0]), uint8_t(type[1]), uint8_t(type[2]), uint8_t(type[3])
+                      };
+  fwrite(header, 1, sizeof(header), f);
+  if (length > 0) fwrite(data, 1, length, f);
+  uint32_t crc = _crc32(0xFFFFFFFF, &header[4], 4);
+  crc = _crc32(crc, data, length) ^ 0xFFFFFFFF;
+  uint8_t trailer[4] = {uint8_t(crc >> 24), uint8_t(crc >> 16), uint8_t(crc >> 8), uint8_t(crc)};
+  fwrite(trailer, 1, sizeof(trailer), f);
+}
+
+uint32_t GxEPD2_HostImage::_crc32(uint32_t crc, const uint8_t* data, uint32_t length)
+{
+  static uint32_t table[256];
+  if (table[1] == 0)
+  {
+    for (uint32_t n = 0; n < 256; n++)
+    {
+      uint32_t c = n;
+      for (uint8_t k = 0; k < 8; k++) c = c & 1 ? 0xEDB88320 ^ (c >> 1) : c >> 1;
+      table[n] = c;
+    }
+  }
+  for (uint32_t i = 0; i < length; i++) crc = table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+  return crc;
+}
+
+uint8_t GxEPD2_HostImage::_luminance(uint32_t rgb)
+{
+  return (uint16_t(77) * ((rgb >> 16) & 0xFF) + uint16_t(150) * ((rgb >> 8) & 0xFF) + uint16_t(29) * (rgb & 0xFF)) >> 8;
+}
@@ -0,0 +1,33 @@
+// Display Library for SPI e-paper panels from Dalian Good Display and boards from Waveshare.
+// Requires HW SPI and Adafruit_GFX. Caution: the e-paper panels require 3.3V supply AND data lines!
+//
+// Host emulation: writes images as PBM, PGM, PPM or PNG, without external libraries.
+//
+// Author: Jean-Marc Zingg
+//
+// Version: see library.properties
+//
+// Library: https://github.com/ZinggJM/GxEPD2
+
+#ifndef _GxEPD2_HostImage_H_
+#define _GxEPD2_HostImage_H_
+
+#include <stdint.h>
+#include <stdio.h>
+
+class GxEPD2_HostImage
+{
+  public:
+    enum Format {PBM, PGM, PPM, PNG};
+    // pixels are 0xRRGGBB, row by row; PBM is black below half luminance
+    static bool write(const char* path, const uint32_t* pixels, uint16_t width, uint16_t height, Format format);
+    // format by extension of path, PNG if unknown
+    static bool write(const char* path, const uint32_t* pixels, uint16_t width, uint16_t height);
+  private:
+    static bool _writePNG(FILE* f, const uint32_t* pixels, uint16_t width, uint16_t height);
+    static void _chunk(FILE* f, const char* type, const uint8_t* data, uint32_t length);
+    static uint32_t _crc32(uint32_t crc, const uint8_t* data, uint32_t length);
+    static uint8_t _luminance(uint32_t rgb);
+};
+
+#endif
@@ -0,0 +1,135 @@
+// Display Library for SPI e-paper panels from Dalian Good Display and boards from Waveshare.
+// Requires HW SPI and Adafruit_GFX. Caution: the e-paper panels require 3.3V supply AND data lines!
+//
+// Host emulation: writes images in the native format of GxEPD2_NativeReader, for the tools.
+//
+// Author: Jean-Marc Zingg
+//
+// Version: see library.properties
+//
+// Library: https://github.com/ZinggJM/GxEPD2
+
+#include "GxEPD2_HostNative.h"
+#include <GxEPD2_NativeReader.h>
+#include <stdio.h>
+#include <string.h>
+#include <ctype.h>
+#include <string>
+
+uint8_t GxEPD2_HostNative::bits(uint8_t format)
+{
+  return format == GxEPD2_NativeReader::Format7C ? 4 : format == GxEPD2_NativeReader::Format4C ? 2 : 1;
+}
+
+uint8_t GxEPD2_HostNative::planes(uint8_t format)
+{
+  return format == GxEPD2_NativeReader::Format3C ? 2 : 1;
+}
+
+uint16_t GxEPD2_HostNative::bytesPerRow(uint8_t format, uint16_t width)
+{
+  return (uint32_t(width) * bits(format) + 7) / 8;
+}
+
+uint16_t GxEPD2_HostNative::encode(std::vector<uint8_t>& out, uint8_t format, uint16_t width, uint16_t height,
+                                   const std::vector<uint8_t>& pixels, uint16_t band_height, bool raw)
+{
+  uint16_t bytes_per_row = bytesPerRow(format, width);
+  // header, band flags, row index, data
+  uint16_t bands = (height + band_height - 1) / band_height;
+  uint32_t band_offset = 24, index_offset = band_offset + bands;
+  uint32_t rows = uint32_t(height) * planes(format);
+  out.assign(index_offset + 4 * (rows + 1), 0);
+  memcpy(&out[0], "GxNI", 4);
+  out[4] = 1;
+  out[5] = format;
+  _put16(out, 6, width);
+  _put16(out, 8, height);
+  _put16(out, 10, band_height);
+  _put16(out, 12, bytes_per_row);
+  out[14] = planes(format);
+  _put32(out, 16, band_offset);
+  _put32(out, 20, index_offset);
+  uint16_t packed_bands = 0;
+  for (uint16_t band = 0; band < bands; band++)
+  {
+    uint32_t first = uint32_t(band) * band_height * planes(format);
+    uint32_t last = uint32_t(band + 1) * band_height * planes(format) < rows ? uint32_t(band + 1) * band_height * planes(format) : rows;
+    std::vector<uint8_t> packed;
+    std::vector<uint32_t> offsets;
+    for (uint32_t r = first; r < last; r++)
+    {
+      offsets.push_back(packed.size());
+      packBits(&pixels[r * bytes_per_row], bytes_per_row, packed);
+    }
+    bool pack = !raw && (packed.size() < (last - first) * bytes_per_row);
+    out[band_offset + band] = pack ? 0x01 : 0x00;
+    packed_bands += pack;
+    for (uint32_t r = first; r < last; r++)
+    {
+      _put32(out, index_offset + 4 * r, out.size() + (pack ? offsets[r - first] : (r - first) * bytes_per_row));
+    }
+    if (pack) out.insert(out.end(), packed.begin(), packed.end());
+    else out.insert(out.end(), pixels.begin() + first * bytes_per_row, pixels.begin() + last * bytes_per_row);
+  }
+  _put32(out, index_offset + 4 * rows, out.size());
+  return packed_bands;
+}
+
+bool GxEPD2_HostNative::write(const char* path, const std::vector<uint8_t>& data)
+{
+  FILE* f = fopen(path, "wb");
+  if (!f) return false;
+  size_t len = strlen(path);
+  if ((len > 2) && (strcmp(path + len - 2, ".h") == 0))
+  {
+    std::string name(path);
+    size_t slash = name.find_last_of('/');
+    if (slash != std::string::npos) name = name.substr(slash + 1);
+    name = name.substr(0, name.size() - 2);
+    for (size_t i = 0; i < name.size(); i++) if (!isalnum(name[i])) name[i] = '_';
+    fprintf(f, "// GxEPD2 native image, see GxEPD2_NativeReader.h\n\n");
+    fprintf(f, "const unsigned char %s[] PROGMEM =\n{", name.c_str());
+    for (size_t i = 0; i < data.size(); i++) fprintf(f, "%s0x%02X%s", i % 16 ? " " : "\n  ", data[i], i + 1 < data.size() ? "," : "");
+    fprintf(f, "\n};\n");
+  }
+  else fwrite(data.data(), 1, data.size(), f);
+  return fclose(f) == 0;
+}
+
+void GxEPD2_HostNative::packBits(const uint8_t* data, uint32_t n, std::vector<uint8_t>& out)
+{
+  uint32_t i = 0;
+  while (i < n)
+  {
+    uint32_t run = 1;
+    while ((i + run < n) && (run < 128) && (data[i + run] == data[i])) run++;
+    if (run >= 3)
+    {
+      out.push_back(257 - run);
+      out.push_back(data[i]);
+      i += run;
+      continue;
+    }
+    uint32_t start = i, count = 0;
+    while ((i < n) && (count < 128))
+    {
+      if ((i + 2 < n) && (data[i] == data[i + 1]) && (data[i] == data[i + 2])) break; // a run follows
+      i++;
+      count++;
+    }
+    out.push_back(count - 1);
+    out.insert(out.end(), data + start, data + i);
+  }
+}
+
+void GxEPD2_HostNative::_put16(std::vector<uint8_t>& v, uint32_t position, uint16_t value)
+{
+  v[position] = value;
+  v[position + 1] = value >> 8;
+}
+
+void GxEPD2_HostNative::_put32(std::vector<uint8_t>& v, uint32_t position, uint32_t value)
+{
+  for (uint8_t i = 0; i < 4; i++) v[position + i] = value >> (8 * i);
+}
@@ -0,0 +1,38 @@
+// Display Library for SPI e-paper panels from Dalian Good Display and boards from Waveshare.
+// Requires HW SPI and Adafruit_GFX. Caution: the e-paper panels require 3.3V supply AND data lines!
+//
+// Host emulation: writes images in the native format of GxEPD2_NativeReader, for the tools.
+//
+// Author: Jean-Marc Zingg
+//
+// Version: see library.properties
+//
+// Library: https://github.com/ZinggJM/GxEPD2
+
+#ifndef _GxEPD2_HostNative_H_
+#define _GxEPD2_HostNative_H_
+
+#include <stdint.h>
+#include <vector>
+
+class GxEPD2_HostNative
+{
+  public:
+    // bits per pixel and planes of a GxEPD2_NativeReader::Format
+    static uint8_t bits(uint8_t format);
+    static uint8_t planes(uint8_t format);
+    static uint16_t bytesPerRow(uint8_t format, uint16_t width);
+    // native image from pixels, the planes of all rows, row by row and plane by plane, padded to bytes with white;
+    // each band of band_height rows is PackBits compressed if it gets smaller, unless raw; returns the bands compressed
+    static uint16_t encode(std::vector<uint8_t>& out, uint8_t format, uint16_t width, uint16_t height,
+                           const std::vector<uint8_t>& pixels, uint16_t band_height, bool raw);
+    // writes data to path, as PROGMEM array for GxEPD2_MemorySource named as the file if path ends in .h
+    static bool write(const char* path, const std::vector<uint8_t>& data);
+    // header n < 128: n + 1 literal bytes follow, n > 128: the next byte repeated 257 - n times
+    static void packBits(const uint8_t* data, uint32_t n, std::vector<uint8_t>& out);
+  private:
+    static void _put16(std::vector<uint8_t>& v, uint32_t position, uint16_t value);
+    static void _put32(std::vector<uint8_t>& v, uint32_t position, uint32_t value);
+};
+
+#endif
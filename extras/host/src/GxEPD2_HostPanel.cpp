@@ -0,0 +1,780 @@
+// Display Library for SPI e-paper panels from Dalian Good Display and boards from Waveshare.
+// Requires HW SPI and Adafruit_GFX. Caution: the e-paper panels require 3.3V supply AND data lines!
+//
+// Host emulation: controller families as seen on the SPI wires, commands, BUSY behaviour and display RAM.
+//
+// Author: Jean-Marc Zingg
+//
+// Version: see library.properties
+//
+// Library: https://github.com/ZinggJM/GxEPD2
+
+#include "GxEPD2_HostPanel.h"
+#include "GxEPD2_HostImage.h"
+
+// short BUSY for commands that only load settings, ms
+#define GxEPD2_HOST_LOAD_TIME 2
+
+GxEPD2_HostPanel::GxEPD2_HostPanel(const Config& config, int16_t busy_level) :
+  GxEPD2_HostDevice(config.cs, config.dc, config.rst, config.busy, busy_level), cfg(config),
+  _cmd(0), _index(0), _power_is_on(false), _hibernating(false), _trace_digits(2),
+  _trace(0), _trace_pending(false), _trace_time_ns(0), _trace_cmd(0), _trace_count(0)
+{
+}
+
+uint8_t GxEPD2_HostPanel::transfer(uint8_t value, bool data)
+{
+  if (_hibernating) return 0xFF; // deep sleep, only reset wakes up
+  if (!data)
+  {
+    GxEPD2Host.countCommand();
+    _traceCommand(value);
+    _commandDone();
+    _cmd = value;
+    _index = 0;
+    _command(value);
+    return 0xFF;
+  }
+  _traceData(value);
+  _data(value);
+  _index++;
+  return _read();
+}
+
+void GxEPD2_HostPanel::reset()
+{
+  _traceEvent("reset", 0);
+  _cmd = 0;
+  _index = 0;
+  _power_is_on = false;
+  _hibernating = false;
+}
+
+void GxEPD2_HostPanel::_refresh(bool partial)
+{
+  _busyFor(_startRefresh(partial));
+}
+
+// counts and shows the refresh, returns its time in ms
+uint32_t GxEPD2_HostPanel::_startRefresh(bool partial)
+{
+  uint32_t ms = partial ? cfg.partial_refresh_time : cfg.full_refresh_time;
+  GxEPD2Host.countRefresh(partial);
+  _traceEvent(partial ? "partial refresh" : "full refresh", ms);
+  _updateScreen(partial);
+  return ms;
+}
+
+uint32_t GxEPD2_HostPanel::checksum(Layer layer) const
+{
+  uint32_t hash = 2166136261UL; // FNV-1a
+  for (uint16_t y = 0; y < cfg.height; y++)
+  {
+    for (uint16_t x = 0; x < cfg.width; x++)
+    {
+      uint32_t rgb = pixel(x, y, layer);
+      for (uint8_t i = 0; i < 3; i++)
+      {
+        hash = (hash ^ ((rgb >> (8 * i)) & 0xFF)) * 16777619UL;
+      }
+    }
+  }
+  return hash;
+}
+
+bool GxEPD2_HostPanel::writeImage(const char* path, Layer layer) const
+{
+  std::vector<uint32_t> rgb(uint32_t(cfg.width) * cfg.height);
+  for (uint16_t y = 0; y < cfg.height; y++)
+  {
+    for (uint16_t x = 0; x < cfg.width; x++)
+    {
+      rgb[uint32_t(y) * cfg.width + x] = pixel(x, y, layer);
+    }
+  }
+  return GxEPD2_HostImage::write(path, rgb.data(), cfg.width, cfg.height);
+}
+
+void GxEPD2_HostPanel::Plane::copy(const Plane& from, uint16_t xbs, uint16_t xbe, uint16_t ys, uint16_t ye)
+{
+  if (xbe >= width_bytes) xbe = width_bytes - 1;
+  if (ye >= height) ye = height - 1;
+  for (uint16_t y = ys; y <= ye; y++)
+  {
+    for (uint16_t xb = xbs; xb <= xbe; xb++)
+    {
+      bytes[uint32_t(y) * width_bytes + xb] = from.bytes[uint32_t(y) * width_bytes + xb];
+    }
+  }
+}
+
+void GxEPD2_HostPanel::_powerOn()
+{
+  if (!_power_is_on)
+  {
+    GxEPD2Host.countPower(true);
+    _traceEvent("power on", cfg.power_on_time);
+    _busyFor(cfg.power_on_time);
+  }
+  _power_is_on = true;
+}
+
+void GxEPD2_HostPanel::_powerOff()
+{
+  if (_power_is_on)
+  {
+    GxEPD2Host.countPower(false);
+    _traceEvent("power off", cfg.power_off_time);
+    _busyFor(cfg.power_off_time);
+  }
+  _power_is_on = false;
+}
+
+void GxEPD2_HostPanel::_busyFor(uint32_t ms)
+{
+  _setBusy(ms * 1000);
+}
+
+void GxEPD2_HostPanel::_traceCommand(uint16_t c)
+{
+  if (!_trace) return;
+  flushTrace();
+  _trace_pending = true;
+  _trace_time_ns = GxEPD2Host.nanos();
+  _trace_cmd = c;
+  _trace_count = 0;
+}
+
+void GxEPD2_HostPanel::_traceData(uint16_t d)
+{
+  if (!_trace || !_trace_pending) return;
+  if (_trace_count < trace_max_data) _trace_data[_trace_count] = d;
+  _trace_count++;
+}
+
+void GxEPD2_HostPanel::_traceEvent(const char* event, uint32_t ms)
+{
+  if (!_trace) return;
+  flushTrace();
+  _trace->printf("%10.3f ms  %s", double(GxEPD2Host.nanos()) / 1000000, event);
+  if (ms > 0) _trace->printf(", busy %" PRIu32 " ms", ms);
+  _trace->println();
+}
+
+void GxEPD2_HostPanel::flushTrace()
+{
+  if (!_trace || !_trace_pending) return;
+  _trace_pending = false;
+  _trace->printf("%10.3f ms  0x%0*X", double(_trace_time_ns) / 1000000, _trace_digits, _trace_cmd);
+  if (_trace_count > 0)
+  {
+    _trace->printf(" [%" PRIu32 "]", _trace_count);
+    uint32_t n = _trace_count < trace_max_data ? _trace_count : trace_max_data;
+    for (uint32_t i = 0; i < n; i++) _trace->printf(" %0*X", _trace_digits, _trace_data[i]);
+    if (_trace_count > n) _trace->print(" ...");
+  }
+  _trace->println();
+}
+
+
+GxEPD2_HostSSD16xx::GxEPD2_HostSSD16xx(const Config& config) : GxEPD2_HostPanel(config, HIGH),
+  _ram{Plane(config.width, config.height), Plane(config.width, config.height)},
+  _screen{Plane(config.width, config.height), Plane(config.width, config.height)}
+{
+  reset();
+}
+
+void GxEPD2_HostSSD16xx::reset()
+{
+  GxEPD2_HostPanel::reset();
+  _entry_mode = 0x03;
+  _xs = _xc = 0;
+  _xe = _ram[0].width_bytes - 1;
+  _ys = _yc = 0;
+  _ye = cfg.height - 1;
+  _ctrl2 = 0;
+  _lut_hash = 0;
+  _lut_reference = 0;
+  _lut_reference_valid = false;
+  _partial_lut = false;
+}
+
+uint32_t GxEPD2_HostSSD16xx::pixel(uint16_t x, uint16_t y, Layer layer) const
+{
+  switch (layer)
+  {
+    case Current:
+      return _ram[0].bit(x, y) ? 0xFFFFFF : 0x000000;
+    case Previous:
+      return _ram[1].bit(x, y) ? 0xFFFFFF : 0x000000;
+    default:
+      if (cfg.has_color && _screen[1].bit(x, y)) return 0xFF0000;
+      return _screen[0].bit(x, y) ? 0xFFFFFF : 0x000000;
+  }
+}
+
+void GxEPD2_HostSSD16xx::_command(uint8_t c)
+{
+  switch (c)
+  {
+    case 0x12: // SW reset, RAM is kept
+      _ctrl2 = 0;
+      _entry_mode = 0x03;
+      _xs = _xc = 0;
+      _xe = _ram[0].width_bytes - 1;
+      _ys = _yc = 0;
+      _ye = cfg.height - 1;
+      _power_is_on = false;
+      _busyFor(GxEPD2_HOST_LOAD_TIME);
+      break;
+    case 0x20: // master activation
+      _activate();
+      break;
+    case 0x32: // write LUT register
+      _lut_hash = 2166136261UL; // FNV-1a
+      break;
+  }
+}
+
+void GxEPD2_HostSSD16xx::_data(uint8_t d)
+{
+  if (_index < sizeof(_params)) _params[_index] = d;
+  switch (_cmd)
+  {
+    case 0x10: // deep sleep mode
+      if (d & 0x03) _hibernating = true;
+      _power_is_on = false;
+      break;
+    case 0x11: // data entry mode
+      if (_index == 0) _entry_mode = d & 0x07;
+      break;
+    case 0x22: // display update control 2
+      if (_index == 0) _ctrl2 = d;
+      break;
+    case 0x24: // write b/w RAM
+    case 0x26: // write red RAM
+      _writeRam(d);
+      break;
+    case 0x32:
+      _lut_hash = (_lut_hash ^ d) * 16777619UL;
+      break;
+  }
+}
+
+// the number of parameters tells byte or pixel addressing, known when the next command starts
+void GxEPD2_HostSSD16xx::_commandDone()
+{
+  switch (_cmd)
+  {
+    case 0x32: // the first LUT after reset is taken as the full refresh LUT, any other one as partial refresh LUT
+      if (!_lut_reference_valid)
+      {
+        _lut_reference = _lut_hash;
+        _lut_reference_valid = true;
+      }
+      _partial_lut = (_lut_hash != _lut_reference);
+      break;
+    case 0x44: // set RAM x address start/end
+      if (_index >= 4)
+      {
+        _xs = (_params[0] | (_params[1] << 8)) / 8;
+        _xe = (_params[2] | (_params[3] << 8)) / 8;
+      }
+      else if (_index >= 2)
+      {
+        _xs = _params[0];
+        _xe = _params[1];
+      }
+      break;
+    case 0x45: // set RAM y address start/end
+      if (_index >= 4)
+      {
+        _ys = _params[0] | (_params[1] << 8);
+        _ye = _params[2] | (_params[3] << 8);
+      }
+      else if (_index >= 2)
+      {
+        _ys = _params[0];
+        _ye = _params[1];
+      }
+      break;
+    case 0x4E: // set RAM x address counter
+      if (_index >= 2) _xc = (_params[0] | (_params[1] << 8)) / 8;
+      else if (_index == 1) _xc = _params[0];
+      break;
+    case 0x4F: // set RAM y address counter
+      if (_index >= 2) _yc = _params[0] | (_params[1] << 8);
+      else if (_index == 1) _yc = _params[0];
+      break;
+  }
+}
+
+void GxEPD2_HostSSD16xx::_updateScreen(bool partial)
+{
+  (void) partial; // the whole RAM is shown
+  _screen[0] = _ram[0];
+  _screen[1] = _ram[1];
+}
+
+void GxEPD2_HostSSD16xx::_activate()
+{
+  if (_ctrl2 & 0x04) // display
+  {
+    _power_is_on = true;
+    _refresh((_ctrl2 & 0x08) || _partial_lut);
+    _power_is_on = !(_ctrl2 & 0x02); // disable analog at end of sequence
+  }
+  else if (_ctrl2 & 0x02) _powerOff(); // disable analog
+  else if (_ctrl2 & 0x40) _powerOn(); // enable analog
+  else _busyFor(GxEPD2_HOST_LOAD_TIME); // load temperature and or LUT
+}
+
+// address counters wrap inside the window, as set by data entry mode
+void GxEPD2_HostSSD16xx::_writeRam(uint8_t value)
+{
+  _ram[_cmd == 0x24 ? 0 : 1].write(_xc, _yc, value);
+  int8_t dx = _entry_mode & 0x01 ? 1 : -1;
+  int8_t dy = _entry_mode & 0x02 ? 1 : -1;
+  if (!(_entry_mode & 0x04)) // x first
+  {
+    if (_xc != _xe)
+    {
+      _xc += dx;
+      return;
+    }
+    _xc = _xs;
+    _yc = _yc != _ye ? _yc + dy : _ys;
+  }
+  else
+  {
+    if (_yc != _ye)
+    {
+      _yc += dy;
+      return;
+    }
+    _yc = _ys;
+    _xc = _xc != _xe ? _xc + dx : _xs;
+  }
+}
+
+GxEPD2_HostUC81xx::GxEPD2_HostUC81xx(const Config& config) : GxEPD2_HostPanel(config, LOW),
+  _ram{Plane(config.width, config.height), Plane(config.width, config.height)},
+  _screen{Plane(config.width, config.height), Plane(config.width, config.height)}
+{
+  reset();
+}
+
+void GxEPD2_HostUC81xx::reset()
+{
+  GxEPD2_HostPanel::reset();
+  _xs = _wxs = _xc = 0;
+  _xe = _wxe = _ram[0].width_bytes - 1;
+  _ys = _wys = _yc = 0;
+  _ye = _wye = cfg.height - 1;
+  _psr = 0x0F;
+  _ccset = 0;
+  _forced_temperature = 0;
+  _partial_in = false;
+}
+
+uint32_t GxEPD2_HostUC81xx::pixel(uint16_t x, uint16_t y, Layer layer) const
+{
+  switch (layer)
+  {
+    case Current:
+      return _ram[0].bit(x, y) ? 0xFFFFFF : 0x000000;
+    case Previous:
+      return _ram[1].bit(x, y) ? 0xFFFFFF : 0x000000;
+    default:
+      if (!cfg.has_color) return _screen[0].bit(x, y) ? 0xFFFFFF : 0x000000;
+      if (!_screen[0].bit(x, y)) return 0xFF0000;
+      return _screen[1].bit(x, y) ? 0xFFFFFF : 0x000000;
+  }
+}
+
+void GxEPD2_HostUC81xx::_command(uint8_t c)
+{
+  switch (c)
+  {
+    case 0x02: // power off
+      _powerOff();
+      break;
+    case 0x04: // power on
+      _powerOn();
+      break;
+    case 0x10: // data start transmission 1
+    case 0x13: // data start transmission 2
+      _wxs = _partial_in ? _xs : 0;
+      _wxe = _partial_in ? _xe : _ram[0].width_bytes - 1;
+      _wys = _partial_in ? _ys : 0;
+      _wye = _partial_in ? _ye : cfg.height - 1;
+      _xc = _wxs;
+      _yc = _wys;
+      break;
+    case 0x12: // display refresh
+      _refresh(_partial_in || (_psr & 0x20) || ((_ccset & 0x02) && (_forced_temperature >= 0x64)));
+      break;
+    case 0x91: // partial in
+      _partial_in = true;
+      break;
+    case 0x92: // partial out
+      _partial_in = false;
+      break;
+  }
+}
+
+void GxEPD2_HostUC81xx::_data(uint8_t d)
+{
+  if (_index < sizeof(_params)) _params[_index] = d;
+  switch (_cmd)
+  {
+    case 0x00: // panel setting
+      if (_index == 0) _psr = d;
+      break;
+    case 0x07: // deep sleep
+      if (d == 0xA5)
+      {
+        _hibernating = true;
+        _power_is_on = false;
+      }
+      break;
+    case 0x10:
+    case 0x13:
+      if (_yc > _wye) break; // window full
+      _ram[_cmd == 0x13 ? 0 : 1].write(_xc, _yc, d);
+      if (_xc < _wxe) _xc++;
+      else
+      {
+        _xc = _wxs;
+        _yc++;
+      }
+      break;
+    case 0xE0: // cascade setting
+      if (_index == 0) _ccset = d;
+      break;
+    case 0xE5: // force temperature
+      if (_index == 0) _forced_temperature = d;
+      break;
+  }
+}
+
+// partial window has 7 parameters with 1 byte horizontal, or 9 with 2 bytes horizontal, big endian
+void GxEPD2_HostUC81xx::_commandDone()
+{
+  if (_cmd != 0x90) return;
+  if (_index >= 9)
+  {
+    _xs = ((_params[0] << 8) | _params[1]) / 8;
+    _xe = ((_params[2] << 8) | _params[3]) / 8;
+    _ys = (_params[4] << 8) | _params[5];
+    _ye = (_params[6] << 8) | _params[7];
+  }
+  else if (_index >= 7)
+  {
+    _xs = _params[0] / 8;
+    _xe = _params[1] / 8;
+    _ys = (_params[2] << 8) | _params[3];
+    _ye = (_params[4] << 8) | _params[5];
+  }
+}
+
+void GxEPD2_HostUC81xx::_updateScreen(bool partial)
+{
+  (void) partial;
+  uint16_t xs = _partial_in ? _xs : 0;
+  uint16_t xe = _partial_in ? _xe : _ram[0].width_bytes - 1;
+  uint16_t ys = _partial_in ? _ys : 0;
+  uint16_t ye = _partial_in ? _ye : cfg.height - 1;
+  _screen[0].copy(_ram[0], xs, xe, ys, ye);
+  _screen[1].copy(_ram[1], xs, xe, ys, ye);
+}
+
+GxEPD2_HostIT8951::GxEPD2_HostIT8951(const Config& config) : GxEPD2_HostPanel(config, LOW),
+  _screen(uint32_t(config.width) * config.height, 0xFF)
+{
+  _trace_digits = 4;
+  memset(_regs, 0, sizeof(_regs));
+  reset();
+}
+
+void GxEPD2_HostIT8951::reset()
+{
+  GxEPD2_HostPanel::reset();
+  _cmd16 = 0;
+  _preamble = None;
+  _preamble_done = false;
+  _byte_index = 0;
+  _word = 0;
+  _word_index = 0;
+  _args_count = 0;
+  _args_expected = 0;
+  _loading = false;
+  _load_buffer = 0;
+  _dpy_x = _dpy_y = _dpy_w = _dpy_h = 0;
+  _dpy_mode = 0;
+  _dpy_address = image_buffer_address;
+  _engine_until_ns = 0;
+  _response_count = 0;
+  _vcom = 0;
+  _regs[0x208 / 2] = image_buffer_address & 0xFFFF; // LISAR
+  _regs[0x20A / 2] = image_buffer_address >> 16;
+}
+
+void GxEPD2_HostIT8951::select(bool selected)
+{
+  if (selected)
+  {
+    _preamble_done = false;
+    _byte_index = 0;
+    _word_index = 0;
+  }
+}
+
+uint8_t GxEPD2_HostIT8951::transfer(uint8_t value, bool data)
+{
+  (void) data; // no DC, preamble selects
+  uint8_t rv = 0;
+  if (_preamble_done && (_preamble == Read) && (_word_index > 0)) // first word after preamble is dummy
+  {
+    uint16_t response = _word_index - 1 < _response_count ? _response[_word_index - 1] : 0;
+    rv = _byte_index == 0 ? response >> 8 : response & 0xFF;
+  }
+  _word = _byte_index == 0 ? uint16_t(value) << 8 : _word | value;
+  if (++_byte_index < 2) return rv;
+  _byte_index = 0;
+  if (!_preamble_done)
+  {
+    _preamble = _word;
+    _preamble_done = true;
+    _word_index = 0;
+    return rv;
+  }
+  if (_preamble == Command) _command16(_word);
+  else if (_preamble == Write) _data16(_word);
+  _word_index++;
+  return rv;
+}
+
+void GxEPD2_HostIT8951::_command16(uint16_t c)
+{
+  GxEPD2Host.countCommand();
+  _traceCommand(c);
+  _cmd16 = c;
+  _args_count = 0;
+  _args_expected = 0;
+  switch (c)
+  {
+    case 0x0001: // SYS_RUN
+      _powerOn();
+      break;
+    case 0x0002: // STANDBY
+    case 0x0003: // SLEEP
+      _powerOff();
+      break;
+    case 0x0010: // REG_RD, address
+      _args_expected = 1;
+      break;
+    case 0x0011: // REG_WR, address and value
+      _args_expected = 2;
+      break;
+    case 0x0020: // LD_IMG, mode
+      _args_expected = 1;
+      break;
+    case 0x0021: // LD_IMG_AREA, mode, x, y, w, h
+      _args_expected = 5;
+      break;
+    case 0x0022: // LD_IMG_END
+      _loadEnd();
+      break;
+    case 0x0034: // DPY_AREA, x, y, w, h, mode
+      _args_expected = 5;
+      break;
+    case 0x0037: // DPY_BUF_AREA, x, y, w, h, mode, address low, address high
+      _args_expected = 7;
+      break;
+    case 0x0039: // VCOM, 0 get or 1 set with value
+      _args_expected = 1;
+      break;
+    case 0x0302: // GET_DEV_INFO
+      {
+        uint16_t info[20] = {cfg.width, cfg.height, image_buffer_address & 0xFFFF, image_buffer_address >> 16};
+        const char fw[] = "GxEPD2 host";
+        const char lut[] = "emulated";
+        // strings are read into uint16_t words and printed as char*
+        for (uint8_t i = 0; i < sizeof(fw) - 1; i++) info[4 + i / 2] |= uint16_t(fw[i]) << ((i % 2) * 8);
+        for (uint8_t i = 0; i < sizeof(lut) - 1; i++) info[12 + i / 2] |= uint16_t(lut[i]) << ((i % 2) * 8);
+        _respond(info, 20);
+      }
+      break;
+  }
+}
+
+void GxEPD2_HostIT8951::_data16(uint16_t d)
+{
+  _traceData(d);
+  if (_args_count < _args_expected)
+  {
+    _args[_args_count++] = d;
+    if ((_cmd16 == 0x0039) && (_args_count == 1) && (d == 1)) _args_expected = 2; // set VCOM
+    if (_args_count == _args_expected) _execute();
+  }
+  else if (_loading) _pixelData(d);
+}
+
+void GxEPD2_HostIT8951::_execute()
+{
+  switch (_cmd16)
+  {
+    case 0x0010:
+      {
+        uint16_t value = _args[0] / 2 < 0x400 ? _regs[_args[0] / 2] : 0;
+        if (_args[0] == 0x1224) value = _engineBusy() ? 0x0001 : 0; // LUTAFSR
+        _respond(&value, 1);
+      }
+      break;
+    case 0x0011:
+      if (_args[0] / 2 < 0x400) _regs[_args[0] / 2] = _args[1];
+      break;
+    case 0x0020:
+    case 0x0021:
+      {
+        static const uint8_t bpp[] = {2, 4, 4, 8}; // 3 bpp uses 4 bit
+        bool area = _cmd16 == 0x0021;
+        _load_bpp = bpp[(_args[0] >> 4) & 0x03];
+        _load_endian = (_args[0] >> 8) & 0x01;
+        _load_x = area ? _args[1] : 0;
+        _load_y = area ? _args[2] : 0;
+        _load_w = area ? _args[3] : cfg.width;
+        _load_h = area ? _args[4] : cfg.height;
+        _load_col = 0;
+        _load_row = 0;
+        uint32_t address = uint32_t(_regs[0x208 / 2]) | (uint32_t(_regs[0x20A / 2]) << 16);
+        if (address == _dpy_address) _waitEngine(); // the buffer in display
+        _load_buffer = &_imageBuffer(address);
+        _loading = true;
+      }
+      break;
+    case 0x0034:
+    case 0x0037:
+      {
+        _dpy_x = _args[0];
+        _dpy_y = _args[1];
+        _dpy_w = _args[2];
+        _dpy_h = _args[3];
+        _dpy_address = _cmd16 == 0x0037 ? uint32_t(_args[5]) | (uint32_t(_args[6]) << 16) : image_buffer_address;
+        _dpy_mode = _args[4];
+        // after the refresh running in the display engine
+        uint64_t start_ns = _engineBusy() ? _engine_until_ns : GxEPD2Host.nanos();
+        uint64_t ms = _startRefresh((_dpy_mode == 1) || (_dpy_mode == 6) || (_dpy_mode == 7)); // DU, A2, DU4
+        if (_cmd16 == 0x0034) _setBusy((start_ns - GxEPD2Host.nanos()) / 1000 + ms * 1000);
+        else
+        {
+          _waitEngine(); // HRDY is ready when the refresh starts
+          _engine_until_ns = start_ns + ms * 1000000;
+        }
+      }
+      break;
+    case 0x0039:
+      if (_args[0] == 0) _respond(&_vcom, 1);
+      else _vcom = _args[1];
+      break;
+  }
+}
+
+// rows start at word boundaries, little endian has the first pixel in the low bits
+void GxEPD2_HostIT8951::_pixelData(uint16_t d)
+{
+  if (!_load_buffer || (_load_row >= _load_h)) return;
+  if (_load_endian) d = (d << 8) | (d >> 8); // big endian
+  uint8_t mask = (1 << _load_bpp) - 1;
+  uint8_t scale = 0xFF / mask;
+  for (uint8_t shift = 0; shift < 16; shift += _load_bpp)
+  {
+    if (_load_col >= _load_w) break;
+    uint16_t x = _load_x + _load_col++;
+    uint16_t y = _load_y + _load_row;
+    if ((x < cfg.width) && (y < cfg.height)) (*_load_buffer)[uint32_t(y) * cfg.width + x] = ((d >> shift) & mask) * scale;
+  }
+  if (_load_col >= _load_w)
+  {
+    _load_col = 0;
+    _load_row++;
+  }
+}
+
+bool GxEPD2_HostIT8951::_engineBusy() const
+{
+  return GxEPD2Host.nanos() < _engine_until_ns;
+}
+
+// HRDY busy until the display engine is done
+void GxEPD2_HostIT8951::_waitEngine()
+{
+  if (_engineBusy()) _setBusy((_engine_until_ns - GxEPD2Host.nanos() + 999) / 1000);
+}
+
+void GxEPD2_HostIT8951::_loadEnd()
+{
+  _loading = false;
+  _load_buffer = 0;
+}
+
+void GxEPD2_HostIT8951::_updateScreen(bool partial)
+{
+  (void) partial;
+  const std::vector<uint8_t>* buffer = _findImageBuffer(_dpy_address);
+  for (uint16_t y = _dpy_y; (y < _dpy_y + _dpy_h) && (y < cfg.height); y++)
+  {
+    for (uint16_t x = _dpy_x; (x < _dpy_x + _dpy_w) && (x < cfg.width); x++)
+    {
+      uint32_t i = uint32_t(y) * cfg.width + x;
+      uint8_t gray = buffer ? (*buffer)[i] : 0xFF;
+      if (_dpy_mode == 0) gray = 0xFF; // INIT clears
+      else if ((_dpy_mode == 1) || (_dpy_mode == 6)) gray = gray >= 0x80 ? 0xFF : 0x00; // DU, A2
+      else if (_dpy_mode == 7) gray = ((gray + 0x2A) / 0x55) * 0x55; // DU4
+      _screen[i] = gray;
+    }
+  }
+}
+
+std::vector<uint8_t>& GxEPD2_HostIT8951::_imageBuffer(uint32_t address)
+{
+  for (size_t i = 0; i < _image_buffers.size(); i++)
+  {
+    if (_image_buffers[i].address == address) return _image_buffers[i].gray;
+  }
+  ImageBuffer buffer;
+  buffer.address = address;
+  buffer.gray.assign(uint32_t(cfg.width) * cfg.height, 0xFF);
+  _image_buffers.push_back(buffer);
+  return _image_buffers.back().gray;
+}
+
+const std::vector<uint8_t>* GxEPD2_HostIT8951::_findImageBuffer(uint32_t address) const
+{
+  for (size_t i = 0; i < _image_buffers.size(); i++)
+  {
+    if (_image_buffers[i].address == address) return &_image_buffers[i].gray;
+  }
+  return 0;
+}
+
+void GxEPD2_HostIT8951::_respond(const uint16_t* words, uint16_t n)
+{
+  _response_count = n < 20 ? n : 20;
+  memcpy(_response, words, _response_count * sizeof(uint16_t));
+}
+
+uint32_t GxEPD2_HostIT8951::pixel(uint16_t x, uint16_t y, Layer layer) const
+{
+  if ((x >= cfg.width) || (y >= cfg.height)) return 0xFFFFFF;
+  uint32_t i = uint32_t(y) * cfg.width + x;
+  uint8_t gray = 0xFF;
+  if (layer == Screen) gray = _screen[i];
+  else
+  {
+    const std::vector<uint8_t>* buffer = _findImageBuffer(image_buffer_address);
+    if (buffer) gray = (*buffer)[i];
+  }
+  return (uint32_t(gray) << 16) | (uint32_t(gray) << 8) | gray;
+}
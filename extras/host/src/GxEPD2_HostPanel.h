@@ -0,0 +1,242 @@
+// Display Library for SPI e-paper panels from Dalian Good Display and boards from Waveshare.
+// Requires HW SPI and Adafruit_GFX. Caution: the e-paper panels require 3.3V supply AND data lines!
+//
+// Host emulation: controller families as seen on the SPI wires, commands, BUSY behaviour and display RAM.
+// Refresh and power timings are taken from the driver class, see GxEPD2_HostPanel::config().
+// The display RAM and the image shown after the last refresh can be written as PBM, PGM, PPM or PNG.
+//
+// Author: Jean-Marc Zingg
+//
+// Version: see library.properties
+//
+// Library: https://github.com/ZinggJM/GxEPD2
+
+#ifndef _GxEPD2_HostPanel_H_
+#define _GxEPD2_HostPanel_H_
+
+#include "GxEPD2_Host.h"
+#include <vector>
+
+class GxEPD2_HostPanel : public GxEPD2_HostDevice
+{
+  public:
+    struct Config
+    {
+      int16_t cs, dc, rst, busy;
+      uint16_t width, height;
+      bool has_color;
+      uint16_t power_on_time, power_off_time, full_refresh_time, partial_refresh_time; // ms
+    };
+    // pins from the caller, size and timings from the driver class, e.g. config<GxEPD2_290_T94>(5, 17, 16, 4)
+    template<typename GxEPD2_Type> static Config config(int16_t cs, int16_t dc, int16_t rst, int16_t busy)
+    {
+      Config c = {cs, dc, rst, busy, GxEPD2_Type::WIDTH, GxEPD2_Type::HEIGHT, GxEPD2_Type::hasColor,
+                  GxEPD2_Type::power_on_time, GxEPD2_Type::power_off_time,
+                  GxEPD2_Type::full_refresh_time, GxEPD2_Type::partial_refresh_time
+                 };
+      return c;
+    };
+    GxEPD2_HostPanel(const Config& config, int16_t busy_level);
+    // 8 bit controllers: DC low is command, DC high is data
+    uint8_t transfer(uint8_t value, bool data);
+    void reset();
+    // print commands with their data to out, 0 to stop
+    void setTrace(Print* out)
+    {
+      flushTrace();
+      _trace = out;
+    };
+    void flushTrace();
+    bool isPowerOn() const
+    {
+      return _power_is_on;
+    };
+    bool isHibernating() const
+    {
+      return _hibernating;
+    };
+    // Current: new image RAM (SSD16xx 0x24, UC81xx 0x13, IT8951 image buffer)
+    // Previous: old image or color RAM (SSD16xx 0x26, UC81xx 0x10)
+    // Screen: what the panel shows after the last refresh
+    enum Layer {Screen, Current, Previous};
+    // 0xRRGGBB
+    virtual uint32_t pixel(uint16_t x, uint16_t y, Layer layer = Screen) const = 0;
+    // FNV-1a of all pixels of layer, for comparing write paths
+    uint32_t checksum(Layer layer = Screen) const;
+    // format by extension: .pbm .pgm .ppm or .png
+    bool writeImage(const char* path, Layer layer = Screen) const;
+    const Config cfg;
+  protected:
+    // one bit per pixel, 1 is white, as sent by the drivers
+    class Plane
+    {
+      public:
+        Plane(uint16_t w, uint16_t h) : width_bytes((w + 7) / 8), height(h), bytes(uint32_t(width_bytes) * h, 0xFF) {};
+        bool bit(uint16_t x, uint16_t y) const
+        {
+          return (x / 8 < width_bytes) && (y < height) && (bytes[uint32_t(y) * width_bytes + x / 8] & (0x80 >> (x % 8)));
+        };
+        void write(uint16_t xb, uint16_t y, uint8_t value)
+        {
+          if ((xb < width_bytes) && (y < height)) bytes[uint32_t(y) * width_bytes + xb] = value;
+        };
+        void copy(const Plane& from, uint16_t xbs, uint16_t xbe, uint16_t ys, uint16_t ye); // inclusive, bytes
+        uint16_t width_bytes, height;
+        std::vector<uint8_t> bytes;
+    };
+    virtual void _command(uint8_t c) = 0;
+    virtual void _data(uint8_t d) = 0;
+    virtual void _commandDone() {}; // before next command, _cmd and _index still valid
+    virtual uint8_t _read()
+    {
+      return 0xFF;
+    };
+    void _refresh(bool partial);
+    uint32_t _startRefresh(bool partial);
+    virtual void _updateScreen(bool partial) = 0;
+    void _powerOn();
+    void _powerOff();
+    void _busyFor(uint32_t ms);
+    void _traceCommand(uint16_t c);
+    void _traceData(uint16_t d);
+    void _traceEvent(const char* event, uint32_t ms);
+    uint8_t _cmd;      // current command
+    uint32_t _index;   // data index after command
+    bool _power_is_on;
+    bool _hibernating;
+    uint8_t _trace_digits; // 2 for 8 bit, 4 for 16 bit controllers
+  private:
+    static const uint8_t trace_max_data = 16;
+    Print* _trace;
+    bool _trace_pending;
+    uint64_t _trace_time_ns;
+    uint16_t _trace_cmd;
+    uint32_t _trace_count;
+    uint16_t _trace_data[trace_max_data];
+};
+
+// Solomon Systech SSD1607, SSD1608, SSD1675, SSD1680, SSD1681, SSD1683 and compatibles, BUSY active HIGH
+// 0x20 activates the sequence set with 0x22; display mode 2 (0x08) or a reloaded LUT (0x32) count as partial refresh
+// RAM window 0x44/0x45 with byte or pixel (4 parameter) x addresses, counters 0x4E/0x4F, data entry mode 0x11
+// 0x24 is b/w RAM, 0x26 is previous image RAM, or red RAM of 3-color panels with 1 for red
+class GxEPD2_HostSSD16xx : public GxEPD2_HostPanel
+{
+  public:
+    GxEPD2_HostSSD16xx(const Config& config);
+    void reset();
+    uint32_t pixel(uint16_t x, uint16_t y, Layer layer = Screen) const;
+  protected:
+    void _command(uint8_t c);
+    void _data(uint8_t d);
+    void _updateScreen(bool partial);
+    void _commandDone();
+    void _activate();
+    void _writeRam(uint8_t value);
+    Plane _ram[2], _screen[2]; // 0x24, 0x26
+    uint8_t _params[4];
+    uint8_t _entry_mode;
+    uint16_t _xs, _xe, _ys, _ye, _xc, _yc; // x in bytes
+    uint8_t _ctrl2;
+    uint32_t _lut_hash;
+    uint32_t _lut_reference;
+    bool _lut_reference_valid;
+    bool _partial_lut;
+};
+
+// UltraChip UC8151, UC8159, UC8176, UC8179 and compatibles, BUSY active LOW
+// 0x12 counts as partial refresh inside partial in (0x91), with LUT from registers (0x00 bit 5) or a forced fast temperature (0xE5)
+// 0x10 is old image RAM, or black RAM of 3-color panels; 0x13 is new image RAM, or color RAM with 0 for red
+// 0x10 and 0x13 write the partial window (0x90, 7 or 9 parameters) inside partial in, else the full RAM
+class GxEPD2_HostUC81xx : public GxEPD2_HostPanel
+{
+  public:
+    GxEPD2_HostUC81xx(const Config& config);
+    void reset();
+    uint32_t pixel(uint16_t x, uint16_t y, Layer layer = Screen) const;
+  protected:
+    void _command(uint8_t c);
+    void _data(uint8_t d);
+    void _updateScreen(bool partial);
+    void _commandDone();
+    Plane _ram[2], _screen[2]; // 0x13, 0x10
+    uint8_t _params[9];
+    uint16_t _xs, _xe, _ys, _ye; // partial window, x in bytes
+    uint16_t _wxs, _wxe, _wys, _wye, _xc, _yc; // window of RAM write
+    uint8_t _psr;
+    uint8_t _ccset;
+    uint8_t _forced_temperature;
+    bool _partial_in;
+};
+
+// ITE IT8951 with 16 bit SPI words and preambles, HRDY active LOW
+// DU, A2 and DU4 display modes count as partial refresh, DU and A2 show black and white only, DU4 4 levels, INIT white
+// DPY_AREA (0x0034) keeps HRDY busy for the refresh, DPY_BUF_AREA (0x0037) runs it in the display engine with HRDY ready
+// and LUTAFSR (0x1224) busy; loads to the buffer in display and the next display command wait for the engine
+// image loads (0x0020, 0x0021) with 2, 3, 4 or 8 bpp go to the image buffer at LISAR, rotation is not emulated
+// Current and Previous are the image buffer at image_buffer_address, as 8 bit gray
+class GxEPD2_HostIT8951 : public GxEPD2_HostPanel
+{
+  public:
+    GxEPD2_HostIT8951(const Config& config);
+    void select(bool selected);
+    uint8_t transfer(uint8_t value, bool data);
+    void reset();
+    uint32_t pixel(uint16_t x, uint16_t y, Layer layer = Screen) const;
+    static const uint32_t image_buffer_address = 0x001236E0;
+    // mode of the last display command
+    uint16_t displayMode() const
+    {
+      return _dpy_mode;
+    };
+  protected:
+    struct ImageBuffer
+    {
+      uint32_t address;
+      std::vector<uint8_t> gray;
+    };
+    void _command(uint8_t c)
+    {
+      (void) c;
+    };
+    void _data(uint8_t d)
+    {
+      (void) d;
+    };
+    void _command16(uint16_t c);
+    void _data16(uint16_t d);
+    void _updateScreen(bool partial);
+    void _execute();
+    void _pixelData(uint16_t d);
+    void _loadEnd();
+    bool _engineBusy() const;
+    void _waitEngine();
+    std::vector<uint8_t>& _imageBuffer(uint32_t address);
+    const std::vector<uint8_t>* _findImageBuffer(uint32_t address) const;
+    void _respond(const uint16_t* words, uint16_t n);
+    enum Preamble {None, Command = 0x6000, Write = 0x0000, Read = 0x1000};
+    uint16_t _cmd16;
+    uint16_t _preamble;
+    bool _preamble_done;
+    uint8_t _byte_index;
+    uint16_t _word;
+    uint32_t _word_index;  // word index after preamble
+    uint16_t _args[8];
+    uint8_t _args_count;
+    uint8_t _args_expected;
+    bool _loading;
+    uint16_t _response[20];
+    uint16_t _response_count;
+    uint16_t _vcom;
+    uint16_t _regs[0x400]; // system and memory controller registers, word addressed
+    std::vector<ImageBuffer> _image_buffers;
+    std::vector<uint8_t> _screen;
+    std::vector<uint8_t>* _load_buffer;
+    uint8_t _load_bpp, _load_endian;
+    uint16_t _load_x, _load_y, _load_w, _load_h, _load_col, _load_row;
+    uint16_t _dpy_x, _dpy_y, _dpy_w, _dpy_h; // display area of last refresh
+    uint16_t _dpy_mode;
+    uint32_t _dpy_address;
+    uint64_t _engine_until_ns; // end of the refresh of DPY_BUF_AREA, LUTAFSR reads busy
+};
+
+#endif
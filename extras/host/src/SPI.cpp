@@ -0,0 +1,49 @@
+// Display Library for SPI e-paper panels from Dalian Good Display and boards from Waveshare.
+// Requires HW SPI and Adafruit_GFX. Caution: the e-paper panels require 3.3V supply AND data lines!
+//
+// Host emulation: SPI class, all transfers are routed to GxEPD2_Host.
+//
+// Author: Jean-Marc Zingg
+//
+// Version: see library.properties
+//
+// Library: https://github.com/ZinggJM/GxEPD2
+
+#include <SPI.h>
+#include "GxEPD2_Host.h"
+
+SPIClass SPI;
+
+void SPIClass::beginTransaction(SPISettings settings)
+{
+  if (_in_transaction) Serial.println("SPIClass::beginTransaction() while in transaction");
+  _in_transaction = true;
+  _clock = settings._clock;
+  GxEPD2Host.beginTransaction(settings);
+}
+
+void SPIClass::endTransaction()
+{
+  _in_transaction = false;
+  GxEPD2Host.endTransaction();
+}
+
+uint8_t SPIClass::transfer(uint8_t data)
+{
+  return GxEPD2Host.transfer(data, _clock);
+}
+
+uint16_t SPIClass::transfer16(uint16_t data)
+{
+  uint16_t rv = transfer(uint8_t(data >> 8)) << 8;
+  return rv | transfer(uint8_t(data));
+}
+
+void SPIClass::transfer(void* buf, size_t count)
+{
+  uint8_t* p = (uint8_t*) buf;
+  for (size_t i = 0; i < count; i++)
+  {
+    p[i] = transfer(p[i]);
+  }
+}
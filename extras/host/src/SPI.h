@@ -0,0 +1,66 @@
+// Display Library for SPI e-paper panels from Dalian Good Display and boards from Waveshare.
+// Requires HW SPI and Adafruit_GFX. Caution: the e-paper panels require 3.3V supply AND data lines!
+//
+// Host emulation: SPI class, all transfers are routed to GxEPD2_Host.
+//
+// Author: Jean-Marc Zingg
+//
+// Version: see library.properties
+//
+// Library: https://github.com/ZinggJM/GxEPD2
+
+#ifndef _GxEPD2_Host_SPI_H_
+#define _GxEPD2_Host_SPI_H_
+
+#include <Arduino.h>
+
+#define LSBFIRST 0
+#define MSBFIRST 1
+
+#define SPI_MODE0 0x00
+#define SPI_MODE1 0x01
+#define SPI_MODE2 0x02
+#define SPI_MODE3 0x03
+
+class SPISettings
+{
+  public:
+    SPISettings(uint32_t clock = 4000000, uint8_t bitOrder = MSBFIRST, uint8_t dataMode = SPI_MODE0) :
+      _clock(clock), _bitOrder(bitOrder), _dataMode(dataMode) {};
+    uint32_t _clock;
+    uint8_t _bitOrder;
+    uint8_t _dataMode;
+};
+
+class SPIClass
+{
+  public:
+    SPIClass(uint8_t bus = 0) : _bus(bus), _clock(4000000), _in_transaction(false) {};
+    void begin() {};
+    void begin(int8_t sck, int8_t miso, int8_t mosi, int8_t ss = -1)
+    {
+      (void) sck; (void) miso; (void) mosi; (void) ss;
+    };
+    void end() {};
+    void beginTransaction(SPISettings settings);
+    void endTransaction();
+    uint8_t transfer(uint8_t data);
+    uint16_t transfer16(uint16_t data);
+    void transfer(void* buf, size_t count);
+    uint8_t bus() const
+    {
+      return _bus;
+    };
+    uint32_t clock() const
+    {
+      return _clock;
+    };
+  private:
+    uint8_t _bus;
+    uint32_t _clock;
+    bool _in_transaction;
+};
+
+extern SPIClass SPI;
+
+#endif
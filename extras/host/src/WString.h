@@ -0,0 +1,71 @@
+// Display Library for SPI e-paper panels from Dalian Good Display and boards from Waveshare.
+// Requires HW SPI and Adafruit_GFX. Caution: the e-paper panels require 3.3V supply AND data lines!
+//
+// Host emulation: String and __FlashStringHelper, as far as used by GxEPD2 and Adafruit_GFX.
+//
+// Author: Jean-Marc Zingg
+//
+// Version: see library.properties
+//
+// Library: https://github.com/ZinggJM/GxEPD2
+
+#ifndef _GxEPD2_Host_WString_H_
+#define _GxEPD2_Host_WString_H_
+
+#include <string>
+
+class __FlashStringHelper;
+#define F(string_literal) (reinterpret_cast<const __FlashStringHelper *>(string_literal))
+
+class String
+{
+  public:
+    String(const char* cstr = "") : _s(cstr ? cstr : "") {};
+    String(const __FlashStringHelper* str) : _s(reinterpret_cast<const char*>(str)) {};
+    String(char c) : _s(1, c) {};
+    String(int value, unsigned char base = 10) : _s(_format(value, base)) {};
+    String(unsigned int value, unsigned char base = 10) : _s(_format(value, base)) {};
+    String(long value, unsigned char base = 10) : _s(_format(value, base)) {};
+    String(unsigned long value, unsigned char base = 10) : _s(_format(value, base)) {};
+    String(double value, unsigned char decimals = 2);
+    const char* c_str() const
+    {
+      return _s.c_str();
+    };
+    unsigned int length() const
+    {
+      return _s.length();
+    };
+    char operator[](unsigned int index) const
+    {
+      return index < _s.length() ? _s[index] : 0;
+    };
+    String& operator+=(const String& rhs)
+    {
+      _s += rhs._s;
+      return *this;
+    };
+    friend String operator+(const String& lhs, const String& rhs)
+    {
+      String s(lhs);
+      return s += rhs;
+    };
+    bool operator==(const String& rhs) const
+    {
+      return _s == rhs._s;
+    };
+  private:
+    static std::string _format(long value, unsigned char base);
+    static std::string _format(unsigned long value, unsigned char base);
+    static std::string _format(int value, unsigned char base)
+    {
+      return _format(long(value), base);
+    };
+    static std::string _format(unsigned int value, unsigned char base)
+    {
+      return _format((unsigned long)(value), base);
+    };
+    std::string _s;
+};
+
+#endif
@@ -0,0 +1,197 @@
+// GxEPD2_BitmapCompress.cpp by Jean-Marc Zingg
+
+// purpose is to compress the bitmap arrays of C headers, as in src/bitmaps, to the GxEPD2 native image format,
+// for GxEPD2_NativeReader with GxEPD2_MemorySource; mostly white pictures shrink to a fraction of their flash size
+// the arrays are taken as writeImage() and writeNative() take them: 1 bit with 1 white for bw,
+// a black and a color array for 3c, 2 bits per pixel for 4c, 4 bits per pixel for 7c,
+// or one byte per pixel for 7c with -8, as the demo bitmaps of drawDemoBitmap(), e.g. Bitmap7c800x480
+
+// build with: make, see README.md of extras/host
+// usage: GxEPD2_BitmapCompress [-f bw|3c|4c|7c] [-8] [-i] [-y] [-b rows] [-r] -s WIDTHxHEIGHT input.h array [color_array] output
+//   -f  format of the panel, default bw; 3c needs the black and the color array
+//   -8  7c demo bitmap, one byte per pixel
+//   -i  invert, for 1 bit arrays with 1 black, as invert of writeImage()
+//   -y  mirror_y, for arrays bottom row first, as mirror_y of writeImage()
+//   -b  rows per band, default 16
+//   -r  raw, no compression; else each band is PackBits compressed if it gets smaller
+//   -s  size of the bitmap in pixels
+//   output ending in .h is written as a PROGMEM array for GxEPD2_MemorySource, named as the file
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <string>
+#include <vector>
+#include <GxEPD2_NativeReader.h>
+#include <GxEPD2_HostNative.h>
+
+bool readFile(const char* path, std::string& text)
+{
+  FILE* f = fopen(path, "rb");
+  if (!f) return false;
+  char buffer[4096];
+  size_t n;
+  while ((n = fread(buffer, 1, sizeof(buffer), f)) > 0) text.append(buffer, n);
+  fclose(f);
+  return true;
+}
+
+// skips blanks and comments
+size_t skip(const std::string& text, size_t i)
+{
+  while (i < text.size())
+  {
+    if (isspace(text[i])) i++;
+    else if (text.compare(i, 2, "/*") == 0)
+    {
+      size_t end = text.find("*/", i + 2);
+      i = end == std::string::npos ? text.size() : end + 2;
+    }
+    else if (text.compare(i, 2, "//") == 0)
+    {
+      size_t end = text.find('\n', i);
+      i = end == std::string::npos ? text.size() : end + 1;
+    }
+    else break;
+  }
+  return i;
+}
+
+// the bytes of the initializer of array name, e.g. const unsigned char name[] PROGMEM = { 0XFF, ... };
+bool parseArray(const std::string& text, const char* name, std::vector<uint8_t>& data)
+{
+  size_t len = strlen(name);
+  for (size_t i = text.find(name); i != std::string::npos; i = text.find(name, i + 1))
+  {
+    if ((i > 0) && (isalnum(text[i - 1]) || (text[i - 1] == '_'))) continue;
+    size_t j = skip(text, i + len);
+    if ((j >= text.size()) || (text[j] != '[')) continue; // other name or a use of it
+    size_t eq = text.find('=', j), end = text.find(';', j);
+    if ((eq == std::string::npos) || (end == std::string::npos) || (end < eq)) continue; // declaration only
+    j = skip(text, eq + 1);
+    if ((j >= text.size()) || (text[j] != '{')) return false;
+    for (j = skip(text, j + 1); (j < text.size()) && (text[j] != '}'); j = skip(text, j))
+    {
+      if (text[j] == ',')
+      {
+        j++;
+        continue;
+      }
+      char* next;
+      unsigned long value = strtoul(text.c_str() + j, &next, 0);
+      if ((next == text.c_str() + j) || (value > 0xFF)) return false;
+      data.push_back(value);
+      j = next - text.c_str();
+    }
+    return j < text.size();
+  }
+  return false;
+}
+
+// pixel value of a byte of the demo bitmaps, as GxEPD2_730c_GDEY073D46::_colorOfDemoBitmap()
+uint8_t colorOfDemoBitmap(uint8_t from)
+{
+  switch (from)
+  {
+    case 0xFC: return 0x05; // yellow
+    case 0xF1: return 0x06; // orange
+    case 0xE5: return 0x04; // red
+    case 0x4B: return 0x03; // blue
+    case 0x39: return 0x02; // green
+    case 0x00: return 0x00; // black
+  }
+  return 0x01; // white
+}
+
+int usage()
+{
+  fprintf(stderr, "usage: GxEPD2_BitmapCompress [-f bw|3c|4c|7c] [-8] [-i] [-y] [-b rows] [-r] -s WIDTHxHEIGHT input.h array [color_array] output\n");
+  return 2;
+}
+
+int main(int argc, char* argv[])
+{
+  uint8_t format = GxEPD2_NativeReader::Format1;
+  bool demo = false, invert = false, mirror_y = false, raw = false;
+  uint16_t band_height = 16;
+  unsigned width = 0, height = 0;
+  int i = 1;
+  for (; (i < argc) && (argv[i][0] == '-'); i++)
+  {
+    if ((strcmp(argv[i], "-f") == 0) && (i + 1 < argc))
+    {
+      const char* f = argv[++i];
+      if (strcmp(f, "bw") == 0) format = GxEPD2_NativeReader::Format1;
+      else if (strcmp(f, "3c") == 0) format = GxEPD2_NativeReader::Format3C;
+      else if (strcmp(f, "4c") == 0) format = GxEPD2_NativeReader::Format4C;
+      else if (strcmp(f, "7c") == 0) format = GxEPD2_NativeReader::Format7C;
+      else return usage();
+    }
+    else if ((strcmp(argv[i], "-s") == 0) && (i + 1 < argc))
+    {
+      if (sscanf(argv[++i], "%ux%u", &width, &height) != 2) return usage();
+    }
+    else if ((strcmp(argv[i], "-b") == 0) && (i + 1 < argc)) band_height = atoi(argv[++i]);
+    else if (strcmp(argv[i], "-8") == 0) demo = true;
+    else if (strcmp(argv[i], "-i") == 0) invert = true;
+    else if (strcmp(argv[i], "-y") == 0) mirror_y = true;
+    else if (strcmp(argv[i], "-r") == 0) raw = true;
+    else return usage();
+  }
+  if (demo) format = GxEPD2_NativeReader::Format7C;
+  uint8_t planes = GxEPD2_HostNative::planes(format);
+  if ((i + 2 + planes != argc) || (band_height == 0) || (width == 0) || (height == 0) || (width > 0x7FFF) || (height > 0x7FFF)) return usage();
+  std::string text;
+  if (!readFile(argv[i], text))
+  {
+    fprintf(stderr, "can't read %s\n", argv[i]);
+    return 1;
+  }
+  uint16_t bytes_per_row = GxEPD2_HostNative::bytesPerRow(format, width);
+  uint16_t input_bytes_per_row = demo ? width : bytes_per_row;
+  uint32_t input_size = uint32_t(input_bytes_per_row) * height;
+  // planes of all rows, row by row and plane by plane
+  std::vector<uint8_t> pixels(uint32_t(bytes_per_row) * height * planes);
+  for (uint8_t p = 0; p < planes; p++)
+  {
+    std::vector<uint8_t> data;
+    if (!parseArray(text, argv[i + 1 + p], data))
+    {
+      fprintf(stderr, "%s: no array %s\n", argv[i], argv[i + 1 + p]);
+      return 1;
+    }
+    if (data.size() < input_size)
+    {
+      fprintf(stderr, "%s: %u bytes in %s, %ux%u needs %u\n", argv[i], uint32_t(data.size()), argv[i + 1 + p], width, height, input_size);
+      return 1;
+    }
+    for (uint16_t row = 0; row < height; row++)
+    {
+      const uint8_t* source = &data[uint32_t(mirror_y ? height - 1 - row : row) * input_bytes_per_row];
+      uint8_t* target = &pixels[(uint32_t(row) * planes + p) * bytes_per_row];
+      if (demo)
+      {
+        for (uint16_t k = 0; k < width; k++)
+        {
+          uint8_t shift = k % 2 ? 0 : 4;
+          target[k / 2] = (target[k / 2] & ~(0x0F << shift)) | (colorOfDemoBitmap(source[k]) << shift);
+        }
+        if (width % 2) target[width / 2] |= 0x01; // white padding
+        continue;
+      }
+      for (uint16_t k = 0; k < bytes_per_row; k++) target[k] = invert && (format <= GxEPD2_NativeReader::Format3C) ? ~source[k] : source[k];
+    }
+  }
+  std::vector<uint8_t> out;
+  uint16_t bands = (height + band_height - 1) / band_height;
+  uint16_t packed_bands = GxEPD2_HostNative::encode(out, format, width, height, pixels, band_height, raw);
+  if (!GxEPD2_HostNative::write(argv[argc - 1], out))
+  {
+    fprintf(stderr, "can't write %s\n", argv[argc - 1]);
+    return 1;
+  }
+  printf("%s: %ux%u, %u bytes of pixels, %u of %u bands compressed, %u bytes written\n",
+         argv[argc - 1], width, height, uint32_t(pixels.size()), packed_bands, bands, uint32_t(out.size()));
+  return 0;
+}
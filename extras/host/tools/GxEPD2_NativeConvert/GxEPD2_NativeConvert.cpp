@@ -0,0 +1,168 @@
+// GxEPD2_NativeConvert.cpp by Jean-Marc Zingg
+
+// purpose is to convert BMP files once, e.g. on a content server, to the GxEPD2 native image format,
+// for loading with GxEPD2_NativeReader without conversion; the format is described in GxEPD2_NativeReader.h
+// the BMP is decoded by GxEPD2_BmpReader, the colors are mapped as the drawPixel() of the display classes do,
+// with GxEPD2_ColorMap for 4-color and 7-color
+
+// build with: make, see README.md of extras/host
+// usage: GxEPD2_NativeConvert [-f bw|3c|4c|7c] [-m] [-d fs|atkinson|ordered|nearest] [-b rows] [-r] input.bmp output
+//   -f  format of the panel, default bw
+//   -m  black and white only
+//   -d  dither to the colors of the panel with GxEPD2_Dither: Floyd-Steinberg, Atkinson, ordered or nearest color
+//   -b  rows per band, default 16
+//   -r  raw, no compression; else each band is PackBits compressed if it gets smaller
+//   output ending in .h is written as a PROGMEM array for GxEPD2_MemorySource, named as the file
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+#include <GxEPD2_BmpReader.h>
+#include <GxEPD2_NativeReader.h>
+#include <GxEPD2_Dither.h>
+#include <GxEPD2_ColorMap.h>
+#include <GxEPD2_HostNative.h>
+
+bool readFile(const char* path, std::vector<uint8_t>& data)
+{
+  FILE* f = fopen(path, "rb");
+  if (!f) return false;
+  uint8_t buffer[4096];
+  size_t n;
+  while ((n = fread(buffer, 1, sizeof(buffer), f)) > 0) data.insert(data.end(), buffer, buffer + n);
+  fclose(f);
+  return true;
+}
+
+int usage()
+{
+  fprintf(stderr, "usage: GxEPD2_NativeConvert [-f bw|3c|4c|7c] [-m] [-d fs|atkinson|ordered|nearest] [-b rows] [-r] input.bmp output\n");
+  return 2;
+}
+
+int main(int argc, char* argv[])
+{
+  uint8_t format = GxEPD2_NativeReader::Format1;
+  bool mono = false, raw = false, dither = false;
+  GxEPD2_Dither::Method method = GxEPD2_Dither::FloydSteinberg;
+  uint16_t band_height = 16;
+  int i = 1;
+  for (; (i < argc) && (argv[i][0] == '-'); i++)
+  {
+    if ((strcmp(argv[i], "-f") == 0) && (i + 1 < argc))
+    {
+      const char* f = argv[++i];
+      if (strcmp(f, "bw") == 0) format = GxEPD2_NativeReader::Format1;
+      else if (strcmp(f, "3c") == 0) format = GxEPD2_NativeReader::Format3C;
+      else if (strcmp(f, "4c") == 0) format = GxEPD2_NativeReader::Format4C;
+      else if (strcmp(f, "7c") == 0) format = GxEPD2_NativeReader::Format7C;
+      else return usage();
+    }
+    else if ((strcmp(argv[i], "-d") == 0) && (i + 1 < argc))
+    {
+      const char* d = argv[++i];
+      dither = true;
+      if (strcmp(d, "fs") == 0) method = GxEPD2_Dither::FloydSteinberg;
+      else if (strcmp(d, "atkinson") == 0) method = GxEPD2_Dither::Atkinson;
+      else if (strcmp(d, "ordered") == 0) method = GxEPD2_Dither::Ordered;
+      else if (strcmp(d, "nearest") == 0) method = GxEPD2_Dither::Nearest;
+      else return usage();
+    }
+    else if ((strcmp(argv[i], "-b") == 0) && (i + 1 < argc)) band_height = atoi(argv[++i]);
+    else if (strcmp(argv[i], "-m") == 0) mono = true;
+    else if (strcmp(argv[i], "-r") == 0) raw = true;
+    else return usage();
+  }
+  if ((i + 2 != argc) || (band_height == 0)) return usage();
+  std::vector<uint8_t> input;
+  if (!readFile(argv[i], input))
+  {
+    fprintf(stderr, "can't read %s\n", argv[i]);
+    return 1;
+  }
+  GxEPD2_MemorySource source(input.data(), input.size());
+  GxEPD2_BmpReader bmp(source);
+  if (!bmp.begin(!mono))
+  {
+    fprintf(stderr, "%s: bitmap format not handled\n", argv[i]);
+    return 1;
+  }
+  uint16_t width = bmp.width(), height = bmp.height();
+  uint8_t bits = GxEPD2_HostNative::bits(format);
+  uint8_t planes = GxEPD2_HostNative::planes(format);
+  uint16_t bytes_per_row = GxEPD2_HostNative::bytesPerRow(format, width);
+  const GxEPD2_Dither::Color* palette = GxEPD2_Dither::PaletteBW;
+  uint8_t colors = 2;
+  if (!mono && (format == GxEPD2_NativeReader::Format3C)) palette = GxEPD2_Dither::Palette3C, colors = 3;
+  if (!mono && (format == GxEPD2_NativeReader::Format4C)) palette = GxEPD2_Dither::Palette4C, colors = 4;
+  if (!mono && (format == GxEPD2_NativeReader::Format7C)) palette = GxEPD2_Dither::Palette7C, colors = 7;
+  std::vector<int16_t> error_buffer(GxEPD2_Dither::bufferSize(method, width));
+  GxEPD2_Dither ditherer(method, palette, colors, error_buffer.data(), width);
+  uint16_t rgb[GxEPD2_BMP_CHUNK_PIXELS];
+  // planes of all rows, padded with white
+  std::vector<uint8_t> pixels(uint32_t(height) * planes * bytes_per_row, bits == 1 ? 0xFF : bits == 2 ? 0x55 : 0x11);
+  for (uint16_t row = 0; row < height; row++)
+  {
+    uint8_t* plane0 = &pixels[uint32_t(row) * planes * bytes_per_row];
+    uint8_t* plane1 = plane0 + bytes_per_row;
+    for (uint16_t column = 0; column < width; column += GxEPD2_BMP_CHUNK_PIXELS)
+    {
+      uint16_t n = width - column < GxEPD2_BMP_CHUNK_PIXELS ? width - column : GxEPD2_BMP_CHUNK_PIXELS;
+      if (!bmp.readPixels(row, column, n))
+      {
+        fprintf(stderr, "%s: read error\n", argv[i]);
+        return 1;
+      }
+      if (dither)
+      {
+        for (uint16_t k = 0; k < n; k++) rgb[k] = bmp.rgb(k);
+        ditherer.dither(column, row, rgb, n);
+      }
+      else
+      {
+        for (uint16_t k = 0; k < n; k++) rgb[k] = bmp.withColor() ? bmp.rgb(k) : bmp.isWhite(k) ? GxEPD_WHITE : GxEPD_BLACK;
+      }
+      // column is a multiple of 8, the chunk starts on a byte
+      switch (format)
+      {
+        case GxEPD2_NativeReader::Format4C:
+          GxEPD2_ColorMap::row4(rgb, plane0 + column / 4, n);
+          continue;
+        case GxEPD2_NativeReader::Format7C:
+          GxEPD2_ColorMap::row7(rgb, plane0 + column / 2, n);
+          continue;
+      }
+      for (uint16_t k = 0; k < n; k++)
+      {
+        uint16_t x = column + k;
+        uint8_t mask = 0x80 >> (x % 8);
+        if (dither) // palette colors
+        {
+          if (rgb[k] == GxEPD_BLACK) plane0[x / 8] &= ~mask;
+          else if ((rgb[k] != GxEPD_WHITE) && (format == GxEPD2_NativeReader::Format3C)) plane1[x / 8] &= ~mask;
+          else if (rgb[k] != GxEPD_WHITE) plane0[x / 8] &= ~mask;
+          continue;
+        }
+        if (format == GxEPD2_NativeReader::Format1) // colored is white, as with GxEPD2_BW::drawPixel()
+        {
+          if (!bmp.isWhite(k) && !bmp.isColored(k)) plane0[x / 8] &= ~mask;
+        }
+        else if (!bmp.isWhite(k) && bmp.isColored(k)) plane1[x / 8] &= ~mask;
+        else if (!bmp.isWhite(k)) plane0[x / 8] &= ~mask;
+      }
+    }
+  }
+  std::vector<uint8_t> out;
+  uint16_t bands = (height + band_height - 1) / band_height;
+  uint16_t packed_bands = GxEPD2_HostNative::encode(out, format, width, height, pixels, band_height, raw);
+  if (!GxEPD2_HostNative::write(argv[i + 1], out))
+  {
+    fprintf(stderr, "can't write %s\n", argv[i + 1]);
+    return 1;
+  }
+  printf("%s: %ux%u, %u bytes of pixels, %u of %u bands compressed, %u bytes written\n",
+         argv[i + 1], width, height, uint32_t(pixels.size()), packed_bands, bands, uint32_t(out.size()));
+  return 0;
+}
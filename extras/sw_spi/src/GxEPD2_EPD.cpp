@@ -26,6 +26,18 @@
 #include <avr/pgmspace.h>
 #endif
 
+#if defined(ESP8266) || defined(ESP32)
+#define GxEPD2_ISR_ATTR IRAM_ATTR
+#else
+#define GxEPD2_ISR_ATTR
+#endif
+
+#if defined(ENABLE_GxEPD2_STATISTICS)
+#define GxEPD2_COUNT(counter, n) _statistics.counter += (n)
+#else
+#define GxEPD2_COUNT(counter, n)
+#endif
+
 GxEPD2_EPD::GxEPD2_EPD(int16_t cs, int16_t dc, int16_t rst, int16_t busy, int16_t busy_level, uint32_t busy_timeout,
                        uint16_t w, uint16_t h, GxEPD2::Panel p, bool c, bool pu, bool fpu) :
   WIDTH(w), HEIGHT(h), panel(p), hasColor(c), hasPartialUpdate(pu), hasFastPartialUpdate(fpu),
@@ -40,6 +52,20 @@ GxEPD2_EPD::GxEPD2_EPD(int16_t cs, int16_t dc, int16_t rst, int16_t busy, int16_
   _hibernating = false;
   _init_display_done = false;
   _reset_duration = 20;
+  _busy_callback = 0;
+  _busy_callback_parameter = 0;
+  _refresh_callback = 0;
+  _refresh_callback_parameter = 0;
+  _async_step = 0;
+  _async_step_parameter = 0;
+  _async_mode = false;
+  _async_pending = false;
+  _busy_interrupt = false;
+  _busy_released = false;
+  _async_comment = 0;
+  _async_busy_time = 0;
+  _async_start = 0;
+  resetStatistics();
 }
 
 void GxEPD2_EPD::init(uint32_t serial_diag_bitrate)
@@ -103,8 +129,152 @@ void GxEPD2_EPD::end()
   if (_rst >= 0) pinMode(_rst, INPUT);
 }
 
+void GxEPD2_EPD::setBusyCallback(void (*busyCallback)(const void*), const void* busy_callback_parameter)
+{
+  _busy_callback = busyCallback;
+  _busy_callback_parameter = busy_callback_parameter;
+}
+
+void GxEPD2_EPD::refreshAsync(bool partial_update_mode)
+{
+  _startAsync();
+  refresh(partial_update_mode);
+  _async_mode = false;
+}
+
+void GxEPD2_EPD::refreshAsync(int16_t x, int16_t y, int16_t w, int16_t h)
+{
+  _startAsync();
+  refresh(x, y, w, h);
+  _async_mode = false;
+}
+
+void GxEPD2_EPD::powerOffAsync()
+{
+  _startAsync();
+  powerOff();
+  _async_mode = false;
+}
+
+bool GxEPD2_EPD::isBusy()
+{
+  if (!_async_pending) return false;
+  unsigned long elapsed = micros() - _async_start;
+  if (_busy >= 0)
+  {
+    if (elapsed < 1000) return true; // margin to become active, as in _waitWhileBusy()
+    if (elapsed > _busy_timeout) Serial.println("Busy Timeout!");
+    else if (_busy_interrupt && !_busy_released) return true;
+    else if (digitalRead(_busy) == _busy_level) return true;
+  }
+  else if (elapsed < 1000ul * _async_busy_time) return true;
+  _endAsync();
+  return _async_pending; // a step may have started the next async operation
+}
+
+void GxEPD2_EPD::waitWhileBusy()
+{
+  while (isBusy())
+  {
+    if (_busy_callback) _busy_callback(_busy_callback_parameter);
+    else delay(1);
+#if defined(ESP8266) || defined(ESP32)
+    yield(); // avoid wdt
+#endif
+  }
+}
+
+void GxEPD2_EPD::setRefreshCallback(void (*refreshCallback)(const void*), const void* refresh_callback_parameter)
+{
+  _refresh_callback = refreshCallback;
+  _refresh_callback_parameter = refresh_callback_parameter;
+}
+
+void GxEPD2_EPD::setAsyncStep(void (*asyncStep)(void*), void* async_step_parameter)
+{
+  _async_step = asyncStep;
+  _async_step_parameter = async_step_parameter;
+}
+
+// attachInterrupt() has no parameter, one instance; attachInterruptArg() on ESP8266 and ESP32
+GxEPD2_EPD* GxEPD2_EPD::_busy_interrupt_epd = 0;
+
+void GxEPD2_ISR_ATTR GxEPD2_EPD::_busyReleased(void* epd)
+{
+  static_cast<GxEPD2_EPD*>(epd)->_busy_released = true;
+}
+
+void GxEPD2_ISR_ATTR GxEPD2_EPD::_busyReleasedISR()
+{
+  if (_busy_interrupt_epd) _busy_interrupt_epd->_busy_released = true;
+}
+
+bool GxEPD2_EPD::enableBusyInterrupt(bool enable)
+{
+  if ((_busy < 0) || (digitalPinToInterrupt(_busy) < 0)) return false;
+  if (_busy_interrupt) detachInterrupt(digitalPinToInterrupt(_busy));
+  _busy_interrupt = false;
+  if (!enable) return true;
+  int mode = _busy_level == HIGH ? FALLING : RISING;
+#if defined(ESP8266) || defined(ESP32)
+  attachInterruptArg(digitalPinToInterrupt(_busy), _busyReleased, this, mode);
+#else
+  _busy_interrupt_epd = this;
+  attachInterrupt(digitalPinToInterrupt(_busy), _busyReleasedISR, mode);
+#endif
+  _busy_interrupt = true;
+  return true;
+}
+
+void GxEPD2_EPD::_startAsync()
+{
+  _waitAsync();
+  _async_mode = true;
+}
+
+void GxEPD2_EPD::_endAsync()
+{
+  _async_pending = false;
+  GxEPD2_COUNT(busy_waits, 1);
+  GxEPD2_COUNT(busy_time_us, micros() - _async_start);
+#if !defined(DISABLE_DIAGNOSTIC_OUTPUT)
+  if (_async_comment && _diag_enabled)
+  {
+    Serial.print(_async_comment);
+    Serial.print(" : ");
+    Serial.println(micros() - _async_start);
+  }
+#endif
+  if (_async_mode) return; // wait inside the sequence, before its next command
+  if (_async_step)
+  {
+    void (*step)(void*) = _async_step;
+    _async_step = 0;
+    step(_async_step_parameter);
+  }
+  if (!_async_pending && _refresh_callback) _refresh_callback(_refresh_callback_parameter);
+}
+
+GxEPD2_EPD::Statistics GxEPD2_EPD::getStatistics()
+{
+#if defined(ENABLE_GxEPD2_STATISTICS)
+  return _statistics;
+#else
+  Statistics none = {0, 0, 0, 0, 0, 0};
+  return none;
+#endif
+}
+
+void GxEPD2_EPD::resetStatistics()
+{
+#if defined(ENABLE_GxEPD2_STATISTICS)
+  memset(&_statistics, 0, sizeof(_statistics));
+#endif
+}
+
 void GxEPD2_EPD::_reset()
 {
+  _waitAsync();
   if (_rst >= 0)
   {
     if (_pulldown_rst_mode)
@@ -131,6 +301,16 @@ void GxEPD2_EPD::_reset()
 
 void GxEPD2_EPD::_waitWhileBusy(const char* comment, uint16_t busy_time)
 {
+  _waitAsync();
+  if (_async_mode) // deferred, completed by isBusy() or before the next command
+  {
+    _async_pending = true;
+    _async_comment = comment;
+    _async_busy_time = busy_time;
+    _busy_released = false;
+    _async_start = micros();
+    return;
+  }
   if (_busy >= 0)
   {
     delay(1); // add some margin to become active
@@ -138,13 +318,16 @@ void GxEPD2_EPD::_waitWhileBusy(const char* comment, uint16_t busy_time)
     while (1)
     {
       if (digitalRead(_busy) != _busy_level) break;
-      delay(1);
+      if (_busy_callback) _busy_callback(_busy_callback_parameter);
+      else delay(1);
       if (micros() - start > _busy_timeout)
       {
         Serial.println("Busy Timeout!");
         break;
       }
     }
+    GxEPD2_COUNT(busy_waits, 1);
+    GxEPD2_COUNT(busy_time_us, micros() - start);
     if (comment)
     {
 #if !defined(DISABLE_DIAGNOSTIC_OUTPUT)
@@ -159,14 +342,22 @@ void GxEPD2_EPD::_waitWhileBusy(const char* comment, uint16_t busy_time)
     }
     (void) start;
   }
-  else delay(busy_time);
+  else
+  {
+    delay(busy_time);
+    GxEPD2_COUNT(busy_waits, 1);
+    GxEPD2_COUNT(busy_time_us, 1000ul * busy_time);
+  }
 }
 
 void GxEPD2_EPD::_writeCommand(uint8_t c)
 {
+  _waitAsync();
+  GxEPD2_COUNT(commands, 1);
   _beginTransaction(_spi_settings);
   if (_dc >= 0) digitalWrite(_dc, LOW);
   if (_cs >= 0) digitalWrite(_cs, LOW);
+  GxEPD2_COUNT(cs_selects, _cs >= 0);
   _spi_write(c);
   if (_cs >= 0) digitalWrite(_cs, HIGH);
   if (_dc >= 0) digitalWrite(_dc, HIGH);
@@ -175,8 +366,10 @@ void GxEPD2_EPD::_writeCommand(uint8_t c)
 
 void GxEPD2_EPD::_writeData(uint8_t d)
 {
+  _waitAsync();
   _beginTransaction(_spi_settings);
   if (_cs >= 0) digitalWrite(_cs, LOW);
+  GxEPD2_COUNT(cs_selects, _cs >= 0);
   _spi_write(d);
   if (_cs >= 0) digitalWrite(_cs, HIGH);
   _endTransaction();
@@ -184,8 +377,10 @@ void GxEPD2_EPD::_writeData(uint8_t d)
 
 void GxEPD2_EPD::_writeData(const uint8_t* data, uint16_t n)
 {
+  _waitAsync();
   _beginTransaction(_spi_settings);
   if (_cs >= 0) digitalWrite(_cs, LOW);
+  GxEPD2_COUNT(cs_selects, _cs >= 0);
   for (uint8_t i = 0; i < n; i++)
   {
     _spi_write(*data++);
@@ -196,8 +391,10 @@ void GxEPD2_EPD::_writeData(const uint8_t* data, uint16_t n)
 
 void GxEPD2_EPD::_writeDataPGM(const uint8_t* data, uint16_t n, int16_t fill_with_zeroes)
 {
+  _waitAsync();
   _beginTransaction(_spi_settings);
   if (_cs >= 0) digitalWrite(_cs, LOW);
+  GxEPD2_COUNT(cs_selects, _cs >= 0);
   for (uint8_t i = 0; i < n; i++)
   {
     _spi_write(pgm_read_byte(&*data++));
@@ -213,16 +410,19 @@ void GxEPD2_EPD::_writeDataPGM(const uint8_t* data, uint16_t n, int16_t fill_wit
 
 void GxEPD2_EPD::_writeDataPGM_sCS(const uint8_t* data, uint16_t n, int16_t fill_with_zeroes)
 {
+  _waitAsync();
   _beginTransaction(_spi_settings);
   for (uint8_t i = 0; i < n; i++)
   {
     if (_cs >= 0) digitalWrite(_cs, LOW);
+    GxEPD2_COUNT(cs_selects, _cs >= 0);
     _spi_write(pgm_read_byte(&*data++));
     if (_cs >= 0) digitalWrite(_cs, HIGH);
   }
   while (fill_with_zeroes > 0)
   {
     if (_cs >= 0) digitalWrite(_cs, LOW);
+    GxEPD2_COUNT(cs_selects, _cs >= 0);
     _spi_write(0x00);
     fill_with_zeroes--;
     if (_cs >= 0) digitalWrite(_cs, HIGH);
@@ -232,9 +432,12 @@ void GxEPD2_EPD::_writeDataPGM_sCS(const uint8_t* data, uint16_t n, int16_t fill
 
 void GxEPD2_EPD::_writeCommandData(const uint8_t* pCommandData, uint8_t datalen)
 {
+  _waitAsync();
+  GxEPD2_COUNT(commands, 1);
   _beginTransaction(_spi_settings);
   if (_dc >= 0) digitalWrite(_dc, LOW);
   if (_cs >= 0) digitalWrite(_cs, LOW);
+  GxEPD2_COUNT(cs_selects, _cs >= 0);
   _spi_write(*pCommandData++);
   if (_dc >= 0) digitalWrite(_dc, HIGH);
   for (uint8_t i = 0; i < datalen - 1; i++)  // sub the command
@@ -247,9 +450,12 @@ void GxEPD2_EPD::_writeCommandData(const uint8_t* pCommandData, uint8_t datalen)
 
 void GxEPD2_EPD::_writeCommandDataPGM(const uint8_t* pCommandData, uint8_t datalen)
 {
+  _waitAsync();
+  GxEPD2_COUNT(commands, 1);
   _beginTransaction(_spi_settings);
   if (_dc >= 0) digitalWrite(_dc, LOW);
   if (_cs >= 0) digitalWrite(_cs, LOW);
+  GxEPD2_COUNT(cs_selects, _cs >= 0);
   _spi_write(pgm_read_byte(&*pCommandData++));
   if (_dc >= 0) digitalWrite(_dc, HIGH);
   for (uint8_t i = 0; i < datalen - 1; i++)  // sub the command
@@ -262,8 +468,10 @@ void GxEPD2_EPD::_writeCommandDataPGM(const uint8_t* pCommandData, uint8_t datal
 
 void GxEPD2_EPD::_startTransfer()
 {
+  _waitAsync();
   _beginTransaction(_spi_settings);
   if (_cs >= 0) digitalWrite(_cs, LOW);
+  GxEPD2_COUNT(cs_selects, _cs >= 0);
 }
 
 void GxEPD2_EPD::_transfer(uint8_t value)
@@ -271,6 +479,61 @@ void GxEPD2_EPD::_transfer(uint8_t value)
   _spi_write(value);
 }
 
+void GxEPD2_EPD::_transferCommand(uint8_t c)
+{
+  if (_dc >= 0) digitalWrite(_dc, LOW);
+  _spi_write(c);
+  if (_dc >= 0) digitalWrite(_dc, HIGH);
+  GxEPD2_COUNT(commands, 1);
+}
+
+void GxEPD2_EPD::_writeCommandsPGM(const uint8_t* table, uint16_t size)
+{
+  _startTransfer();
+  for (uint16_t i = 0; i + 1 < size; )
+  {
+    uint8_t n = pgm_read_byte(&table[i + 1]);
+    _transferCommand(pgm_read_byte(&table[i]));
+    _transferBytes(table + i + 2, n, false, true);
+    i += 2 + n;
+  }
+  _endTransfer();
+}
+
+void GxEPD2_EPD::_transferBytes(const uint8_t* data, uint16_t n, bool invert, bool pgm)
+{
+  for (uint16_t i = 0; i < n; i++)
+  {
+    uint8_t d = pgm ? pgm_read_byte(&data[i]) : data[i];
+    _spi_write(invert ? ~d : d);
+  }
+}
+
+void GxEPD2_EPD::_transferFill(uint8_t value, uint32_t n)
+{
+  for (uint32_t i = 0; i < n; i++)
+  {
+    _spi_write(value);
+  }
+}
+
+void GxEPD2_EPD::_transferBytes(SPIClass& spi, const uint8_t* data, uint16_t n, bool invert, bool pgm)
+{
+  for (uint16_t i = 0; i < n; i++)
+  {
+    uint8_t d = pgm ? pgm_read_byte(&data[i]) : data[i];
+    spi.transfer(invert ? ~d : d);
+  }
+}
+
+void GxEPD2_EPD::_transferFill(SPIClass& spi, uint8_t value, uint32_t n)
+{
+  for (uint32_t i = 0; i < n; i++)
+  {
+    spi.transfer(value);
+  }
+}
+
 void GxEPD2_EPD::_endTransfer()
 {
   if (_cs >= 0) digitalWrite(_cs, HIGH);
@@ -279,11 +542,13 @@ void GxEPD2_EPD::_endTransfer()
 
 void GxEPD2_EPD::_beginTransaction(const SPISettings& settings)
 {
+  GxEPD2_COUNT(transactions, 1);
   if (_sck < 0) SPI.beginTransaction(settings);
 }
 
 void GxEPD2_EPD::_spi_write(uint8_t data)
 {
+  GxEPD2_COUNT(spi_bytes, 1);
   if (_sck < 0) SPI.transfer(data);
   else
   {
@@ -307,9 +572,11 @@ void GxEPD2_EPD::_endTransaction()
 
 uint8_t GxEPD2_EPD::_readData()
 {
+  _waitAsync();
   uint8_t data = 0;
   _beginTransaction(_spi_settings);
   if (_cs >= 0) digitalWrite(_cs, LOW);
+  GxEPD2_COUNT(cs_selects, _cs >= 0);
   if (_sck < 0)
   {
     data = SPI.transfer(0);
@@ -333,8 +600,10 @@ uint8_t GxEPD2_EPD::_readData()
 
 void GxEPD2_EPD::_readData(uint8_t* data, uint16_t n)
 {
+  _waitAsync();
   _beginTransaction(_spi_settings);
   if (_cs >= 0) digitalWrite(_cs, LOW);
+  GxEPD2_COUNT(cs_selects, _cs >= 0);
   if (_sck < 0)
   {
     for (uint8_t i = 0; i < n; i++)
@@ -0,0 +1,123 @@
+// GxEPD2_Benchmark.ino by Jean-Marc Zingg
+
+// purpose is to get repeatable numbers for changes to paging or transfer code
+// reports SPI bytes, transactions, CS selects, commands, BUSY waits and times for the common display operations
+
+// NOTE: needs ENABLE_GxEPD2_STATISTICS, uncomment it in GxEPD2_EPD.h of the library, else only the times are reported
+//       drivers with their own SPI code (GxEPD2_1248, GxEPD2_1248c, GxEPD2_1085_GDEM1085T51, IT8951) only count BUSY waits
+// see extras/host GxEPD2_HostBenchmark for the same with emulated panels on a Linux host
+
+// see GxEPD2_wiring_examples.h for wiring suggestions and examples
+// if you use a different wiring, you need to adapt the constructor parameters!
+
+#include <GxEPD2_BW.h>
+#include <GxEPD2_3C.h>
+#include <GxEPD2_4C.h>
+#include <GxEPD2_7C.h>
+
+// select the display class and display driver class in the following file (new style):
+#include "GxEPD2_display_selection_new_style.h"
+
+const uint16_t image_size = 32; // drawImage() bitmap, square
+uint8_t image[image_size * image_size / 8];
+
+uint32_t start_time;
+
+void setup()
+{
+  Serial.begin(115200);
+  Serial.println();
+  Serial.println("setup");
+  delay(100);
+  //display.init(115200); // default 10ms reset pulse, e.g. for bare panels with DESPI-C02
+  display.init(115200, true, 2, false); // USE THIS for Waveshare boards with "clever" reset circuit, 2ms reset pulse
+  for (uint16_t i = 0; i < sizeof(image); i++)
+  {
+    image[i] = ((i / (image_size / 8)) / 8) % 2 ? 0x0F : 0xF0; // 4x8 checkers
+  }
+  uint16_t x = 8 * (display.width() / 32), y = display.height() / 3, w = 8 * (display.width() / 16), h = display.height() / 4;
+  // measured after a first full update, as in normal use
+  pagedLoop();
+  Serial.println("operation        bytes  trans     cs  cmds busy  busy ms   total ms");
+  if (display.pageHeight() == display.height()) // full screen buffer
+  {
+    start();
+    display.display();
+    report("display()");
+    start();
+    display.display(true);
+    report("display(true)");
+    start();
+    display.displayWindow(x, y, w, h);
+    report("displayWindow");
+  }
+  else Serial.println("display(), display(true) and displayWindow need a full screen buffer");
+  start();
+  display.drawImage(image, x, y, image_size, image_size);
+  report("drawImage");
+  display.setFullWindow();
+  start();
+  pagedLoop();
+  report("paged full");
+  display.setPartialWindow(x, y, w, h);
+  start();
+  pagedLoop();
+  report("paged window");
+  display.hibernate();
+  Serial.println("setup done");
+}
+
+void loop()
+{
+}
+
+void drawPicture()
+{
+  display.fillScreen(GxEPD_WHITE);
+  display.fillRect(8, 8, display.width() / 3, display.height() / 4, GxEPD_BLACK);
+  for (int16_t y = display.height() / 2; y < display.height() - 8; y += 6)
+  {
+    display.drawFastHLine(3, y, display.width() - 13, GxEPD_BLACK);
+  }
+  if (display.epd2.hasColor) display.fillRect(display.width() / 2, display.height() / 3, 41, 23, GxEPD_RED);
+}
+
+void pagedLoop()
+{
+  display.firstPage();
+  do
+  {
+    drawPicture();
+  }
+  while (display.nextPage());
+}
+
+void start()
+{
+  display.epd2.resetStatistics();
+  start_time = micros();
+}
+
+void printColumn(uint32_t value, uint8_t width)
+{
+  uint8_t digits = 1;
+  for (uint32_t v = value; v >= 10; v /= 10) digits++;
+  while (digits++ < width) Serial.print(' ');
+  Serial.print(value);
+}
+
+void report(const char* operation)
+{
+  uint32_t elapsed = micros() - start_time;
+  GxEPD2_EPD::Statistics s = display.epd2.getStatistics();
+  Serial.print(operation);
+  for (uint8_t i = strlen(operation); i < 14; i++) Serial.print(' ');
+  printColumn(s.spi_bytes, 8);
+  printColumn(s.transactions, 7);
+  printColumn(s.cs_selects, 7);
+  printColumn(s.commands, 6);
+  printColumn(s.busy_waits, 5);
+  printColumn(s.busy_time_us / 1000, 9);
+  printColumn(elapsed / 1000, 11);
+  Serial.println();
+}
@@ -0,0 +1,671 @@
+// Display Library for SPI e-paper panels from Dalian Good Display and boards from Waveshare.
+// Requires HW SPI and Adafruit_GFX. Caution: the e-paper panels require 3.3V supply AND data lines!
+//
+// GxEPD2_16G: display class with 16 level grayscale for the IT8951 controller panels, 4 bpp pixel buffer
+// GxEPD_DARKGREY and GxEPD_LIGHTGREY and any RGB565 color are drawn as the nearest gray level of their luminance
+//
+// Author: Jean-Marc Zingg
+//
+// Version: see library.properties
+//
+// Library: https://github.com/ZinggJM/GxEPD2
+
+#ifndef _GxEPD2_16G_H_
+#define _GxEPD2_16G_H_
+// uncomment next line to use class GFX of library GFX_Root instead of Adafruit_GFX
+//#include <GFX.h>
+
+#ifndef ENABLE_GxEPD2_GFX
+// default is off
+#define ENABLE_GxEPD2_GFX 0
+#endif
+
+#if ENABLE_GxEPD2_GFX
+#include "GxEPD2_GFX.h"
+#define GxEPD2_GFX_BASE_CLASS GxEPD2_GFX
+#elif defined(_GFX_H_)
+#define GxEPD2_GFX_BASE_CLASS GFX
+#else
+#include <Adafruit_GFX.h>
+#define GxEPD2_GFX_BASE_CLASS Adafruit_GFX
+#endif
+
+#include "GxEPD2_EPD.h"
+#include "GxEPD2_ColorMap.h"
+
+// for __has_include see https://en.cppreference.com/w/cpp/preprocessor/include
+// see also https://gcc.gnu.org/onlinedocs/cpp/_005f_005fhas_005finclude.html
+// #if !defined(__has_include) || __has_include("epd/GxEPD2_102.h") is not portable!
+
+#if defined __has_include
+#  if __has_include("GxEPD2.h")
+#    // __has_include can be used
+#  else
+#    // __has_include doesn't work for us, include anyway
+#    undef __has_include
+#    define __has_include(x) true
+#  endif
+#else
+#  // no __has_include, include anyway
+#  define __has_include(x) true
+#endif
+
+#if __has_include("it8951/GxEPD2_it60.h")
+#include "it8951/GxEPD2_it60.h"
+#endif
+#if __has_include("it8951/GxEPD2_it60_1448x1072.h")
+#include "it8951/GxEPD2_it60_1448x1072.h"
+#endif
+#if __has_include("it8951/GxEPD2_it78_1872x1404.h")
+#include "it8951/GxEPD2_it78_1872x1404.h"
+#endif
+#if __has_include("it8951/GxEPD2_it103_1872x1404.h")
+#include "it8951/GxEPD2_it103_1872x1404.h"
+#endif
+
+template<typename GxEPD2_Type, const uint16_t page_height>
+class GxEPD2_16G : public GxEPD2_GFX_BASE_CLASS
+{
+  public:
+    GxEPD2_Type epd2;
+#if ENABLE_GxEPD2_GFX
+    GxEPD2_16G(GxEPD2_Type epd2_instance) : GxEPD2_GFX_BASE_CLASS(epd2, GxEPD2_Type::WIDTH, GxEPD2_Type::HEIGHT), epd2(epd2_instance)
+#else
+    GxEPD2_16G(GxEPD2_Type epd2_instance) : GxEPD2_GFX_BASE_CLASS(GxEPD2_Type::WIDTH, GxEPD2_Type::HEIGHT), epd2(epd2_instance)
+#endif
+    {
+      _setPageBuffer(_instance_buffer, sizeof(_instance_buffer) / pageBufferSize(1));
+      _mirror = false;
+      _pipeline_buffer = 0;
+      _async_power_off = false;
+      _using_partial_mode = false;
+      _current_page = 0;
+      setFullWindow();
+    }
+
+    uint16_t pages()
+    {
+      return _pages;
+    }
+
+    uint16_t pageHeight()
+    {
+      return _page_height;
+    }
+
+    // bytes of a page buffer with rows rows, e.g. pageBufferSize(HEIGHT) for a full screen buffer
+    static uint32_t pageBufferSize(uint16_t rows)
+    {
+      return uint32_t(GxEPD2_Type::WIDTH / 2) * rows;
+    }
+
+    // page buffer of the caller, e.g. on heap or in PSRAM, instead of the buffer of page_height rows of this instance;
+    // the page height follows at runtime, as many rows as fit into size, up to full screen; buffer 0 for the own buffer again
+    // with page_height 0 the own buffer has one row only; disables the pipeline buffer, set again as needed
+    void setPageBuffer(uint8_t* buffer, uint32_t size)
+    {
+      epd2.waitBackground();
+      uint32_t rows = buffer ? size / pageBufferSize(1) : 0;
+      if (rows > 0) _setPageBuffer(buffer, rows);
+      else _setPageBuffer(_instance_buffer, sizeof(_instance_buffer) / pageBufferSize(1));
+      _pipeline_buffer = 0;
+    }
+
+    // area of the (partial) window that the current page covers, in rotated and mirrored coordinates as for drawPixel()
+    // e.g. to decode or draw only what falls into this page, h or w is 0 if the page is outside the window
+    void getPageWindow(int16_t& x, int16_t& y, int16_t& w, int16_t& h)
+    {
+      int16_t ys = _current_page * _page_height;
+      int16_t ph = ys < _pw_h ? gx_uint16_min(_page_height, _pw_h - ys) : 0;
+      int16_t xs = (_pixel_mode & 2) ? _pixel_x0 - (_pw_w - 1) : _pixel_x0;
+      ys = (_pixel_mode & 1) ? _pixel_y0 - ys - (ph - 1) : _pixel_y0 + ys;
+      x = (_pixel_mode & 4) ? ys : xs;
+      y = (_pixel_mode & 4) ? xs : ys;
+      w = (_pixel_mode & 4) ? ph : _pw_w;
+      h = (_pixel_mode & 4) ? _pw_w : ph;
+    }
+
+    bool mirror(bool m)
+    {
+      _swap_ (_mirror, m);
+      _selectPixelWriter();
+      return m;
+    }
+
+    void drawPixel(int16_t x, int16_t y, uint16_t color)
+    {
+      if ((x < 0) || (x >= width()) || (y < 0) || (y >= height())) return;
+      (this->*_pixel_writer)(x, y, color);
+    }
+
+    void setRotation(uint8_t r)
+    {
+      GxEPD2_GFX_BASE_CLASS::setRotation(r);
+      _selectPixelWriter();
+    }
+
+    void init(uint32_t serial_diag_bitrate = 0) // = 0 : disabled
+    {
+      epd2.init(serial_diag_bitrate);
+      _using_partial_mode = false;
+      _current_page = 0;
+      setFullWindow();
+    }
+
+    // init method with additional parameters:
+    // initial false for re-init after processor deep sleep wake up, if display power supply was kept
+    // only relevant for b/w displays with fast partial update
+    // reset_duration = 20 is default; a value of 2 may help with "clever" reset circuit of newer boards from Waveshare
+    // pulldown_rst_mode true for alternate RST handling to avoid feeding 5V through RST pin
+    void init(uint32_t serial_diag_bitrate, bool initial, uint16_t reset_duration = 20, bool pulldown_rst_mode = false)
+    {
+      epd2.init(serial_diag_bitrate, initial, reset_duration, pulldown_rst_mode);
+      _using_partial_mode = false;
+      _current_page = 0;
+      setFullWindow();
+    }
+
+    // init method with additional parameters:
+    // SPIClass& spi: either SPI or alternate HW SPI channel
+    // SPISettings spi_settings: e.g. for higher SPI speed selection
+    void init(uint32_t serial_diag_bitrate, bool initial, uint16_t reset_duration, bool pulldown_rst_mode, SPIClass& spi, SPISettings spi_settings)
+    {
+      epd2.selectSPI(spi, spi_settings);
+      epd2.init(serial_diag_bitrate, initial, reset_duration, pulldown_rst_mode);
+      _using_partial_mode = false;
+      _current_page = 0;
+      setFullWindow();
+    }
+
+    // release SPI and control pins
+    void end() 
+    {
+      epd2.end();
+    }
+
+    void fillScreen(uint16_t color)
+    {
+      uint8_t pv = gray16(color);
+      uint8_t pv2 = pv | pv << 4;
+      for (uint32_t x = 0; x < _buffer_size; x++)
+      {
+        _pixel_buffer[x] = pv2;
+      }
+    }
+
+    // display buffer content to screen, useful for full screen buffer
+    void display(bool partial_update_mode = false)
+    {
+      if (partial_update_mode) epd2.writeGray(_pixel_buffer, 0, 0, GxEPD2_Type::WIDTH, _page_height);
+      else epd2.writeGrayForFullRefresh(_pixel_buffer, 0, 0, GxEPD2_Type::WIDTH, _page_height);
+      epd2.refresh(partial_update_mode);
+      if (!partial_update_mode) epd2.powerOff();
+    }
+
+    // non-blocking display(), for full screen buffer: returns after the refresh is started, see GxEPD2_EPD::refreshAsync()
+    // isBusy() polls and does what display() does after the refresh; the buffer must not change before isBusy() returns false
+    void displayAsync(bool partial_update_mode = false)
+    {
+      epd2.waitWhileBusy();
+      if (partial_update_mode) epd2.writeGray(_pixel_buffer, 0, 0, GxEPD2_Type::WIDTH, _page_height);
+      else epd2.writeGrayForFullRefresh(_pixel_buffer, 0, 0, GxEPD2_Type::WIDTH, _page_height);
+      _async_power_off = !partial_update_mode;
+      epd2.setAsyncStep(_asyncStep, this);
+      epd2.refreshAsync(partial_update_mode);
+    }
+
+    // true while a refresh or power off started by displayAsync() is ongoing
+    bool isBusy()
+    {
+      return epd2.isBusy();
+    }
+
+    // page pipeline for paged drawing: nextPage() hands a copy of the page to a background transfer and returns,
+    // the next page is drawn while the copy is transferred; background transfer on dual core ESP32, else right away
+    // buffer needs pipeline_buffer_size bytes, pageBufferSize(pageHeight()) with setPageBuffer(), 0 to disable
+    static const uint32_t pipeline_buffer_size = (GxEPD2_Type::WIDTH / 2) * page_height;
+    void setPipelineBuffer(uint8_t* buffer)
+    {
+      epd2.waitBackground();
+      _pipeline_buffer = (_pages > 1) ? buffer : 0;
+    }
+
+    // display part of buffer content to screen, useful for full screen buffer
+    // displayWindow, use parameters according to actual rotation.
+    // x and w should be multiple of 2, for rotation 0 or 2,
+    // y and h should be multiple of 2, for rotation 1 or 3,
+    // else window is increased as needed, to whole bytes of the 4 bpp buffer
+    void displayWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h)
+    {
+      x = gx_uint16_min(x, width());
+      y = gx_uint16_min(y, height());
+      w = gx_uint16_min(w, width() - x);
+      h = gx_uint16_min(h, height() - y);
+      _rotate(x, y, w, h);
+      epd2.writeGrayPart(_pixel_buffer, x, y, GxEPD2_Type::WIDTH, _page_height, x, y, w, h);
+      epd2.refresh(x, y, w, h);
+    }
+
+    void setFullWindow()
+    {
+      _using_partial_mode = false;
+      _pw_x = 0;
+      _pw_y = 0;
+      _pw_w = GxEPD2_Type::WIDTH;
+      _pw_h = HEIGHT;
+      _selectPixelWriter();
+    }
+
+    // setPartialWindow, use parameters according to actual rotation.
+    // x and w should be multiple of 2, for rotation 0 or 2,
+    // y and h should be multiple of 2, for rotation 1 or 3,
+    // else window is increased as needed, to whole bytes of the 4 bpp buffer
+    void setPartialWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h)
+    {
+      if (!epd2.hasPartialUpdate) return;
+      _pw_x = gx_uint16_min(x, width());
+      _pw_y = gx_uint16_min(y, height());
+      _pw_w = gx_uint16_min(w, width() - _pw_x);
+      _pw_h = gx_uint16_min(h, height() - _pw_y);
+      _rotate(_pw_x, _pw_y, _pw_w, _pw_h);
+      _using_partial_mode = true;
+      // make _pw_x, _pw_w multiple of 2
+      _pw_w += _pw_x % 2;
+      if (_pw_w % 2 > 0) _pw_w += 2 - _pw_w % 2;
+      _pw_x -= _pw_x % 2;
+      _selectPixelWriter();
+    }
+
+    void firstPage()
+    {
+      epd2.waitBackground(); // e.g. after a page loop left early
+      fillScreen(GxEPD_WHITE);
+      _current_page = 0;
+      _second_phase = false;
+    }
+
+    bool nextPage()
+    {
+      uint16_t page_ys = _current_page * _page_height;
+      if (_using_partial_mode)
+      {
+        //Serial.print("  nextPage("); Serial.print(_pw_x); Serial.print(", "); Serial.print(_pw_y); Serial.print(", ");
+        //Serial.print(_pw_w); Serial.print(", "); Serial.print(_pw_h); Serial.print(") P"); Serial.println(_current_page);
+        uint16_t page_ye = _current_page < int16_t(_pages - 1) ? page_ys + _page_height : HEIGHT;
+        uint16_t dest_ys = _pw_y + page_ys; // transposed
+        uint16_t dest_ye = gx_uint16_min(_pw_y + _pw_h, _pw_y + page_ye);
+        if (dest_ye > dest_ys)
+        {
+          //Serial.print("writeImage("); Serial.print(_pw_x); Serial.print(", "); Serial.print(dest_ys); Serial.print(", ");
+          //Serial.print(_pw_w); Serial.print(", "); Serial.print(dest_ye - dest_ys); Serial.println(")");
+          _writePage(false, _pw_x, dest_ys, _pw_w, dest_ye - dest_ys);
+        }
+        else
+        {
+          //Serial.print("writeImage("); Serial.print(_pw_x); Serial.print(", "); Serial.print(dest_ys); Serial.print(", ");
+          //Serial.print(_pw_w); Serial.print(", "); Serial.print(dest_ye - dest_ys); Serial.print(") skipped ");
+          //Serial.print(dest_ys); Serial.print(".."); Serial.println(dest_ye);
+        }
+        _current_page++;
+        if (_current_page == int16_t(_pages))
+        {
+          _current_page = 0;
+          epd2.waitBackground();
+          if (!_second_phase)
+          {
+            epd2.refresh(_pw_x, _pw_y, _pw_w, _pw_h);
+            if (epd2.hasFastPartialUpdate)
+            {
+              _second_phase = true;
+              return true;
+            }
+          }
+          return false;
+        }
+        fillScreen(GxEPD_WHITE);
+        return true;
+      }
+      else // full update
+      {
+        _writePage(true, 0, page_ys, GxEPD2_Type::WIDTH, gx_uint16_min(_page_height, HEIGHT - page_ys));
+        _current_page++;
+        if (_current_page == int16_t(_pages))
+        {
+          _current_page = 0;
+          epd2.waitBackground();
+          epd2.refresh(false); // full update
+          epd2.powerOff();
+          return false;
+        }
+        fillScreen(GxEPD_WHITE);
+        return true;
+      }
+    }
+
+    // GxEPD style paged drawing; drawCallback() is called as many times as needed
+    void drawPaged(void (*drawCallback)(const void*), const void* pv)
+    {
+      if (_using_partial_mode)
+      {
+        for (_current_page = 0; _current_page < _pages; _current_page++)
+        {
+          uint16_t page_ys = _current_page * _page_height;
+          uint16_t page_ye = _current_page < (_pages - 1) ? page_ys + _page_height : HEIGHT;
+          uint16_t dest_ys = _pw_y + page_ys; // transposed
+          uint16_t dest_ye = gx_uint16_min(_pw_y + _pw_h, _pw_y + page_ye);
+          if (dest_ye > dest_ys)
+          {
+            fillScreen(GxEPD_WHITE);
+            drawCallback(pv);
+            epd2.writeGray(_pixel_buffer, _pw_x, dest_ys, _pw_w, dest_ye - dest_ys);
+          }
+        }
+        epd2.refresh(_pw_x, _pw_y, _pw_w, _pw_h);
+      }
+      else // full update
+      {
+        for (_current_page = 0; _current_page < _pages; _current_page++)
+        {
+          uint16_t page_ys = _current_page * _page_height;
+          fillScreen(GxEPD_WHITE);
+          drawCallback(pv);
+          epd2.writeGrayForFullRefresh(_pixel_buffer, 0, page_ys, GxEPD2_Type::WIDTH, gx_uint16_min(_page_height, HEIGHT - page_ys));
+        }
+        epd2.refresh(false); // full update
+        epd2.powerOff();
+      }
+      _current_page = 0;
+    }
+
+    void drawInvertedBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w, int16_t h, uint16_t color)
+    {
+      // taken from Adafruit_GFX.cpp, modified
+      int16_t byteWidth = (w + 7) / 8; // Bitmap scanline pad = whole byte
+      uint8_t byte = 0;
+      for (int16_t j = 0; j < h; j++)
+      {
+        for (int16_t i = 0; i < w; i++ )
+        {
+          if (i & 7) byte <<= 1;
+          else
+          {
+#if defined(__AVR) || defined(ESP8266) || defined(ESP32)
+            byte = pgm_read_byte(&bitmap[j * byteWidth + i / 8]);
+#else
+            byte = bitmap[j * byteWidth + i / 8];
+#endif
+          }
+          if (!(byte & 0x80))
+          {
+            drawPixel(x + i, y + j, color);
+          }
+        }
+      }
+    }
+
+    //  Support for Bitmaps (Sprites) to Controller Buffer and to Screen
+    void clearScreen(uint8_t value = 0xFF) // init controller memory and screen (default white)
+    {
+      epd2.clearScreen(value);
+    }
+    void writeScreenBuffer(uint8_t value = 0xFF) // init controller memory (default white)
+    {
+      epd2.writeScreenBuffer(value);
+    }
+    // write to controller memory, without screen refresh; x and w should be multiple of 8
+    void writeImage(const uint8_t bitmap[], int16_t x, int16_t y, int16_t w, int16_t h, bool invert = false, bool mirror_y = false, bool pgm = false)
+    {
+      epd2.writeImage(bitmap, x, y, w, h, invert, mirror_y, pgm);
+    }
+    void writeImagePart(const uint8_t bitmap[], int16_t x_part, int16_t y_part, int16_t w_bitmap, int16_t h_bitmap,
+                        int16_t x, int16_t y, int16_t w, int16_t h, bool invert = false, bool mirror_y = false, bool pgm = false)
+    {
+      epd2.writeImagePart(bitmap, x_part, y_part, w_bitmap, h_bitmap, x, y, w, h, invert, mirror_y, pgm);
+    }
+    void writeImage(const uint8_t* black, const uint8_t* color, int16_t x, int16_t y, int16_t w, int16_t h, bool invert, bool mirror_y, bool pgm)
+    {
+      epd2.writeImage(black, color, x, y, w, h, invert, mirror_y, pgm);
+    }
+    void writeImage(const uint8_t* black, const uint8_t* color, int16_t x, int16_t y, int16_t w, int16_t h)
+    {
+      epd2.writeImage(black, color, x, y, w, h, false, false, false);
+    }
+    void writeImagePart(const uint8_t* black, const uint8_t* color, int16_t x_part, int16_t y_part, int16_t w_bitmap, int16_t h_bitmap,
+                        int16_t x, int16_t y, int16_t w, int16_t h, bool invert, bool mirror_y, bool pgm)
+    {
+      epd2.writeImagePart(black, color, x_part, y_part, w_bitmap, h_bitmap, x, y, w, h, invert, mirror_y, pgm);
+    }
+    void writeImagePart(const uint8_t* black, const uint8_t* color, int16_t x_part, int16_t y_part, int16_t w_bitmap, int16_t h_bitmap,
+                        int16_t x, int16_t y, int16_t w, int16_t h)
+    {
+      epd2.writeImagePart(black, color, x_part, y_part, w_bitmap, h_bitmap, x, y, w, h, false, false, false);
+    }
+    // write sprite of native data to controller memory, without screen refresh; x and w should be multiple of 8
+    void writeNative(const uint8_t* data1, const uint8_t* data2, int16_t x, int16_t y, int16_t w, int16_t h, bool invert, bool mirror_y, bool pgm)
+    {
+      epd2.writeNative(data1, data2, x, y, w, h, invert, mirror_y, pgm);
+    }
+    // write sprite of 4 bpp grayscale to controller memory, without screen refresh; 2 pixels per byte, first in the high nibble, 0 black to 15 white
+    void writeGray(const uint8_t* data, int16_t x, int16_t y, int16_t w, int16_t h, bool invert = false, bool mirror_y = false, bool pgm = false)
+    {
+      epd2.writeGray(data, x, y, w, h, invert, mirror_y, pgm);
+    }
+    void writeGrayPart(const uint8_t* data, int16_t x_part, int16_t y_part, int16_t w_bitmap, int16_t h_bitmap,
+                       int16_t x, int16_t y, int16_t w, int16_t h, bool invert = false, bool mirror_y = false, bool pgm = false)
+    {
+      epd2.writeGrayPart(data, x_part, y_part, w_bitmap, h_bitmap, x, y, w, h, invert, mirror_y, pgm);
+    }
+    // write to controller memory, with screen refresh; x and w should be multiple of 8
+    void drawImage(const uint8_t bitmap[], int16_t x, int16_t y, int16_t w, int16_t h, bool invert = false, bool mirror_y = false, bool pgm = false)
+    {
+      epd2.drawImage(bitmap, x, y, w, h, invert, mirror_y, pgm);
+    }
+    void drawImagePart(const uint8_t bitmap[], int16_t x_part, int16_t y_part, int16_t w_bitmap, int16_t h_bitmap,
+                       int16_t x, int16_t y, int16_t w, int16_t h, bool invert = false, bool mirror_y = false, bool pgm = false)
+    {
+      epd2.drawImagePart(bitmap, x_part, y_part, w_bitmap, h_bitmap, x, y, w, h, invert, mirror_y, pgm);
+    }
+    void drawImage(const uint8_t* black, const uint8_t* color, int16_t x, int16_t y, int16_t w, int16_t h, bool invert, bool mirror_y, bool pgm)
+    {
+      epd2.drawImage(black, color, x, y, w, h, invert, mirror_y, pgm);
+    }
+    void drawImage(const uint8_t* black, const uint8_t* color, int16_t x, int16_t y, int16_t w, int16_t h)
+    {
+      epd2.drawImage(black, color, x, y, w, h, false, false, false);
+    }
+    void drawImagePart(const uint8_t* black, const uint8_t* color, int16_t x_part, int16_t y_part, int16_t w_bitmap, int16_t h_bitmap,
+                       int16_t x, int16_t y, int16_t w, int16_t h, bool invert, bool mirror_y, bool pgm)
+    {
+      epd2.drawImagePart(black, color, x_part, y_part, w_bitmap, h_bitmap, x, y, w, h, invert, mirror_y, pgm);
+    }
+    void drawImagePart(const uint8_t* black, const uint8_t* color, int16_t x_part, int16_t y_part, int16_t w_bitmap, int16_t h_bitmap,
+                       int16_t x, int16_t y, int16_t w, int16_t h)
+    {
+      epd2.drawImagePart(black, color, x_part, y_part, w_bitmap, h_bitmap, x, y, w, h, false, false, false);
+    }
+    // write sprite of native data to controller memory, with screen refresh; x and w should be multiple of 8
+    void drawNative(const uint8_t* data1, const uint8_t* data2, int16_t x, int16_t y, int16_t w, int16_t h, bool invert, bool mirror_y, bool pgm)
+    {
+      epd2.drawNative(data1, data2, x, y, w, h, invert, mirror_y, pgm);
+    }
+    // write sprite of 4 bpp grayscale to controller memory, with screen refresh
+    void drawGray(const uint8_t* data, int16_t x, int16_t y, int16_t w, int16_t h, bool invert = false, bool mirror_y = false, bool pgm = false)
+    {
+      epd2.drawGray(data, x, y, w, h, invert, mirror_y, pgm);
+    }
+    void refresh(bool partial_update_mode = false) // screen refresh from controller memory to full screen
+    {
+      epd2.refresh(partial_update_mode);
+      if (!partial_update_mode) epd2.powerOff();
+    }
+    void refresh(int16_t x, int16_t y, int16_t w, int16_t h) // screen refresh from controller memory, partial screen
+    {
+      epd2.refresh(x, y, w, h);
+    }
+    // turns off generation of panel driving voltages, avoids screen fading over time
+    void powerOff()
+    {
+      epd2.powerOff();
+    }
+    // turns powerOff() and sets controller to deep sleep for minimum power use, ONLY if wakeable by RST (rst >= 0)
+    void hibernate()
+    {
+      epd2.hibernate();
+    }
+  private:
+    template <typename T> static inline void
+    _swap_(T & a, T & b)
+    {
+      T t = a;
+      a = b;
+      b = t;
+    };
+    static inline uint16_t gx_uint16_min(uint16_t a, uint16_t b)
+    {
+      return (a < b ? a : b);
+    };
+    static inline uint16_t gx_uint16_max(uint16_t a, uint16_t b)
+    {
+      return (a > b ? a : b);
+    };
+    void _rotate(uint16_t& x, uint16_t& y, uint16_t& w, uint16_t& h)
+    {
+      switch (getRotation())
+      {
+        case 1:
+          _swap_(x, y);
+          _swap_(w, h);
+          x = WIDTH - x - w;
+          break;
+        case 2:
+          x = WIDTH - x - w;
+          y = HEIGHT - y - h;
+          break;
+        case 3:
+          _swap_(x, y);
+          _swap_(w, h);
+          y = HEIGHT - y - h;
+          break;
+      }
+    }
+    uint8_t gray16(uint16_t color)
+    {
+      return GxEPD2_ColorMap::gray16(color);
+    }
+    // completion steps of displayAsync(), called by epd2 when the refresh is done
+    static void _asyncStep(void* display)
+    {
+      GxEPD2_16G* self = static_cast<GxEPD2_16G*>(display);
+      if (self->_async_power_off)
+      {
+        self->_async_power_off = false;
+        self->epd2.powerOffAsync();
+      }
+    }
+    // drawPixel() for one orientation, rotation and mirror reduce to swap and flip of x and y, see _selectPixelWriter()
+    template <bool swap, bool flip_x, bool flip_y> void _writePixel(int16_t x, int16_t y, uint16_t color)
+    {
+      if (swap) _swap_(x, y);
+      // transpose partial window to 0,0
+      x = flip_x ? _pixel_x0 - x : x - _pixel_x0;
+      y = flip_y ? _pixel_y0 - y : y - _pixel_y0;
+      // clip to (partial) window
+      if ((uint16_t(x) >= _pw_w) || (uint16_t(y) >= _pw_h)) return;
+      // adjust for current page
+      y -= _current_page * _page_height;
+      // check if in current page
+      if (uint16_t(y) >= _page_height) return;
+      uint32_t i = x / 2 + uint32_t(y) * (_pw_w / 2);
+      uint8_t pv = gray16(color);
+      if (x & 1) _pixel_buffer[i] = (_pixel_buffer[i] & 0xF0) | pv;
+      else _pixel_buffer[i] = (_pixel_buffer[i] & 0x0F) | (pv << 4);
+    }
+    // selects the _writePixel() instance for rotation, mirror and window; called on any change of these
+    void _selectPixelWriter()
+    {
+      bool swap = false, flip_x = _mirror, flip_y = false;
+      switch (getRotation())
+      {
+        case 1:
+          swap = true;
+          flip_x = true;
+          flip_y = _mirror;
+          break;
+        case 2:
+          flip_x = !_mirror;
+          flip_y = true;
+          break;
+        case 3:
+          swap = true;
+          flip_x = false;
+          flip_y = !_mirror;
+          break;
+      }
+      _pixel_x0 = flip_x ? WIDTH - 1 - _pw_x : _pw_x;
+      _pixel_y0 = flip_y ? HEIGHT - 1 - _pw_y : _pw_y;
+      _pixel_mode = (swap << 2) | (flip_x << 1) | flip_y;
+      switch (_pixel_mode)
+      {
+        case 0: _pixel_writer = &GxEPD2_16G::_writePixel<false, false, false>; break;
+        case 1: _pixel_writer = &GxEPD2_16G::_writePixel<false, false, true>; break;
+        case 2: _pixel_writer = &GxEPD2_16G::_writePixel<false, true, false>; break;
+        case 3: _pixel_writer = &GxEPD2_16G::_writePixel<false, true, true>; break;
+        case 4: _pixel_writer = &GxEPD2_16G::_writePixel<true, false, false>; break;
+        case 5: _pixel_writer = &GxEPD2_16G::_writePixel<true, false, true>; break;
+        case 6: _pixel_writer = &GxEPD2_16G::_writePixel<true, true, false>; break;
+        case 7: _pixel_writer = &GxEPD2_16G::_writePixel<true, true, true>; break;
+      }
+    }
+    // writes the page, or a copy of it in the background if the page pipeline is enabled; full for a full refresh
+    void _writePage(bool full, int16_t x, int16_t y, int16_t w, int16_t h)
+    {
+      if (!_pipeline_buffer)
+      {
+        _writePage(_pixel_buffer, full, x, y, w, h);
+        return;
+      }
+      epd2.waitBackground(); // previous page is transferred
+      memcpy(_pipeline_buffer, _pixel_buffer, _buffer_size);
+      _pipeline_full = full;
+      _pipeline_x = x;
+      _pipeline_y = y;
+      _pipeline_w = w;
+      _pipeline_h = h;
+      epd2.runInBackground(_pipelineJob, this);
+    }
+    static void _pipelineJob(void* p)
+    {
+      GxEPD2_16G* d = static_cast<GxEPD2_16G*>(p);
+      d->_writePage(d->_pipeline_buffer, d->_pipeline_full, d->_pipeline_x, d->_pipeline_y, d->_pipeline_w, d->_pipeline_h);
+    }
+    void _writePage(const uint8_t* page, bool full, int16_t x, int16_t y, int16_t w, int16_t h)
+    {
+      if (full) epd2.writeGrayForFullRefresh(page, x, y, w, h);
+      else epd2.writeGray(page, x, y, w, h);
+    }
+    void _setPageBuffer(uint8_t* buffer, uint32_t rows)
+    {
+      _page_height = rows < uint32_t(HEIGHT) ? rows : HEIGHT;
+      _pages = (HEIGHT / _page_height) + ((HEIGHT % _page_height) > 0);
+      _pixel_buffer = buffer;
+      _buffer_size = pageBufferSize(_page_height);
+      _current_page = 0;
+    }
+  private:
+    uint8_t _instance_buffer[(GxEPD2_Type::WIDTH / 2) * (page_height > 0 ? page_height : 1)];
+    uint8_t* _pixel_buffer; // page buffer, of this instance or of the caller
+    uint32_t _buffer_size;
+    bool _using_partial_mode, _second_phase, _mirror;
+    int16_t _current_page;
+    uint16_t _pages, _page_height;
+    uint16_t _pw_x, _pw_y, _pw_w, _pw_h;
+    void (GxEPD2_16G::*_pixel_writer)(int16_t x, int16_t y, uint16_t color);
+    bool _async_power_off;
+    uint8_t* _pipeline_buffer;
+    bool _pipeline_full;
+    int16_t _pipeline_x, _pipeline_y, _pipeline_w, _pipeline_h;
+    int16_t _pixel_x0, _pixel_y0; // window origin, for flip from the opposite side
+    uint8_t _pixel_mode; // swap, flip_x, flip_y of the selected writer
+};
+
+#endif
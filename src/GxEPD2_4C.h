@@ -30,6 +30,7 @@
 #endif
 
 #include "GxEPD2_EPD.h"
+#include "GxEPD2_ColorMap.h"
 
 // for __has_include see https://en.cppreference.com/w/cpp/preprocessor/include
 // see also https://gcc.gnu.org/onlinedocs/cpp/_005f_005fhas_005finclude.html
@@ -87,9 +88,10 @@ class GxEPD2_4C : public GxEPD2_GFX_BASE_CLASS
     GxEPD2_4C(GxEPD2_Type epd2_instance) : GxEPD2_GFX_BASE_CLASS(GxEPD2_Type::WIDTH_VISIBLE, GxEPD2_Type::HEIGHT), epd2(epd2_instance)
 #endif
     {
-      _page_height = page_height;
-      _pages = (HEIGHT / _page_height) + ((HEIGHT % _page_height) > 0);
+      _setPageBuffer(_instance_buffer, sizeof(_instance_buffer) / pageBufferSize(1));
       _mirror = false;
+      _pipeline_buffer = 0;
+      _async_power_off = false;
       _using_partial_mode = false;
       _current_page = 0;
       setFullWindow();
@@ -105,50 +107,55 @@ class GxEPD2_4C : public GxEPD2_GFX_BASE_CLASS
       return _page_height;
     }
 
+    // bytes of a page buffer with rows rows, e.g. pageBufferSize(HEIGHT) for a full screen buffer
+    static uint32_t pageBufferSize(uint16_t rows)
+    {
+      return uint32_t(GxEPD2_Type::WIDTH / 4) * rows;
+    }
+
+    // page buffer of the caller, e.g. on heap or in PSRAM, instead of the buffer of page_height rows of this instance;
+    // the page height follows at runtime, as many rows as fit into size, up to full screen; buffer 0 for the own buffer again
+    // with page_height 0 the own buffer has one row only; disables the pipeline buffer, set again as needed
+    void setPageBuffer(uint8_t* buffer, uint32_t size)
+    {
+      epd2.waitBackground();
+      uint32_t rows = buffer ? size / pageBufferSize(1) : 0;
+      if (rows > 0) _setPageBuffer(buffer, rows);
+      else _setPageBuffer(_instance_buffer, sizeof(_instance_buffer) / pageBufferSize(1));
+      _pipeline_buffer = 0;
+    }
+
+    // area of the (partial) window that the current page covers, in rotated and mirrored coordinates as for drawPixel()
+    // e.g. to decode or draw only what falls into this page, h or w is 0 if the page is outside the window
+    void getPageWindow(int16_t& x, int16_t& y, int16_t& w, int16_t& h)
+    {
+      int16_t ys = _current_page * _page_height;
+      int16_t ph = ys < _pw_h ? gx_uint16_min(_page_height, _pw_h - ys) : 0;
+      int16_t xs = (_pixel_mode & 2) ? _pixel_x0 - (_pw_w - 1) : _pixel_x0;
+      ys = (_pixel_mode & 1) ? _pixel_y0 - ys - (ph - 1) : _pixel_y0 + ys;
+      x = (_pixel_mode & 4) ? ys : xs;
+      y = (_pixel_mode & 4) ? xs : ys;
+      w = (_pixel_mode & 4) ? ph : _pw_w;
+      h = (_pixel_mode & 4) ? _pw_w : ph;
+    }
+
     bool mirror(bool m)
     {
       _swap_ (_mirror, m);
+      _selectPixelWriter();
       return m;
     }
 
     void drawPixel(int16_t x, int16_t y, uint16_t color)
     {
       if ((x < 0) || (x >= width()) || (y < 0) || (y >= height())) return;
-      if (_mirror) x = width() - x - 1;
-      // check rotation, move pixel around if necessary
-      switch (getRotation())
-      {
-        case 1:
-          _swap_(x, y);
-          x = WIDTH - x - 1;
-          break;
-        case 2:
-          x = WIDTH - x - 1;
-          y = HEIGHT - y - 1;
-          break;
-        case 3:
-          _swap_(x, y);
-          y = HEIGHT - y - 1;
-          break;
-      }
-      // transpose partial window to 0,0
-      x -= _pw_x;
-      y -= _pw_y;
-      // clip to (partial) window
-      if ((x < 0) || (x >= int16_t(_pw_w)) || (y < 0) || (y >= int16_t(_pw_h))) return;
-      // adjust for current page
-      y -= _current_page * _page_height;
-      // check if in current page
-      if ((y < 0) || (y >= int16_t(_page_height))) return;
-      uint32_t i = x / 4 + uint32_t(y) * (_pw_w / 4);
-      uint8_t pv = color4(color);
-      switch(x % 4)
-      {
-        case 0: _pixel_buffer[i] = (_pixel_buffer[i] & 0x3F) | (pv << 6); break;
-        case 1: _pixel_buffer[i] = (_pixel_buffer[i] & 0xCF) | (pv << 4); break;
-        case 2: _pixel_buffer[i] = (_pixel_buffer[i] & 0xF3) | (pv << 2); break;
-        case 3: _pixel_buffer[i] = (_pixel_buffer[i] & 0xFC) | pv; break;
-      }
+      (this->*_pixel_writer)(x, y, color);
+    }
+
+    void setRotation(uint8_t r)
+    {
+      GxEPD2_GFX_BASE_CLASS::setRotation(r);
+      _selectPixelWriter();
     }
 
     void init(uint32_t serial_diag_bitrate = 0) // = 0 : disabled
@@ -193,7 +200,7 @@ class GxEPD2_4C : public GxEPD2_GFX_BASE_CLASS
     void fillScreen(uint16_t color)
     {
       uint8_t pv = color4(color) * 0x55; // 0b01010101
-      for (uint32_t x = 0; x < sizeof(_pixel_buffer); x++)
+      for (uint32_t x = 0; x < _buffer_size; x++)
       {
         _pixel_buffer[x] = pv;
       }
@@ -207,6 +214,33 @@ class GxEPD2_4C : public GxEPD2_GFX_BASE_CLASS
       if (!partial_update_mode) epd2.powerOff();
     }
 
+    // non-blocking display(), for full screen buffer: returns after the refresh is started, see GxEPD2_EPD::refreshAsync()
+    // isBusy() polls and does what display() does after the refresh; the buffer must not change before isBusy() returns false
+    void displayAsync(bool partial_update_mode = false)
+    {
+      epd2.waitWhileBusy();
+      epd2.writeNative(_pixel_buffer, 0, 0, 0, GxEPD2_Type::WIDTH, _page_height);
+      _async_power_off = !partial_update_mode;
+      epd2.setAsyncStep(_asyncStep, this);
+      epd2.refreshAsync(partial_update_mode);
+    }
+
+    // true while a refresh or power off started by displayAsync() is ongoing
+    bool isBusy()
+    {
+      return epd2.isBusy();
+    }
+
+    // page pipeline for paged drawing: nextPage() hands a copy of the page to a background transfer and returns,
+    // the next page is drawn while the copy is transferred; background transfer on dual core ESP32, else right away
+    // buffer needs pipeline_buffer_size bytes, pageBufferSize(pageHeight()) with setPageBuffer(), 0 to disable
+    static const uint32_t pipeline_buffer_size = (GxEPD2_Type::WIDTH / 4) * page_height;
+    void setPipelineBuffer(uint8_t* buffer)
+    {
+      epd2.waitBackground();
+      _pipeline_buffer = (_pages > 1) ? buffer : 0;
+    }
+
     // display part of buffer content to screen, useful for full screen buffer
     // displayWindow, use parameters according to actual rotation.
     // x and w should be multiple of 8, for rotation 0 or 2,
@@ -231,6 +265,7 @@ class GxEPD2_4C : public GxEPD2_GFX_BASE_CLASS
       _pw_y = 0;
       _pw_w = GxEPD2_Type::WIDTH;
       _pw_h = HEIGHT;
+      _selectPixelWriter();
     }
 
     // setPartialWindow, use parameters according to actual rotation.
@@ -251,10 +286,12 @@ class GxEPD2_4C : public GxEPD2_GFX_BASE_CLASS
       _pw_w += _pw_x % 4;
       if (_pw_w % 4 > 0) _pw_w += 4 - _pw_w % 4;
       _pw_x -= _pw_x % 4;
+      _selectPixelWriter();
     }
 
     void firstPage()
     {
+      epd2.waitBackground(); // e.g. after a page loop left early
       fillScreen(GxEPD_WHITE);
       _current_page = 0;
       _second_phase = false;
@@ -275,7 +312,7 @@ class GxEPD2_4C : public GxEPD2_GFX_BASE_CLASS
         {
           //Serial.print("writeImage("); Serial.print(_pw_x); Serial.print(", "); Serial.print(dest_ys); Serial.print(", ");
           //Serial.print(_pw_w); Serial.print(", "); Serial.print(dest_ye - dest_ys); Serial.println(")");
-          epd2.writeNative(_pixel_buffer, 0, _pw_x, dest_ys, _pw_w, dest_ye - dest_ys);
+          _writePage(_pw_x, dest_ys, _pw_w, dest_ye - dest_ys);
         }
         else
         {
@@ -287,6 +324,7 @@ class GxEPD2_4C : public GxEPD2_GFX_BASE_CLASS
         if (_current_page == int16_t(_pages))
         {
           _current_page = 0;
+          epd2.waitBackground();
           if (!_second_phase)
           {
             epd2.refresh(_pw_x, _pw_y, _pw_w, _pw_h);
@@ -303,11 +341,12 @@ class GxEPD2_4C : public GxEPD2_GFX_BASE_CLASS
       }
       else // full update
       {
-        epd2.writeNative(_pixel_buffer, 0, 0, page_ys, GxEPD2_Type::WIDTH, gx_uint16_min(_page_height, HEIGHT - page_ys));
+        _writePage(0, page_ys, GxEPD2_Type::WIDTH, gx_uint16_min(_page_height, HEIGHT - page_ys));
         _current_page++;
         if (_current_page == int16_t(_pages))
         {
           _current_page = 0;
+          epd2.waitBackground();
           if ((epd2.panel == GxEPD2::GDEW0154Z04) && (_pages > 1))
           {
             if (!_second_phase)
@@ -521,46 +560,121 @@ class GxEPD2_4C : public GxEPD2_GFX_BASE_CLASS
     }
     uint8_t color4(uint16_t color)
     {
-      static uint16_t _prev_color = GxEPD_BLACK;
-      static uint8_t _prev_color4 = 0x00; // black
-      if (color == _prev_color) return _prev_color4;
-      uint8_t cv4 = 0x00;
-      switch (color)
+      return GxEPD2_ColorMap::color4(color);
+    }
+    // completion steps of displayAsync(), called by epd2 when the refresh is done
+    static void _asyncStep(void* display)
+    {
+      GxEPD2_4C* self = static_cast<GxEPD2_4C*>(display);
+      if (self->_async_power_off)
       {
-        case GxEPD_BLACK: cv4 = 0x00; break;
-        case GxEPD_WHITE: cv4 = 0x01; break;
-        case GxEPD_GREEN: cv4 = 0x02; break; // use yellow?
-        case GxEPD_BLUE:  cv4 = 0x00; break; // use black
-        case GxEPD_RED:   cv4 = 0x03; break;
-        case GxEPD_YELLOW: cv4 = 0x02; break;
-        case GxEPD_ORANGE: cv4 = 0x02; break; // use yellow?
-        default:
-          {
-            uint16_t red = color & 0xF800;
-            uint16_t green = (color & 0x07E0) << 5;
-            uint16_t blue = (color & 0x001F) << 11;
-            if ((red < 0x8000) && (green < 0x8000) && (blue < 0x8000)) cv4 = 0x00; // black
-            else if ((red >= 0x8000) && (green >= 0x8000) && (blue >= 0x8000)) cv4 = 0x01; // white
-            else if ((red >= 0x8000) && (blue >= 0x8000)) cv4 = 0x03; //  red, blue > red
-            else if ((green >= 0x8000) && (blue >= 0x8000)) cv4 = 0x01; //  green, blue > white
-            else if ((red >= 0x8000) && (green >= 0xC000)) cv4 = 0x02; // yellow
-            else if ((red >= 0x8000) && (green >= 0x4000)) cv4 = 0x03; // orange > red
-            else if (red >= 0x8000) cv4 = 0x03; // red
-            else if (green >= 0x8000) cv4 = 0x00; // green > black
-            else cv4 = 0x03; // blue
-          }
+        self->_async_power_off = false;
+        self->epd2.powerOffAsync();
       }
-      _prev_color = color;
-      _prev_color4 = cv4;
-      return cv4;
+    }
+    // drawPixel() for one orientation, rotation and mirror reduce to swap and flip of x and y, see _selectPixelWriter()
+    template <bool swap, bool flip_x, bool flip_y> void _writePixel(int16_t x, int16_t y, uint16_t color)
+    {
+      if (swap) _swap_(x, y);
+      // transpose partial window to 0,0
+      x = flip_x ? _pixel_x0 - x : x - _pixel_x0;
+      y = flip_y ? _pixel_y0 - y : y - _pixel_y0;
+      // clip to (partial) window
+      if ((uint16_t(x) >= _pw_w) || (uint16_t(y) >= _pw_h)) return;
+      // adjust for current page
+      y -= _current_page * _page_height;
+      // check if in current page
+      if (uint16_t(y) >= _page_height) return;
+      uint32_t i = x / 4 + uint32_t(y) * (_pw_w / 4);
+      uint8_t pv = color4(color);
+      switch(x % 4)
+      {
+        case 0: _pixel_buffer[i] = (_pixel_buffer[i] & 0x3F) | (pv << 6); break;
+        case 1: _pixel_buffer[i] = (_pixel_buffer[i] & 0xCF) | (pv << 4); break;
+        case 2: _pixel_buffer[i] = (_pixel_buffer[i] & 0xF3) | (pv << 2); break;
+        case 3: _pixel_buffer[i] = (_pixel_buffer[i] & 0xFC) | pv; break;
+      }
+    }
+    // selects the _writePixel() instance for rotation, mirror and window; called on any change of these
+    void _selectPixelWriter()
+    {
+      bool swap = false, flip_x = _mirror, flip_y = false;
+      switch (getRotation())
+      {
+        case 1:
+          swap = true;
+          flip_x = true;
+          flip_y = _mirror;
+          break;
+        case 2:
+          flip_x = !_mirror;
+          flip_y = true;
+          break;
+        case 3:
+          swap = true;
+          flip_x = false;
+          flip_y = !_mirror;
+          break;
+      }
+      _pixel_x0 = flip_x ? WIDTH - 1 - _pw_x : _pw_x;
+      _pixel_y0 = flip_y ? HEIGHT - 1 - _pw_y : _pw_y;
+      _pixel_mode = (swap << 2) | (flip_x << 1) | flip_y;
+      switch (_pixel_mode)
+      {
+        case 0: _pixel_writer = &GxEPD2_4C::_writePixel<false, false, false>; break;
+        case 1: _pixel_writer = &GxEPD2_4C::_writePixel<false, false, true>; break;
+        case 2: _pixel_writer = &GxEPD2_4C::_writePixel<false, true, false>; break;
+        case 3: _pixel_writer = &GxEPD2_4C::_writePixel<false, true, true>; break;
+        case 4: _pixel_writer = &GxEPD2_4C::_writePixel<true, false, false>; break;
+        case 5: _pixel_writer = &GxEPD2_4C::_writePixel<true, false, true>; break;
+        case 6: _pixel_writer = &GxEPD2_4C::_writePixel<true, true, false>; break;
+        case 7: _pixel_writer = &GxEPD2_4C::_writePixel<true, true, true>; break;
+      }
+    }
+    // writes the page, or a copy of it in the background if the page pipeline is enabled
+    void _writePage(int16_t x, int16_t y, int16_t w, int16_t h)
+    {
+      if (!_pipeline_buffer)
+      {
+        epd2.writeNative(_pixel_buffer, 0, x, y, w, h);
+        return;
+      }
+      epd2.waitBackground(); // previous page is transferred
+      memcpy(_pipeline_buffer, _pixel_buffer, _buffer_size);
+      _pipeline_x = x;
+      _pipeline_y = y;
+      _pipeline_w = w;
+      _pipeline_h = h;
+      epd2.runInBackground(_pipelineJob, this);
+    }
+    static void _pipelineJob(void* p)
+    {
+      GxEPD2_4C* d = static_cast<GxEPD2_4C*>(p);
+      d->epd2.writeNative(d->_pipeline_buffer, 0, d->_pipeline_x, d->_pipeline_y, d->_pipeline_w, d->_pipeline_h);
+    }
+    void _setPageBuffer(uint8_t* buffer, uint32_t rows)
+    {
+      _page_height = rows < uint32_t(HEIGHT) ? rows : HEIGHT;
+      _pages = (HEIGHT / _page_height) + ((HEIGHT % _page_height) > 0);
+      _pixel_buffer = buffer;
+      _buffer_size = pageBufferSize(_page_height);
+      _current_page = 0;
     }
   private:
-    uint8_t _pixel_buffer[(GxEPD2_Type::WIDTH / 4) * page_height];
+    uint8_t _instance_buffer[(GxEPD2_Type::WIDTH / 4) * (page_height > 0 ? page_height : 1)];
+    uint8_t* _pixel_buffer; // page buffer, of this instance or of the caller
+    uint32_t _buffer_size;
     bool _using_partial_mode, _second_phase, _mirror;
     uint16_t _width_bytes, _pixel_bytes;
     int16_t _current_page;
     uint16_t _pages, _page_height;
     uint16_t _pw_x, _pw_y, _pw_w, _pw_h;
+    void (GxEPD2_4C::*_pixel_writer)(int16_t x, int16_t y, uint16_t color);
+    bool _async_power_off;
+    uint8_t* _pipeline_buffer;
+    int16_t _pipeline_x, _pipeline_y, _pipeline_w, _pipeline_h;
+    int16_t _pixel_x0, _pixel_y0; // window origin, for flip from the opposite side
+    uint8_t _pixel_mode; // swap, flip_x, flip_y of the selected writer
 };
 
 #endif
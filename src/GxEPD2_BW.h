@@ -244,13 +244,23 @@ class GxEPD2_BW : public GxEPD2_GFX_BASE_CLASS
     GxEPD2_BW(GxEPD2_Type epd2_instance) : GxEPD2_GFX_BASE_CLASS(GxEPD2_Type::WIDTH_VISIBLE, GxEPD2_Type::HEIGHT), epd2(epd2_instance)
 #endif
     {
-      _page_height = page_height;
-      _pages = (HEIGHT / _page_height) + ((HEIGHT % _page_height) > 0);
+      _setPageBuffer(_instance_buffer, sizeof(_instance_buffer) / pageBufferSize(1));
       _reverse = (epd2_instance.panel == GxEPD2::GDE0213B1);
       _mirror = false;
+      _async_again = false;
+      _async_power_off = false;
+      _auto_partial = false;
+      _shadow = 0;
+      _shadow_valid = false;
+      _pipeline_buffer = 0;
+      _page_cache = 0;
+      _page_cache_size = 0;
+      _page_cache_used = 0;
       _using_partial_mode = false;
       _current_page = 0;
       setFullWindow();
+      _setDirty(0, 0, GxEPD2_Type::WIDTH, HEIGHT);
+      _shadow_valid = false;
     }
 
     uint16_t pages()
@@ -263,47 +273,161 @@ class GxEPD2_BW : public GxEPD2_GFX_BASE_CLASS
       return _page_height;
     }
 
+    // bytes of a page buffer with rows rows, e.g. pageBufferSize(HEIGHT) for a full screen buffer
+    static uint32_t pageBufferSize(uint16_t rows)
+    {
+      return uint32_t(GxEPD2_Type::WIDTH / 8) * rows;
+    }
+
+    // page buffer of the caller, e.g. on heap or in PSRAM, instead of the buffer of page_height rows of this instance;
+    // the page height follows at runtime, as many rows as fit into size, up to full screen; buffer 0 for the own buffer again
+    // with page_height 0 the own buffer has one row only; disables the pipeline buffer, shadow and page cache, set again as needed
+    void setPageBuffer(uint8_t* buffer, uint32_t size)
+    {
+      epd2.waitBackground();
+      uint32_t rows = buffer ? size / pageBufferSize(1) : 0;
+      if (rows > 0) _setPageBuffer(buffer, rows);
+      else _setPageBuffer(_instance_buffer, sizeof(_instance_buffer) / pageBufferSize(1));
+      _pipeline_buffer = 0;
+      _shadow = 0;
+      _shadow_valid = false;
+      _page_cache = 0;
+      _page_cache_size = 0;
+      _page_cache_used = 0;
+      _setDirty(0, 0, GxEPD2_Type::WIDTH, HEIGHT);
+    }
+
+    // area of the (partial) window that the current page covers, in rotated and mirrored coordinates as for drawPixel()
+    // e.g. to decode or draw only what falls into this page, h or w is 0 if the page is outside the window
+    void getPageWindow(int16_t& x, int16_t& y, int16_t& w, int16_t& h)
+    {
+      int16_t ys = _current_page * _page_height;
+      int16_t ph = ys < _pw_h ? gx_uint16_min(_page_height, _pw_h - ys) : 0;
+      int16_t xs = (_pixel_mode & 2) ? _pixel_x0 - (_pw_w - 1) : _pixel_x0;
+      ys = (_pixel_mode & 1) ? _pixel_y0 - ys - (ph - 1) : _pixel_y0 + ys;
+      x = (_pixel_mode & 4) ? ys : xs;
+      y = (_pixel_mode & 4) ? xs : ys;
+      w = (_pixel_mode & 4) ? ph : _pw_w;
+      h = (_pixel_mode & 4) ? _pw_w : ph;
+    }
+
     bool mirror(bool m)
     {
       _swap_ (_mirror, m);
+      _selectPixelWriter();
       return m;
     }
 
+    // auto partial mode: display(true) writes and refreshes only the area changed since the last display
+    // the changed area is tracked by drawPixel() and fillScreen(), for full screen buffer (1 == pages()) and full window
+    // writes to controller memory that bypass the buffer, e.g. writeImage() or drawImage(), are not tracked
+    bool autoPartial(bool a)
+    {
+      _swap_ (_auto_partial, a);
+      return a;
+    }
+
+    // optional shadow of what was last sent to the controller, for full screen buffer (1 == pages()) only
+    // display(true) then writes only the rows and bytes that differ from the shadow, and refreshes their bounding box
+    // shadow needs pageBufferSize(pageHeight()) bytes, 0 to disable; it is valid after the next display()
+    // writes to controller memory that bypass the buffer, e.g. writeImage() or drawImage(), are not tracked
+    void setShadowBuffer(uint8_t* shadow)
+    {
+      _shadow = (1 == _pages) ? shadow : 0;
+      _shadow_valid = false;
+    }
+
+    // page pipeline for paged drawing: nextPage() hands a copy of the page to a background transfer and returns,
+    // the next page is drawn while the copy is transferred; background transfer on dual core ESP32, else right away
+    // buffer needs pipeline_buffer_size bytes, pageBufferSize(pageHeight()) with setPageBuffer(), 0 to disable
+    static const uint32_t pipeline_buffer_size = (GxEPD2_Type::WIDTH / 8) * page_height;
+    void setPipelineBuffer(uint8_t* buffer)
+    {
+      epd2.waitBackground();
+      _pipeline_buffer = (_pages > 1) ? buffer : 0;
+    }
+
+    // page cache for paged drawing on panels with fast partial update: the first phase stores each page run-length encoded,
+    // the second phase, which makes both controller buffers equal, writes the pages from the cache instead of drawing again
+    // pages are drawn again if the cache overflows; size e.g. a quarter of the screen buffer for mostly white pictures, 0 to disable
+    void setPageCache(uint8_t* cache, uint32_t size)
+    {
+      epd2.waitBackground();
+      _page_cache = (_pages > 1) ? cache : 0;
+      _page_cache_size = _page_cache ? size : 0;
+      _page_cache_used = 0;
+    }
+
+    // changed area since the last display, in controller coordinates, x and w multiple of 8; false if unchanged
+    bool getDirtyWindow(uint16_t& x, uint16_t& y, uint16_t& w, uint16_t& h)
+    {
+      if (_dirty_xe <= _dirty_xs) return false;
+      x = _dirty_xs - _dirty_xs % 8;
+      y = _dirty_ys;
+      w = _dirty_xe - x;
+      if (w % 8 > 0) w += 8 - w % 8;
+      h = _dirty_ye - _dirty_ys;
+      return true;
+    }
+
     void drawPixel(int16_t x, int16_t y, uint16_t color)
     {
       if ((x < 0) || (x >= width()) || (y < 0) || (y >= height())) return;
-      if (_mirror) x = width() - x - 1;
-      // check rotation, move pixel around if necessary
-      switch (getRotation())
+      (this->*_pixel_writer)(x, y, color);
+    }
+
+    void setRotation(uint8_t r)
+    {
+      GxEPD2_GFX_BASE_CLASS::setRotation(r);
+      _selectPixelWriter();
+    }
+
+    void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color)
+    {
+      fillRect(x, y, w, 1, color);
+    }
+
+    void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color)
+    {
+      fillRect(x, y, 1, h, color);
+    }
+
+    // clips once, rotation and mirror map the rectangle to a rectangle in the buffer, filled by whole bytes
+    void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
+    {
+      if (w < 0)
       {
-        case 1:
-          _swap_(x, y);
-          x = WIDTH - x - 1;
-          break;
-        case 2:
-          x = WIDTH - x - 1;
-          y = HEIGHT - y - 1;
-          break;
-        case 3:
-          _swap_(x, y);
-          y = HEIGHT - y - 1;
-          break;
+        x += w + 1;
+        w = -w;
+      }
+      if (h < 0)
+      {
+        y += h + 1;
+        h = -h;
       }
+      int32_t xs = x < 0 ? 0 : x, ys = y < 0 ? 0 : y;
+      int32_t xe = int32_t(x) + w < width() ? int32_t(x) + w : width();
+      int32_t ye = int32_t(y) + h < height() ? int32_t(y) + h : height();
+      if ((xs >= xe) || (ys >= ye)) return;
+      uint16_t rx = xs, ry = ys, rw = xe - xs, rh = ye - ys;
+      if (_mirror) rx = width() - rx - rw;
+      _rotate(rx, ry, rw, rh);
       // transpose partial window to 0,0
-      x -= _pw_x;
-      if (!_reverse) y -= _pw_y;
-      else y = HEIGHT - _pw_y - y - 1;
+      xs = int32_t(rx) - _pw_x;
+      ys = !_reverse ? int32_t(ry) - _pw_y : int32_t(HEIGHT) - _pw_y - ry - rh;
+      xe = xs + rw;
+      ye = ys + rh;
       // clip to (partial) window
-      if ((x < 0) || (x >= int16_t(_pw_w)) || (y < 0) || (y >= int16_t(_pw_h))) return;
-      // adjust for current page
-      y -= _current_page * _page_height;
-      // check if in current page
-      if ((y < 0) || (y >= int16_t(_page_height))) return;
-      uint16_t i = x / 8 + y * (_pw_w / 8);
-      if (color)
-        _buffer[i] = (_buffer[i] | (1 << (7 - x % 8)));
-      else
-        _buffer[i] = (_buffer[i] & (0xFF ^ (1 << (7 - x % 8))));
+      if (xs < 0) xs = 0;
+      if (ys < 0) ys = 0;
+      if (xe > int32_t(_pw_w)) xe = _pw_w;
+      if (ye > int32_t(_pw_h)) ye = _pw_h;
+      // adjust for current page, clip to current page
+      int32_t page_ys = int32_t(_current_page) * _page_height;
+      ys = ys - page_ys < 0 ? 0 : ys - page_ys;
+      ye = ye - page_ys > int32_t(_page_height) ? _page_height : ye - page_ys;
+      if ((xs >= xe) || (ys >= ye)) return;
+      _fillBufferRect(xs, ys, xe, ye, color ? 0xFF : 0x00);
     }
 
     void init(uint32_t serial_diag_bitrate = 0) // = 0 : disabled
@@ -312,6 +436,8 @@ class GxEPD2_BW : public GxEPD2_GFX_BASE_CLASS
       _using_partial_mode = false;
       _current_page = 0;
       setFullWindow();
+      _setDirty(0, 0, GxEPD2_Type::WIDTH, HEIGHT);
+      _shadow_valid = false;
     }
 
     // init method with additional parameters:
@@ -326,6 +452,8 @@ class GxEPD2_BW : public GxEPD2_GFX_BASE_CLASS
       _using_partial_mode = false;
       _current_page = 0;
       setFullWindow();
+      _setDirty(0, 0, GxEPD2_Type::WIDTH, HEIGHT);
+      _shadow_valid = false;
     }
 
     // init method with additional parameters:
@@ -338,6 +466,8 @@ class GxEPD2_BW : public GxEPD2_GFX_BASE_CLASS
       _using_partial_mode = false;
       _current_page = 0;
       setFullWindow();
+      _setDirty(0, 0, GxEPD2_Type::WIDTH, HEIGHT);
+      _shadow_valid = false;
     }
 
     // release SPI and control pins
@@ -349,15 +479,51 @@ class GxEPD2_BW : public GxEPD2_GFX_BASE_CLASS
     void fillScreen(uint16_t color) // 0x0 black, >0x0 white, to buffer
     {
       uint8_t data = (color == GxEPD_BLACK) ? 0x00 : 0xFF;
-      for (uint16_t x = 0; x < sizeof(_buffer); x++)
+      uint32_t first = _buffer_size, last = 0; // changed bytes
+      for (uint32_t x = 0; x < _buffer_size; x++)
       {
+        if (_buffer[x] == data) continue;
+        if (x < first) first = x;
+        last = x;
         _buffer[x] = data;
       }
+      if (first > last) return;
+      // rows of changed bytes, full width if more than one row
+      uint16_t wb = _pw_w / 8;
+      uint16_t ys = first / wb, ye = last / wb;
+      if (ys == ye) _addDirty(8 * (first % wb), ys + _current_page * _page_height, 8 * (last - first + 1), 1);
+      else _addDirty(0, ys + _current_page * _page_height, _pw_w, ye - ys + 1);
     }
 
     // display buffer content to screen, useful for full screen buffer
+    // in auto partial mode, display(true) writes and refreshes the changed area only, nothing if unchanged
+    // with a valid shadow buffer, display(true) writes and refreshes only what differs from the shadow
     void display(bool partial_update_mode = false)
     {
+      if (partial_update_mode && (1 == _pages) && !_using_partial_mode)
+      {
+        if (_shadow && _shadow_valid)
+        {
+          _displayShadowDiff();
+          _setDirty(0, 0, 0, 0);
+          return;
+        }
+        uint16_t x, y, w, h;
+        if (_auto_partial && !_shadow)
+        {
+          if (getDirtyWindow(x, y, w, h))
+          {
+            epd2.writeImagePart(_buffer, x, y, GxEPD2_Type::WIDTH, _page_height, x, y, w, h);
+            epd2.refresh(x, y, w, h);
+            if (epd2.hasFastPartialUpdate)
+            {
+              epd2.writeImagePartAgain(_buffer, x, y, GxEPD2_Type::WIDTH, _page_height, x, y, w, h);
+            }
+          }
+          _setDirty(0, 0, 0, 0);
+          return;
+        }
+      }
       if (partial_update_mode) epd2.writeImage(_buffer, 0, 0, GxEPD2_Type::WIDTH, _page_height);
       else epd2.writeImageForFullRefresh(_buffer, 0, 0, GxEPD2_Type::WIDTH, _page_height);
       epd2.refresh(partial_update_mode);
@@ -366,6 +532,29 @@ class GxEPD2_BW : public GxEPD2_GFX_BASE_CLASS
         epd2.writeImageAgain(_buffer, 0, 0, GxEPD2_Type::WIDTH, _page_height);
       }
       if (!partial_update_mode) epd2.powerOff();
+      _setDirty(0, 0, 0, 0);
+      _copyToShadow(0, GxEPD2_Type::WIDTH / 8, 0, HEIGHT);
+    }
+
+    // non-blocking display(), for full screen buffer: returns after the refresh is started, see GxEPD2_EPD::refreshAsync()
+    // isBusy() polls and does what display() does after the refresh; the buffer must not change before isBusy() returns false
+    void displayAsync(bool partial_update_mode = false)
+    {
+      epd2.waitWhileBusy();
+      if (partial_update_mode) epd2.writeImage(_buffer, 0, 0, GxEPD2_Type::WIDTH, _page_height);
+      else epd2.writeImageForFullRefresh(_buffer, 0, 0, GxEPD2_Type::WIDTH, _page_height);
+      _async_again = epd2.hasFastPartialUpdate;
+      _async_power_off = !partial_update_mode;
+      epd2.setAsyncStep(_asyncStep, this);
+      epd2.refreshAsync(partial_update_mode);
+      _setDirty(0, 0, 0, 0);
+      _copyToShadow(0, GxEPD2_Type::WIDTH / 8, 0, HEIGHT);
+    }
+
+    // true while a refresh or power off started by displayAsync() is ongoing
+    bool isBusy()
+    {
+      return epd2.isBusy();
     }
 
     // display part of buffer content to screen, useful for full screen buffer
@@ -388,15 +577,20 @@ class GxEPD2_BW : public GxEPD2_GFX_BASE_CLASS
       {
         epd2.writeImagePartAgain(_buffer, x, y_part, GxEPD2_Type::WIDTH, _page_height, x, y_part, w, h);
       }
+      _copyToShadow(x / 8, (x + w + 7) / 8, y_part, y_part + h);
+      // changed area done if inside window
+      if ((_dirty_xs >= x) && (_dirty_xe <= x + w) && (_dirty_ys >= y_part) && (_dirty_ye <= y_part + h)) _setDirty(0, 0, 0, 0);
     }
 
     void setFullWindow()
     {
+      if (_using_partial_mode) _setDirty(0, 0, GxEPD2_Type::WIDTH, HEIGHT); // buffer layout changes
       _using_partial_mode = false;
       _pw_x = 0;
       _pw_y = 0;
       _pw_w = GxEPD2_Type::WIDTH;
       _pw_h = HEIGHT;
+      _selectPixelWriter();
     }
 
     // setPartialWindow, use parameters according to actual rotation.
@@ -417,13 +611,18 @@ class GxEPD2_BW : public GxEPD2_GFX_BASE_CLASS
       if (_pw_w % 8 > 0) _pw_w += 8 - _pw_w % 8;
       _pw_x -= _pw_x % 8;
       if (_reverse) _pw_y = HEIGHT - _pw_h - _pw_y;
+      _setDirty(0, 0, GxEPD2_Type::WIDTH, HEIGHT); // buffer layout changes
+      _shadow_valid = false;
+      _selectPixelWriter();
     }
 
     void firstPage()
     {
+      epd2.waitBackground(); // e.g. after a page loop left early
       fillScreen(GxEPD_WHITE);
       _current_page = 0;
       _second_phase = false;
+      _page_cache_used = 0;
     }
 
     bool nextPage()
@@ -450,6 +649,8 @@ class GxEPD2_BW : public GxEPD2_GFX_BASE_CLASS
             //epd2.refresh(true); // not needed
           }
           epd2.powerOff();
+          _setDirty(0, 0, 0, 0);
+          _copyToShadow(0, GxEPD2_Type::WIDTH / 8, 0, HEIGHT);
         }
         return false;
       }
@@ -465,8 +666,8 @@ class GxEPD2_BW : public GxEPD2_GFX_BASE_CLASS
         {
           //Serial.print("writeImage("); Serial.print(_pw_x); Serial.print(", "); Serial.print(dest_ys); Serial.print(", ");
           //Serial.print(_pw_w); Serial.print(", "); Serial.print(dest_ye - dest_ys); Serial.println(")");
-          if (!_second_phase) epd2.writeImage(_buffer, _pw_x, dest_ys, _pw_w, dest_ye - dest_ys);
-          else epd2.writeImageAgain(_buffer, _pw_x, dest_ys, _pw_w, dest_ye - dest_ys);
+          _writePage(_second_phase ? _write_again : _write_image, _pw_x, dest_ys, _pw_w, dest_ye - dest_ys);
+          if (!_second_phase) _cachePage(uint32_t(_pw_w / 8) * (dest_ye - dest_ys));
         }
         else
         {
@@ -478,10 +679,11 @@ class GxEPD2_BW : public GxEPD2_GFX_BASE_CLASS
         if (_current_page == int16_t(_pages))
         {
           _current_page = 0;
+          epd2.waitBackground();
           if (!_second_phase)
           {
             epd2.refresh(_pw_x, _pw_y, _pw_w, _pw_h);
-            if (epd2.hasFastPartialUpdate)
+            if (epd2.hasFastPartialUpdate && !_replayPageCache())
             {
               _second_phase = true;
               fillScreen(GxEPD_WHITE);
@@ -495,20 +697,24 @@ class GxEPD2_BW : public GxEPD2_GFX_BASE_CLASS
       }
       else // full update
       {
-        if (!_second_phase) epd2.writeImageForFullRefresh(_buffer, 0, page_ys, GxEPD2_Type::WIDTH, gx_uint16_min(_page_height, HEIGHT - page_ys));
-        else epd2.writeImageAgain(_buffer, 0, page_ys, GxEPD2_Type::WIDTH, gx_uint16_min(_page_height, HEIGHT - page_ys));
+        _writePage(_second_phase ? _write_again : _write_full, 0, page_ys, GxEPD2_Type::WIDTH, gx_uint16_min(_page_height, HEIGHT - page_ys));
+        if (!_second_phase) _cachePage(uint32_t(GxEPD2_Type::WIDTH / 8) * gx_uint16_min(_page_height, HEIGHT - page_ys));
         _current_page++;
         if (_current_page == int16_t(_pages))
         {
           _current_page = 0;
+          epd2.waitBackground();
           if (epd2.hasFastPartialUpdate)
           {
             if (!_second_phase)
             {
               epd2.refresh(false); // full update after first phase
-              _second_phase = true;
-              fillScreen(GxEPD_WHITE);
-              return true;
+              if (!_replayPageCache())
+              {
+                _second_phase = true;
+                fillScreen(GxEPD_WHITE);
+                return true;
+              }
             }
             //else epd2.refresh(true); // partial update after second phase
           } else epd2.refresh(false); // full update after only phase
@@ -547,13 +753,21 @@ class GxEPD2_BW : public GxEPD2_GFX_BASE_CLASS
             //epd2.refresh(true); // not needed
             epd2.powerOff();
           }
+          _setDirty(0, 0, 0, 0);
+          _copyToShadow(0, GxEPD2_Type::WIDTH / 8, 0, HEIGHT);
         }
         return;
       }
       if (_using_partial_mode)
       {
+        _page_cache_used = 0;
         for (uint16_t phase = 1; phase <= 2; phase++)
         {
+          if ((phase == 2) && _replayPageCache())
+          {
+            epd2.refresh(_pw_x, _pw_y, _pw_w, _pw_h);
+            break;
+          }
           for (_current_page = 0; _current_page < _pages; _current_page++)
           {
             uint16_t page_ys = _current_page * _page_height;
@@ -564,7 +778,11 @@ class GxEPD2_BW : public GxEPD2_GFX_BASE_CLASS
             {
               fillScreen(GxEPD_WHITE);
               drawCallback(pv);
-              if (phase == 1) epd2.writeImage(_buffer, _pw_x, dest_ys, _pw_w, dest_ye - dest_ys);
+              if (phase == 1)
+              {
+                epd2.writeImage(_buffer, _pw_x, dest_ys, _pw_w, dest_ye - dest_ys);
+                _cachePage(uint32_t(_pw_w / 8) * (dest_ye - dest_ys));
+              }
               else epd2.writeImageAgain(_buffer, _pw_x, dest_ys, _pw_w, dest_ye - dest_ys);
             }
           }
@@ -575,15 +793,17 @@ class GxEPD2_BW : public GxEPD2_GFX_BASE_CLASS
       }
       else // full update
       {
+        _page_cache_used = 0;
         for (_current_page = 0; _current_page < _pages; _current_page++)
         {
           uint16_t page_ys = _current_page * _page_height;
           fillScreen(GxEPD_WHITE);
           drawCallback(pv);
           epd2.writeImageForFullRefresh(_buffer, 0, page_ys, GxEPD2_Type::WIDTH, gx_uint16_min(_page_height, HEIGHT - page_ys));
+          _cachePage(uint32_t(GxEPD2_Type::WIDTH / 8) * gx_uint16_min(_page_height, HEIGHT - page_ys));
         }
         epd2.refresh(false); // full update after first phase
-        if (epd2.hasFastPartialUpdate)
+        if (epd2.hasFastPartialUpdate && !_replayPageCache())
         {
           // make both controller buffers have equal content
           for (_current_page = 0; _current_page < _pages; _current_page++)
@@ -600,30 +820,36 @@ class GxEPD2_BW : public GxEPD2_GFX_BASE_CLASS
       _current_page = 0;
     }
 
+    // bitmaps are written to the buffer 8 pixels at a time, see _drawBitmap()
+    using GxEPD2_GFX_BASE_CLASS::drawBitmap;
+
+    void drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w, int16_t h, uint16_t color)
+    {
+      _drawBitmap(x, y, bitmap, w, h, color, 0, false, false, true);
+    }
+
+    void drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w, int16_t h, uint16_t color, uint16_t bg)
+    {
+      _drawBitmap(x, y, bitmap, w, h, color, bg, true, false, true);
+    }
+
+    void drawBitmap(int16_t x, int16_t y, uint8_t* bitmap, int16_t w, int16_t h, uint16_t color)
+    {
+      _drawBitmap(x, y, bitmap, w, h, color, 0, false, false, false);
+    }
+
+    void drawBitmap(int16_t x, int16_t y, uint8_t* bitmap, int16_t w, int16_t h, uint16_t color, uint16_t bg)
+    {
+      _drawBitmap(x, y, bitmap, w, h, color, bg, true, false, false);
+    }
+
     void drawInvertedBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w, int16_t h, uint16_t color)
     {
-      // taken from Adafruit_GFX.cpp, modified
-      int16_t byteWidth = (w + 7) / 8; // Bitmap scanline pad = whole byte
-      uint8_t byte = 0;
-      for (int16_t j = 0; j < h; j++)
-      {
-        for (int16_t i = 0; i < w; i++ )
-        {
-          if (i & 7) byte <<= 1;
-          else
-          {
 #if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-            byte = pgm_read_byte(&bitmap[j * byteWidth + i / 8]);
+      _drawBitmap(x, y, bitmap, w, h, color, 0, false, true, true);
 #else
-            byte = bitmap[j * byteWidth + i / 8];
+      _drawBitmap(x, y, bitmap, w, h, color, 0, false, true, false);
 #endif
-          }
-          if (!(byte & 0x80))
-          {
-            drawPixel(x + i, y + j, color);
-          }
-        }
-      }
     }
 
     //  Support for Bitmaps (Sprites) to Controller Buffer and to Screen
@@ -736,6 +962,280 @@ class GxEPD2_BW : public GxEPD2_GFX_BASE_CLASS
     {
       return (a > b ? a : b);
     };
+    // changed area, in buffer coordinates, end exclusive
+    void _setDirty(uint16_t x, uint16_t y, uint16_t w, uint16_t h)
+    {
+      _dirty_xs = x;
+      _dirty_ys = y;
+      _dirty_xe = x + w;
+      _dirty_ye = y + h;
+    }
+    void _addDirty(uint16_t x, uint16_t y, uint16_t w, uint16_t h)
+    {
+      if (_dirty_xe <= _dirty_xs) _setDirty(x, y, w, h);
+      else
+      {
+        _dirty_xs = gx_uint16_min(_dirty_xs, x);
+        _dirty_ys = gx_uint16_min(_dirty_ys, y);
+        _dirty_xe = gx_uint16_max(_dirty_xe, x + w);
+        _dirty_ye = gx_uint16_max(_dirty_ye, y + h);
+      }
+    }
+    // buffer coordinates of current page, end exclusive, masks for leading and trailing partial bytes
+    void _fillBufferRect(uint16_t xs, uint16_t ys, uint16_t xe, uint16_t ye, uint8_t data)
+    {
+      const uint16_t wb = _pw_w / 8;
+      uint16_t xbs = xs / 8, xbe = (xe - 1) / 8; // inclusive
+      uint8_t lead = 0xFF >> (xs % 8);
+      uint8_t trail = 0xFF << (7 - (xe - 1) % 8);
+      if (xbs == xbe) lead &= trail;
+      uint16_t dys = ye, dye = 0; // changed rows
+      for (uint16_t y = ys; y < ye; y++)
+      {
+        uint8_t* row = _buffer + uint32_t(y) * wb;
+        uint8_t changed = 0;
+        uint8_t v = (row[xbs] & ~lead) | (data & lead);
+        changed |= v ^ row[xbs];
+        row[xbs] = v;
+        if (xbe > xbs)
+        {
+          for (uint16_t xb = xbs + 1; xb < xbe; xb++)
+          {
+            changed |= data ^ row[xb];
+            row[xb] = data;
+          }
+          v = (row[xbe] & ~trail) | (data & trail);
+          changed |= v ^ row[xbe];
+          row[xbe] = v;
+        }
+        if (changed)
+        {
+          if (y < dys) dys = y;
+          dye = y + 1;
+        }
+      }
+      if (dye > dys) _addDirty(8 * xbs, dys + _current_page * _page_height, 8 * (xbe - xbs + 1), dye - dys);
+    }
+    // bitmap with rows padded to whole bytes, MSB first; bits set are drawn with color, bits clear with bg if opaque
+    // clipped once to the screen; rows that stay rows in the buffer (rotation 0 and 2) are written by shifted source bytes,
+    // columns that become rows (rotation 1 and 3) by 8x8 blocks transposed
+    void _drawBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w, int16_t h, uint16_t color, uint16_t bg, bool opaque, bool invert, bool pgm)
+    {
+      if ((w <= 0) || (h <= 0)) return;
+      int16_t i0 = x < 0 ? -x : 0, j0 = y < 0 ? -y : 0; // source columns and rows on screen, end exclusive
+      int16_t i1 = int32_t(x) + w > width() ? width() - x : w;
+      int16_t j1 = int32_t(y) + h > height() ? height() - y : h;
+      if ((i0 >= i1) || (j0 >= j1)) return;
+      uint16_t byte_width = (w + 7) / 8;
+      // buffer position of source pixel (i0, j0), and steps for the next source column and row
+      int32_t bx0, by0, bx1, by1, bx2, by2;
+      _toBuffer(x + i0, y + j0, bx0, by0);
+      _toBuffer(x + i0 + 1, y + j0, bx1, by1);
+      _toBuffer(x + i0, y + j0 + 1, bx2, by2);
+      // rows of the current page within the (partial) window, as _writePixel() clips to _pw_h
+      int32_t rows = int32_t(_pw_h) - int32_t(_current_page) * _page_height;
+      if (rows > int32_t(_page_height)) rows = _page_height;
+      if (by1 == by0) // source rows are buffer rows
+      {
+        int8_t dx = bx1 - bx0, dy = by2 - by0;
+        for (int16_t j = j0; j < j1; j++)
+        {
+          int32_t by = by0 + int32_t(j - j0) * dy;
+          if ((by < 0) || (by >= rows)) continue;
+          for (int16_t i = i0; i < i1; i += 8)
+          {
+            uint8_t bits = _bitmapBits(bitmap, byte_width, i, j, pgm, invert);
+            uint8_t mask = i1 - i < 8 ? 0xFF << (8 - (i1 - i)) : 0xFF;
+            int32_t bx = bx0 + int32_t(i - i0) * dx;
+            if (dx > 0) _writeBits(bx, by, bits, mask, color, bg, opaque);
+            else _writeBits(bx - 7, by, _reverseBits(bits), _reverseBits(mask), color, bg, opaque);
+          }
+        }
+      }
+      else // source columns are buffer rows
+      {
+        int8_t dy = by1 - by0, dx = bx2 - bx0;
+        for (int16_t j = j0; j < j1; j += 8)
+        {
+          uint8_t rows_mask = j1 - j < 8 ? 0xFF << (8 - (j1 - j)) : 0xFF;
+          int32_t bx = bx0 + int32_t(j - j0) * dx;
+          for (int16_t i = i0; i < i1; i += 8)
+          {
+            uint8_t block[8];
+            for (uint8_t k = 0; k < 8; k++)
+            {
+              block[k] = (j + k < j1) ? _bitmapBits(bitmap, byte_width, i, j + k, pgm, invert) : 0;
+            }
+            _transpose8x8(block);
+            for (uint8_t k = 0; (k < 8) && (i + k < i1); k++)
+            {
+              int32_t by = by0 + int32_t(i + k - i0) * dy;
+              if ((by < 0) || (by >= rows)) continue;
+              if (dx > 0) _writeBits(bx, by, block[k], rows_mask, color, bg, opaque);
+              else _writeBits(bx - 7, by, _reverseBits(block[k]), _reverseBits(rows_mask), color, bg, opaque);
+            }
+          }
+        }
+      }
+    }
+    // buffer coordinates of current page, as in drawPixel(), without clipping
+    void _toBuffer(int16_t x, int16_t y, int32_t& bx, int32_t& by)
+    {
+      int32_t px = _mirror ? width() - x - 1 : x, py = y;
+      switch (getRotation())
+      {
+        case 1:
+          _swap_(px, py);
+          px = WIDTH - px - 1;
+          break;
+        case 2:
+          px = WIDTH - px - 1;
+          py = HEIGHT - py - 1;
+          break;
+        case 3:
+          _swap_(px, py);
+          py = HEIGHT - py - 1;
+          break;
+      }
+      bx = px - _pw_x;
+      by = !_reverse ? py - _pw_y : HEIGHT - _pw_y - py - 1;
+      by -= int32_t(_current_page) * _page_height;
+    }
+    // 8 source pixels from column i of row j, MSB first, padding bits are masked by the caller
+    uint8_t _bitmapBits(const uint8_t bitmap[], uint16_t byte_width, int16_t i, int16_t j, bool pgm, bool invert)
+    {
+      uint32_t idx = uint32_t(j) * byte_width + i / 8;
+      uint8_t shift = i % 8;
+      uint8_t b0 = pgm ? pgm_read_byte(&bitmap[idx]) : bitmap[idx];
+      uint8_t bits = b0 << shift;
+      if ((shift > 0) && (uint16_t(i / 8 + 1) < byte_width))
+      {
+        uint8_t b1 = pgm ? pgm_read_byte(&bitmap[idx + 1]) : bitmap[idx + 1];
+        bits |= b1 >> (8 - shift);
+      }
+      return invert ? ~bits : bits;
+    }
+    // 8 pixels at buffer x of MSB, may span two buffer bytes; rows and bytes outside the buffer are skipped
+    void _writeBits(int32_t bx, int32_t by, uint8_t bits, uint8_t mask, uint16_t color, uint16_t bg, bool opaque)
+    {
+      const uint16_t wb = _pw_w / 8;
+      int32_t xb = bx >= 0 ? bx / 8 : (bx - 7) / 8;
+      uint8_t shift = bx - 8 * xb;
+      _writeByte(xb, by, bits >> shift, mask >> shift, color, bg, opaque, wb);
+      if (shift > 0) _writeByte(xb + 1, by, bits << (8 - shift), mask << (8 - shift), color, bg, opaque, wb);
+    }
+    void _writeByte(int32_t xb, int32_t by, uint8_t bits, uint8_t mask, uint16_t color, uint16_t bg, bool opaque, uint16_t wb)
+    {
+      if ((xb < 0) || (xb >= int32_t(wb)) || (0 == mask)) return;
+      uint8_t& b = _buffer[uint32_t(by) * wb + xb];
+      uint8_t v = b;
+      uint8_t on = bits & mask, off = ~bits & mask;
+      v = color ? (v | on) : (v & ~on);
+      if (opaque) v = bg ? (v | off) : (v & ~off);
+      if (v == b) return;
+      b = v;
+      _addDirty(8 * xb, by + _current_page * _page_height, 8, 1);
+    }
+    static uint8_t _reverseBits(uint8_t b)
+    {
+      b = (b & 0xF0) >> 4 | (b & 0x0F) << 4;
+      b = (b & 0xCC) >> 2 | (b & 0x33) << 2;
+      b = (b & 0xAA) >> 1 | (b & 0x55) << 1;
+      return b;
+    }
+    // rows of 8 pixels, MSB first, to columns: bit 7 of b[k] is bit (7 - k) of row 0
+    static void _transpose8x8(uint8_t b[8])
+    {
+      // Hacker's Delight, transpose8
+      uint32_t x = (uint32_t(b[0]) << 24) | (uint32_t(b[1]) << 16) | (uint32_t(b[2]) << 8) | b[3];
+      uint32_t y = (uint32_t(b[4]) << 24) | (uint32_t(b[5]) << 16) | (uint32_t(b[6]) << 8) | b[7];
+      uint32_t t;
+      t = (x ^ (x >> 7)) & 0x00AA00AA;
+      x = x ^ t ^ (t << 7);
+      t = (y ^ (y >> 7)) & 0x00AA00AA;
+      y = y ^ t ^ (t << 7);
+      t = (x ^ (x >> 14)) & 0x0000CCCC;
+      x = x ^ t ^ (t << 14);
+      t = (y ^ (y >> 14)) & 0x0000CCCC;
+      y = y ^ t ^ (t << 14);
+      t = (x & 0xF0F0F0F0) | ((y >> 4) & 0x0F0F0F0F);
+      y = ((x << 4) & 0xF0F0F0F0) | (y & 0x0F0F0F0F);
+      x = t;
+      b[0] = x >> 24;
+      b[1] = x >> 16;
+      b[2] = x >> 8;
+      b[3] = x;
+      b[4] = y >> 24;
+      b[5] = y >> 16;
+      b[6] = y >> 8;
+      b[7] = y;
+    }
+    // bytes xbs..xbe, rows ys..ye, end exclusive; shadow is valid after a full write
+    void _copyToShadow(uint16_t xbs, uint16_t xbe, uint16_t ys, uint16_t ye)
+    {
+      if (!_shadow) return;
+      const uint16_t wb = GxEPD2_Type::WIDTH / 8;
+      if ((xbs == 0) && (xbe == wb) && (ys == 0) && (ye == HEIGHT)) _shadow_valid = true;
+      if (!_shadow_valid) return;
+      for (uint16_t y = ys; y < ye; y++)
+      {
+        memcpy(_shadow + uint32_t(y) * wb + xbs, _buffer + uint32_t(y) * wb + xbs, xbe - xbs);
+      }
+    }
+    // write bands of changed rows with their changed bytes, refresh the bounding box
+    void _displayShadowDiff()
+    {
+      const uint16_t wb = GxEPD2_Type::WIDTH / 8;
+      const uint8_t max_bands = 8;
+      const uint16_t merge_bytes = 64; // merge bands if the unchanged bytes in between cost less than a window write
+      uint16_t band_xs[max_bands], band_xe[max_bands], band_ys[max_bands], band_ye[max_bands]; // bytes, rows, end exclusive
+      uint8_t bands = 0;
+      for (uint16_t y = _dirty_ys; y < _dirty_ye; y++) // rows outside the changed area are unchanged
+      {
+        const uint8_t* row = _buffer + uint32_t(y) * wb;
+        const uint8_t* shadow_row = _shadow + uint32_t(y) * wb;
+        if (memcmp(row, shadow_row, wb) == 0) continue; // word-wide compare
+        uint16_t xs = 0, xe = wb;
+        while (row[xs] == shadow_row[xs]) xs++;
+        while (row[xe - 1] == shadow_row[xe - 1]) xe--;
+        if (bands > 0)
+        {
+          uint8_t b = bands - 1;
+          uint16_t union_w = gx_uint16_max(band_xe[b], xe) - gx_uint16_min(band_xs[b], xs);
+          if ((bands == max_bands) || (uint32_t(y - band_ye[b]) * union_w <= merge_bytes))
+          {
+            band_xs[b] = gx_uint16_min(band_xs[b], xs);
+            band_xe[b] = gx_uint16_max(band_xe[b], xe);
+            band_ye[b] = y + 1;
+            continue;
+          }
+        }
+        band_xs[bands] = xs;
+        band_xe[bands] = xe;
+        band_ys[bands] = y;
+        band_ye[bands] = y + 1;
+        bands++;
+      }
+      if (0 == bands) return;
+      uint16_t xs = wb, xe = 0, ys = band_ys[0], ye = band_ye[bands - 1];
+      for (uint8_t b = 0; b < bands; b++)
+      {
+        epd2.writeImagePart(_buffer, 8 * band_xs[b], band_ys[b], GxEPD2_Type::WIDTH, _page_height,
+                            8 * band_xs[b], band_ys[b], 8 * (band_xe[b] - band_xs[b]), band_ye[b] - band_ys[b]);
+        xs = gx_uint16_min(xs, band_xs[b]);
+        xe = gx_uint16_max(xe, band_xe[b]);
+      }
+      epd2.refresh(8 * xs, ys, 8 * (xe - xs), ye - ys);
+      for (uint8_t b = 0; b < bands; b++)
+      {
+        if (epd2.hasFastPartialUpdate)
+        {
+          epd2.writeImagePartAgain(_buffer, 8 * band_xs[b], band_ys[b], GxEPD2_Type::WIDTH, _page_height,
+                                   8 * band_xs[b], band_ys[b], 8 * (band_xe[b] - band_xs[b]), band_ye[b] - band_ys[b]);
+        }
+        _copyToShadow(band_xs[b], band_xe[b], band_ys[b], band_ye[b]);
+      }
+    }
     void _rotate(uint16_t& x, uint16_t& y, uint16_t& w, uint16_t& h)
     {
       switch (getRotation())
@@ -756,13 +1256,204 @@ class GxEPD2_BW : public GxEPD2_GFX_BASE_CLASS
           break;
       }
     }
+    // completion steps of displayAsync(), called by epd2 when the refresh is done
+    static void _asyncStep(void* display)
+    {
+      GxEPD2_BW* self = static_cast<GxEPD2_BW*>(display);
+      if (self->_async_again)
+      {
+        self->_async_again = false;
+        self->epd2.writeImageAgain(self->_buffer, 0, 0, GxEPD2_Type::WIDTH, self->_page_height);
+      }
+      if (self->_async_power_off)
+      {
+        self->_async_power_off = false;
+        self->epd2.powerOffAsync();
+      }
+    }
+    // drawPixel() for one orientation, rotation and mirror reduce to swap and flip of x and y, see _selectPixelWriter()
+    template <bool swap, bool flip_x, bool flip_y> void _writePixel(int16_t x, int16_t y, uint16_t color)
+    {
+      if (swap) _swap_(x, y);
+      // transpose partial window to 0,0
+      x = flip_x ? _pixel_x0 - x : x - _pixel_x0;
+      y = flip_y ? _pixel_y0 - y : y - _pixel_y0;
+      // clip to (partial) window
+      if ((uint16_t(x) >= _pw_w) || (uint16_t(y) >= _pw_h)) return;
+      // adjust for current page
+      y -= _current_page * _page_height;
+      // check if in current page
+      if (uint16_t(y) >= _page_height) return;
+      uint32_t i = x / 8 + uint32_t(y) * (_pw_w / 8);
+      uint8_t data = color ? (_buffer[i] | (1 << (7 - x % 8))) : (_buffer[i] & (0xFF ^ (1 << (7 - x % 8))));
+      if (data == _buffer[i]) return;
+      _buffer[i] = data;
+      _addDirty(x, y + _current_page * _page_height, 1, 1);
+    }
+    // selects the _writePixel() instance for rotation, mirror, reverse and window; called on any change of these
+    void _selectPixelWriter()
+    {
+      bool swap = false, flip_x = _mirror, flip_y = false;
+      switch (getRotation())
+      {
+        case 1:
+          swap = true;
+          flip_x = true;
+          flip_y = _mirror;
+          break;
+        case 2:
+          flip_x = !_mirror;
+          flip_y = true;
+          break;
+        case 3:
+          swap = true;
+          flip_x = false;
+          flip_y = !_mirror;
+          break;
+      }
+      if (_reverse) flip_y = !flip_y; // _pw_y is from the reversed side
+      _pixel_x0 = flip_x ? WIDTH - 1 - _pw_x : _pw_x;
+      _pixel_y0 = flip_y ? HEIGHT - 1 - _pw_y : _pw_y;
+      _pixel_mode = (swap << 2) | (flip_x << 1) | flip_y;
+      switch (_pixel_mode)
+      {
+        case 0: _pixel_writer = &GxEPD2_BW::_writePixel<false, false, false>; break;
+        case 1: _pixel_writer = &GxEPD2_BW::_writePixel<false, false, true>; break;
+        case 2: _pixel_writer = &GxEPD2_BW::_writePixel<false, true, false>; break;
+        case 3: _pixel_writer = &GxEPD2_BW::_writePixel<false, true, true>; break;
+        case 4: _pixel_writer = &GxEPD2_BW::_writePixel<true, false, false>; break;
+        case 5: _pixel_writer = &GxEPD2_BW::_writePixel<true, false, true>; break;
+        case 6: _pixel_writer = &GxEPD2_BW::_writePixel<true, true, false>; break;
+        case 7: _pixel_writer = &GxEPD2_BW::_writePixel<true, true, true>; break;
+      }
+    }
+    enum PageWrite {_write_image, _write_again, _write_full};
+    // writes the page, or a copy of it in the background if the page pipeline is enabled
+    void _writePage(PageWrite mode, int16_t x, int16_t y, int16_t w, int16_t h)
+    {
+      if (!_pipeline_buffer)
+      {
+        _writePage(_buffer, mode, x, y, w, h);
+        return;
+      }
+      epd2.waitBackground(); // previous page is transferred
+      memcpy(_pipeline_buffer, _buffer, _buffer_size);
+      _pipeline_mode = mode;
+      _pipeline_x = x;
+      _pipeline_y = y;
+      _pipeline_w = w;
+      _pipeline_h = h;
+      epd2.runInBackground(_pipelineJob, this);
+    }
+    void _writePage(const uint8_t* page, PageWrite mode, int16_t x, int16_t y, int16_t w, int16_t h)
+    {
+      switch (mode)
+      {
+        case _write_image: epd2.writeImage(page, x, y, w, h); break;
+        case _write_again: epd2.writeImageAgain(page, x, y, w, h); break;
+        case _write_full: epd2.writeImageForFullRefresh(page, x, y, w, h); break;
+      }
+    }
+    static void _pipelineJob(void* p)
+    {
+      GxEPD2_BW* d = static_cast<GxEPD2_BW*>(p);
+      d->_writePage(d->_pipeline_buffer, d->_pipeline_mode, d->_pipeline_x, d->_pipeline_y, d->_pipeline_w, d->_pipeline_h);
+    }
+    // appends the first n bytes of the page to the page cache, PackBits encoded:
+    // header h < 128: h + 1 literal bytes follow, h > 128: the next byte is repeated 257 - h times
+    void _cachePage(uint32_t n)
+    {
+      if (!_page_cache || !epd2.hasFastPartialUpdate || (_page_cache_used > _page_cache_size)) return;
+      uint8_t* out = _page_cache + _page_cache_used;
+      const uint8_t* end = _page_cache + _page_cache_size;
+      uint32_t i = 0;
+      while (i < n)
+      {
+        uint32_t run = 1;
+        while ((i + run < n) && (run < 128) && (_buffer[i + run] == _buffer[i])) run++;
+        if (run > 1)
+        {
+          if (end - out < 2) break;
+          *out++ = 257 - run;
+          *out++ = _buffer[i];
+          i += run;
+          continue;
+        }
+        // literal up to the next run of 3
+        uint32_t lit = 1;
+        while ((i + lit < n) && (lit < 128) && !((i + lit + 2 < n) && (_buffer[i + lit] == _buffer[i + lit + 1]) && (_buffer[i + lit] == _buffer[i + lit + 2]))) lit++;
+        if (uint32_t(end - out) < lit + 1) break;
+        *out++ = lit - 1;
+        memcpy(out, _buffer + i, lit);
+        out += lit;
+        i += lit;
+      }
+      _page_cache_used = (i < n) ? _page_cache_size + 1 : out - _page_cache; // overflow
+    }
+    // second phase from the page cache: writes each page again without drawing; false if the cache is disabled or overflowed
+    bool _replayPageCache()
+    {
+      if (!_page_cache || (_page_cache_used > _page_cache_size)) return false;
+      const uint8_t* in = _page_cache;
+      for (uint16_t page = 0; page < _pages; page++)
+      {
+        uint16_t page_ys = page * _page_height;
+        uint16_t page_ye = page < _pages - 1 ? page_ys + _page_height : HEIGHT;
+        uint16_t x = _using_partial_mode ? _pw_x : 0;
+        uint16_t w = _using_partial_mode ? _pw_w : GxEPD2_Type::WIDTH;
+        uint16_t ys = _using_partial_mode ? _pw_y + page_ys : page_ys;
+        uint16_t ye = _using_partial_mode ? gx_uint16_min(_pw_y + _pw_h, _pw_y + page_ye) : page_ye;
+        if (ye <= ys) continue; // not written in the first phase
+        uint32_t n = uint32_t(w / 8) * (ye - ys);
+        for (uint32_t i = 0; i < n; )
+        {
+          uint8_t h = *in++;
+          if (h < 128)
+          {
+            memcpy(_buffer + i, in, h + 1);
+            in += h + 1;
+            i += h + 1;
+          }
+          else
+          {
+            memset(_buffer + i, *in++, 257 - h);
+            i += 257 - h;
+          }
+        }
+        _writePage(_write_again, x, ys, w, ye - ys);
+      }
+      epd2.waitBackground();
+      _page_cache_used = 0;
+      return true;
+    }
+    void _setPageBuffer(uint8_t* buffer, uint32_t rows)
+    {
+      _page_height = rows < uint32_t(HEIGHT) ? rows : HEIGHT;
+      _pages = (HEIGHT / _page_height) + ((HEIGHT % _page_height) > 0);
+      _buffer = buffer;
+      _buffer_size = pageBufferSize(_page_height);
+      _current_page = 0;
+    }
   private:
-    uint8_t _buffer[(GxEPD2_Type::WIDTH / 8) * page_height];
-    bool _using_partial_mode, _second_phase, _mirror, _reverse;
+    uint8_t _instance_buffer[(GxEPD2_Type::WIDTH / 8) * (page_height > 0 ? page_height : 1)];
+    uint8_t* _buffer; // page buffer, of this instance or of the caller
+    uint32_t _buffer_size;
+    bool _using_partial_mode, _second_phase, _mirror, _reverse, _auto_partial, _shadow_valid;
+    uint8_t* _shadow;
+    uint8_t* _pipeline_buffer;
+    uint8_t* _page_cache;
+    uint32_t _page_cache_size, _page_cache_used; // used > size: overflow
+    PageWrite _pipeline_mode;
+    int16_t _pipeline_x, _pipeline_y, _pipeline_w, _pipeline_h;
     uint16_t _width_bytes, _pixel_bytes;
     int16_t _current_page;
     uint16_t _pages, _page_height;
     uint16_t _pw_x, _pw_y, _pw_w, _pw_h;
+    void (GxEPD2_BW::*_pixel_writer)(int16_t x, int16_t y, uint16_t color);
+    bool _async_again, _async_power_off;
+    int16_t _pixel_x0, _pixel_y0; // window origin, for flip from the opposite side
+    uint8_t _pixel_mode; // swap, flip_x, flip_y of the selected writer
+    uint16_t _dirty_xs, _dirty_ys, _dirty_xe, _dirty_ye;
 };
 
 #endif
@@ -0,0 +1,172 @@
+// Display Library for SPI e-paper panels from Dalian Good Display and boards from Waveshare.
+// Requires HW SPI and Adafruit_GFX. Caution: the e-paper panels require 3.3V supply AND data lines!
+//
+// GxEPD2_BmpReader: streaming BMP decoder for paged drawing, reads only the rows that fall into the current page
+//
+// Author: Jean-Marc Zingg
+//
+// Version: see library.properties
+//
+// Library: https://github.com/ZinggJM/GxEPD2
+
+#include "GxEPD2_BmpReader.h"
+
+bool GxEPD2_BmpReader::begin(bool with_color)
+{
+  _width = 0;
+  _height = 0;
+  if (_read16(0) != 0x4D42) return false; // BMP signature
+  _image_offset = _read32(10);
+  uint32_t header_size = _read32(14);
+  int32_t width = _read32(18);
+  int32_t height = _read32(22);
+  uint16_t planes = _read16(26);
+  _depth = _read16(28);
+  uint32_t format = _read32(30);
+  if ((planes != 1) || ((format != 0) && (format != 3))) return false; // uncompressed or bitfields
+  if ((_depth != 1) && (_depth != 2) && (_depth != 4) && (_depth != 8) && (_depth != 16) && (_depth != 24) && (_depth != 32)) return false;
+  if ((width <= 0) || (width > 0x7FFF) || (height == 0) || (height > 0x7FFF) || (height < -0x7FFF)) return false;
+  _flip = height > 0; // bottom-up
+  _width = width;
+  _height = _flip ? height : -height;
+  _row_size = ((uint32_t(_width) * _depth + 31) / 32) * 4; // rows are padded to 4 bytes
+  _format_565 = (format == 3) && (_depth == 16) && (_read32(14 + 40) == 0xF800); // red mask
+  _with_color = with_color && (_depth > 1);
+  if (_depth <= 8)
+  {
+    uint32_t colors = _read32(46);
+    if ((colors == 0) || (colors > (1u << _depth))) colors = 1u << _depth;
+    memset(_white_palette, 0, sizeof(_white_palette));
+    memset(_colored_palette, 0, sizeof(_colored_palette));
+    if (!_source.seek(14 + header_size)) return false;
+    for (uint16_t i = 0; i < colors; i++)
+    {
+      uint8_t bgra[4];
+      if (!_read(bgra, 4)) return false;
+      _classify(0, bgra[2], bgra[1], bgra[0]);
+      if (_white[0] & 0x80) _white_palette[i / 8] |= 0x80 >> (i % 8);
+      if (_colored[0] & 0x80) _colored_palette[i / 8] |= 0x80 >> (i % 8);
+#if !defined(__AVR)
+      _rgb_palette[i] = _rgb[0];
+#endif
+    }
+  }
+  return true;
+}
+
+bool GxEPD2_BmpReader::_startRow(uint16_t row, uint16_t column)
+{
+  uint32_t bit = uint32_t(column) * _depth;
+  _in_bits = 0;
+  if (!_source.seek(_image_offset + (_flip ? _height - 1 - row : row) * _row_size + bit / 8)) return false;
+  if (bit % 8)
+  {
+    if (!_read(&_in_byte, 1)) return false;
+    _in_byte <<= bit % 8;
+    _in_bits = 8 - bit % 8;
+  }
+  return true;
+}
+
+bool GxEPD2_BmpReader::_decode(uint16_t n)
+{
+  memset(_white, 0, sizeof(_white));
+  memset(_colored, 0, sizeof(_colored));
+  uint8_t* in = _input;
+  if (_depth < 8)
+  {
+    uint32_t bits = uint32_t(n) * _depth;
+    uint16_t bytes = bits > _in_bits ? (bits - _in_bits + 7) / 8 : 0;
+    if (!_read(_input, bytes)) return false;
+    uint8_t mask = 0xFF << (8 - _depth);
+    for (uint16_t i = 0; i < n; i++)
+    {
+      if (0 == _in_bits)
+      {
+        _in_byte = *in++;
+        _in_bits = 8;
+      }
+      uint8_t index = (_in_byte & mask) >> (8 - _depth);
+      _in_byte <<= _depth;
+      _in_bits -= _depth;
+      if (_white_palette[index / 8] & (0x80 >> (index % 8))) _white[i / 8] |= 0x80 >> (i % 8);
+      if (_colored_palette[index / 8] & (0x80 >> (index % 8))) _colored[i / 8] |= 0x80 >> (i % 8);
+#if !defined(__AVR)
+      _rgb[i] = _rgb_palette[index];
+#else
+      _rgb[i] = (_white[i / 8] & (0x80 >> (i % 8))) ? GxEPD_WHITE : (_colored[i / 8] & (0x80 >> (i % 8))) ? GxEPD_COLORED : GxEPD_BLACK;
+#endif
+    }
+    return true;
+  }
+  if (!_read(_input, n * (_depth / 8))) return false;
+  for (uint16_t i = 0; i < n; i++)
+  {
+    switch (_depth)
+    {
+      case 8:
+        {
+          uint8_t index = *in++;
+          if (_white_palette[index / 8] & (0x80 >> (index % 8))) _white[i / 8] |= 0x80 >> (i % 8);
+          if (_colored_palette[index / 8] & (0x80 >> (index % 8))) _colored[i / 8] |= 0x80 >> (i % 8);
+#if !defined(__AVR)
+          _rgb[i] = _rgb_palette[index];
+#else
+          _rgb[i] = (_white[i / 8] & (0x80 >> (i % 8))) ? GxEPD_WHITE : (_colored[i / 8] & (0x80 >> (i % 8))) ? GxEPD_COLORED : GxEPD_BLACK;
+#endif
+        }
+        break;
+      case 16:
+        {
+          uint8_t lsb = *in++;
+          uint8_t msb = *in++;
+          if (_format_565) _classify(i, msb & 0xF8, ((msb & 0x07) << 5) | ((lsb & 0xE0) >> 3), (lsb & 0x1F) << 3);
+          else _classify(i, (msb & 0x7C) << 1, ((msb & 0x03) << 6) | ((lsb & 0xE0) >> 2), (lsb & 0x1F) << 3); // 555
+        }
+        break;
+      case 24:
+        _classify(i, in[2], in[1], in[0]);
+        in += 3;
+        break;
+      case 32:
+        _classify(i, in[2], in[1], in[0]);
+        in += 4; // skip alpha
+        break;
+    }
+  }
+  return true;
+}
+
+// same criteria as the bitmap examples
+void GxEPD2_BmpReader::_classify(uint16_t i, uint8_t red, uint8_t green, uint8_t blue)
+{
+  bool whitish = _with_color ? ((red > 0x80) && (green > 0x80) && (blue > 0x80)) : ((red + green + blue) > 3 * 0x80);
+  bool colored = _with_color && ((red > 0xF0) || ((green > 0xF0) && (blue > 0xF0))); // reddish or yellowish?
+  if (i % 8 == 0)
+  {
+    _white[i / 8] &= ~(0xFF >> (i % 8));
+    _colored[i / 8] &= ~(0xFF >> (i % 8));
+  }
+  if (whitish) _white[i / 8] |= 0x80 >> (i % 8);
+  if (colored) _colored[i / 8] |= 0x80 >> (i % 8);
+  _rgb[i] = ((red & 0xF8) << 8) | ((green & 0xFC) << 3) | ((blue & 0xF8) >> 3);
+}
+
+bool GxEPD2_BmpReader::_read(uint8_t* buffer, uint16_t n)
+{
+  return (n == 0) || (_source.read(buffer, n) == int16_t(n));
+}
+
+uint16_t GxEPD2_BmpReader::_read16(uint32_t position)
+{
+  uint8_t b[2] = {0, 0};
+  if (_source.seek(position)) _read(b, 2);
+  return b[0] | (uint16_t(b[1]) << 8); // little-endian
+}
+
+uint32_t GxEPD2_BmpReader::_read32(uint32_t position)
+{
+  uint8_t b[4] = {0, 0, 0, 0};
+  if (_source.seek(position)) _read(b, 4);
+  return b[0] | (uint32_t(b[1]) << 8) | (uint32_t(b[2]) << 16) | (uint32_t(b[3]) << 24);
+}
@@ -0,0 +1,161 @@
+// Display Library for SPI e-paper panels from Dalian Good Display and boards from Waveshare.
+// Requires HW SPI and Adafruit_GFX. Caution: the e-paper panels require 3.3V supply AND data lines!
+//
+// GxEPD2_BmpReader: streaming BMP decoder for paged drawing, reads only the rows that fall into the current page
+// 1, 2, 4, 8, 16 (555 or 565), 24 and 32 bits per pixel, uncompressed or bitfields, bottom-up or top-down
+//
+// Author: Jean-Marc Zingg
+//
+// Version: see library.properties
+//
+// Library: https://github.com/ZinggJM/GxEPD2
+
+#ifndef _GxEPD2_BmpReader_H_
+#define _GxEPD2_BmpReader_H_
+
+#include <Arduino.h>
+#include <GxEPD2.h>
+#include "GxEPD2_ByteSource.h"
+#include "GxEPD2_Dither.h"
+
+// pixels decoded and drawn at a time, multiple of 8
+#if !defined(GxEPD2_BMP_CHUNK_PIXELS)
+#define GxEPD2_BMP_CHUNK_PIXELS 32
+#endif
+
+template<typename GxEPD2_Type, const uint16_t page_height> class GxEPD2_BW;
+template<typename GxEPD2_Type, const uint16_t page_height> class GxEPD2_4C;
+template<typename GxEPD2_Type, const uint16_t page_height> class GxEPD2_7C;
+
+class GxEPD2_BmpReader
+{
+  public:
+    GxEPD2_BmpReader(GxEPD2_ByteSource& source) : _source(source), _width(0), _height(0), _depth(0) {};
+    // reads header and palette; false if the format is not handled
+    // with_color false maps everything to black and white, as does a depth of 1
+    bool begin(bool with_color = true);
+    int16_t width()
+    {
+      return _width;
+    };
+    int16_t height()
+    {
+      return _height;
+    };
+    uint8_t depth()
+    {
+      return _depth;
+    };
+    bool withColor()
+    {
+      return _with_color;
+    };
+    // decodes n <= GxEPD2_BMP_CHUNK_PIXELS pixels of row from column, for own use of the pixels, e.g. in a converter
+    bool readPixels(uint16_t row, uint16_t column, uint16_t n)
+    {
+      return _startRow(row, column) && _decode(n);
+    };
+    // pixel i of the last readPixels() or chunk
+    bool isWhite(uint16_t i)
+    {
+      return _white[i / 8] & (0x80 >> (i % 8));
+    };
+    bool isColored(uint16_t i)
+    {
+      return _colored[i / 8] & (0x80 >> (i % 8));
+    };
+    uint16_t rgb(uint16_t i) // 565, on AVR the class colors for depth <= 8
+    {
+      return _rgb[i];
+    };
+    // draws the part of the bitmap at x, y that falls into the current page of display, call it in each page of the page loop
+    // GxEPD2_BW gets 8 pixels at a time through drawBitmap(), GxEPD2_4C and GxEPD2_7C get the colors, mapped by their drawPixel(),
+    // the others white, black or colored
+    // false on a read error
+    // with dither the 565 colors are dithered to the palette of dither, also on GxEPD2_BW
+    // error diffusion needs the rows in sequence, as they come with the pages of rotation 0, and the same dither for all pages
+    template<typename GxEPD2_Display> bool draw(GxEPD2_Display& display, int16_t x, int16_t y, GxEPD2_Dither* dither = 0)
+    {
+      int16_t px, py, pw, ph;
+      display.getPageWindow(px, py, pw, ph);
+      // intersection of bitmap, page and screen
+      int32_t xs = x > px ? x : px, xe = int32_t(x) + _width;
+      int32_t ys = y > py ? y : py, ye = int32_t(y) + _height;
+      if (xs < 0) xs = 0;
+      if (ys < 0) ys = 0;
+      if (xe > int32_t(px) + pw) xe = int32_t(px) + pw;
+      if (ye > int32_t(py) + ph) ye = int32_t(py) + ph;
+      if (xe > display.width()) xe = display.width();
+      if (ye > display.height()) ye = display.height();
+      if (xs >= xe) return true; // nothing of this page
+      for (int32_t yd = ys; yd < ye; yd++)
+      {
+        if (!_startRow(yd - y, xs - x)) return false;
+        for (int32_t xd = xs; xd < xe; xd += GxEPD2_BMP_CHUNK_PIXELS)
+        {
+          uint16_t n = xe - xd < GxEPD2_BMP_CHUNK_PIXELS ? xe - xd : GxEPD2_BMP_CHUNK_PIXELS;
+          if (!_decode(n)) return false;
+          if (dither)
+          {
+            dither->dither(xd, yd, _rgb, n);
+            for (uint16_t i = 0; i < n; i++) display.drawPixel(xd + i, yd, _rgb[i]);
+          }
+          else _drawChunk(display, xd, yd, n);
+        }
+      }
+      return true;
+    };
+  private:
+    template<typename GxEPD2_Display> void _drawChunk(GxEPD2_Display& display, int16_t x, int16_t y, uint16_t n)
+    {
+      for (uint16_t i = 0; i < n; i++)
+      {
+        uint16_t color = isWhite(i) ? GxEPD_WHITE : isColored(i) ? GxEPD_COLORED : GxEPD_BLACK;
+        display.drawPixel(x + i, y, color);
+      }
+    };
+    template<typename GxEPD2_Type, const uint16_t page_height> void _drawChunk(GxEPD2_BW<GxEPD2_Type, page_height>& display, int16_t x, int16_t y, uint16_t n)
+    {
+      for (uint16_t i = 0; i < sizeof(_white); i++) _white[i] |= _colored[i]; // colored is white on GxEPD2_BW, as with drawPixel()
+      display.drawBitmap(x, y, _white, n, 1, GxEPD_WHITE, GxEPD_BLACK);
+    };
+    template<typename GxEPD2_Type, const uint16_t page_height> void _drawChunk(GxEPD2_4C<GxEPD2_Type, page_height>& display, int16_t x, int16_t y, uint16_t n)
+    {
+      for (uint16_t i = 0; i < n; i++)
+      {
+        display.drawPixel(x + i, y, _with_color ? _rgb[i] : isWhite(i) ? GxEPD_WHITE : GxEPD_BLACK);
+      }
+    };
+    template<typename GxEPD2_Type, const uint16_t page_height> void _drawChunk(GxEPD2_7C<GxEPD2_Type, page_height>& display, int16_t x, int16_t y, uint16_t n)
+    {
+      for (uint16_t i = 0; i < n; i++)
+      {
+        display.drawPixel(x + i, y, _with_color ? _rgb[i] : isWhite(i) ? GxEPD_WHITE : GxEPD_BLACK);
+      }
+    };
+    bool _startRow(uint16_t row, uint16_t column);
+    bool _decode(uint16_t n);
+    void _classify(uint16_t i, uint8_t red, uint8_t green, uint8_t blue);
+    bool _read(uint8_t* buffer, uint16_t n);
+    uint16_t _read16(uint32_t position);
+    uint32_t _read32(uint32_t position);
+    GxEPD2_ByteSource& _source;
+    int16_t _width, _height;
+    uint8_t _depth;
+    bool _flip, _format_565, _with_color;
+    uint32_t _image_offset, _row_size;
+    uint8_t _in_byte, _in_bits; // for depth < 8
+    uint8_t _input[GxEPD2_BMP_CHUNK_PIXELS * 4];
+    // output of _decode(), 1 is white or colored, msb first
+    uint8_t _white[GxEPD2_BMP_CHUNK_PIXELS / 8];
+    uint8_t _colored[GxEPD2_BMP_CHUNK_PIXELS / 8];
+    uint16_t _rgb[GxEPD2_BMP_CHUNK_PIXELS]; // 565
+    // palette, 1 bit per index
+    uint8_t _white_palette[256 / 8];
+    uint8_t _colored_palette[256 / 8];
+#if !defined(__AVR)
+    uint16_t _rgb_palette[256]; // 565
+#endif
+};
+
+#endif
@@ -0,0 +1,34 @@
+// Display Library for SPI e-paper panels from Dalian Good Display and boards from Waveshare.
+// Requires HW SPI and Adafruit_GFX. Caution: the e-paper panels require 3.3V supply AND data lines!
+//
+// GxEPD2_ByteSource: seekable sources of bytes for GxEPD2_BmpReader and GxEPD2_NativeReader
+//
+// Author: Jean-Marc Zingg
+//
+// Version: see library.properties
+//
+// Library: https://github.com/ZinggJM/GxEPD2
+
+#include "GxEPD2_ByteSource.h"
+
+#if defined(ESP8266) || defined(ESP32)
+#include <pgmspace.h>
+#else
+#include <avr/pgmspace.h>
+#endif
+
+bool GxEPD2_MemorySource::seek(uint32_t position)
+{
+  if (position > _size) return false;
+  _position = position;
+  return true;
+}
+
+int16_t GxEPD2_MemorySource::read(uint8_t* buffer, uint16_t n)
+{
+  if (n > _size - _position) n = _size - _position;
+  if (_pgm) memcpy_P(buffer, _data + _position, n);
+  else memcpy(buffer, _data + _position, n);
+  _position += n;
+  return n;
+}
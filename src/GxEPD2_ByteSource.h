@@ -0,0 +1,55 @@
+// Display Library for SPI e-paper panels from Dalian Good Display and boards from Waveshare.
+// Requires HW SPI and Adafruit_GFX. Caution: the e-paper panels require 3.3V supply AND data lines!
+//
+// GxEPD2_ByteSource: seekable sources of bytes for GxEPD2_BmpReader and GxEPD2_NativeReader
+//
+// Author: Jean-Marc Zingg
+//
+// Version: see library.properties
+//
+// Library: https://github.com/ZinggJM/GxEPD2
+
+#ifndef _GxEPD2_ByteSource_H_
+#define _GxEPD2_ByteSource_H_
+
+#include <Arduino.h>
+
+// seekable source of bytes, e.g. a File, see GxEPD2_FileSource and GxEPD2_MemorySource
+class GxEPD2_ByteSource
+{
+  public:
+    virtual bool seek(uint32_t position) = 0;
+    virtual int16_t read(uint8_t* buffer, uint16_t n) = 0; // returns the number of bytes read
+};
+
+// File of SD, SdFat, LittleFS, SPIFFS or any class with seek(position) and read(buffer, n)
+template<typename FileType> class GxEPD2_FileSource : public GxEPD2_ByteSource
+{
+  public:
+    GxEPD2_FileSource(FileType& file) : _file(file) {};
+    bool seek(uint32_t position)
+    {
+      return _file.seek(position);
+    };
+    int16_t read(uint8_t* buffer, uint16_t n)
+    {
+      return _file.read(buffer, n);
+    };
+  private:
+    FileType& _file;
+};
+
+// file contents in RAM, or in PROGMEM with pgm true
+class GxEPD2_MemorySource : public GxEPD2_ByteSource
+{
+  public:
+    GxEPD2_MemorySource(const uint8_t* data, uint32_t size, bool pgm = false) : _data(data), _size(size), _position(0), _pgm(pgm) {};
+    bool seek(uint32_t position);
+    int16_t read(uint8_t* buffer, uint16_t n);
+  private:
+    const uint8_t* _data;
+    uint32_t _size, _position;
+    bool _pgm;
+};
+
+#endif
@@ -0,0 +1,55 @@
+// Display Library for SPI e-paper panels from Dalian Good Display and boards from Waveshare.
+// Requires HW SPI and Adafruit_GFX. Caution: the e-paper panels require 3.3V supply AND data lines!
+//
+// GxEPD2_ColorMap: table driven mapping of RGB565 colors to the pixel values of 4-color and 7-color panels
+//
+// Author: Jean-Marc Zingg
+//
+// Version: see library.properties
+//
+// Library: https://github.com/ZinggJM/GxEPD2
+
+#include "GxEPD2_ColorMap.h"
+
+// black if no component is in the upper half, white if all are; red and blue, or green and blue, by the larger one;
+// red with green in the upper quarter is yellow, in the second quarter orange; else the single component in the upper half
+// entries of index combinations that can't occur are 0
+const uint8_t GxEPD2_ColorMap::Map7C[64] PROGMEM =
+{
+  0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x03, 0x01, 0x00, 0x00, 0x03, 0x01,
+  0x00, 0x04, 0x00, 0x04, 0x00, 0x06, 0x00, 0x04, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x02, 0x01, 0x02, 0x00, 0x02, 0x01,
+  0x00, 0x04, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x02, 0x06, 0x00, 0x01, 0x02, 0x05, 0x00, 0x01
+};
+
+// as Map7C, but red and blue is red, green and blue is white, orange is red, green alone is black, blue alone is red
+const uint8_t GxEPD2_ColorMap::Map4C[64] PROGMEM =
+{
+  0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01,
+  0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01,
+  0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x01, 0x00, 0x02, 0x00, 0x01
+};
+
+void GxEPD2_ColorMap::row7(const uint16_t* rgb, uint8_t* native, uint16_t n)
+{
+  for (; n >= 2; n -= 2, rgb += 2)
+  {
+    *native++ = pack2(color7(rgb[0]), color7(rgb[1]));
+  }
+  if (n) *native = pack2(color7(rgb[0]), 0x01);
+}
+
+void GxEPD2_ColorMap::row4(const uint16_t* rgb, uint8_t* native, uint16_t n)
+{
+  for (; n >= 4; n -= 4, rgb += 4)
+  {
+    *native++ = pack4(color4(rgb[0]), color4(rgb[1]), color4(rgb[2]), color4(rgb[3]));
+  }
+  if (n)
+  {
+    uint8_t v[4] = {0x01, 0x01, 0x01, 0x01};
+    for (uint8_t i = 0; i < n; i++) v[i] = color4(rgb[i]);
+    *native = pack4(v[0], v[1], v[2], v[3]);
+  }
+}
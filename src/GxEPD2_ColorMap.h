@@ -0,0 +1,66 @@
+// Display Library for SPI e-paper panels from Dalian Good Display and boards from Waveshare.
+// Requires HW SPI and Adafruit_GFX. Caution: the e-paper panels require 3.3V supply AND data lines!
+//
+// GxEPD2_ColorMap: table driven mapping of RGB565 colors to the pixel values of 4-color and 7-color panels, gray levels,
+// and packing of pixel values to the bytes of the native pixel format
+//
+// Author: Jean-Marc Zingg
+//
+// Version: see library.properties
+//
+// Library: https://github.com/ZinggJM/GxEPD2
+
+#ifndef _GxEPD2_ColorMap_H_
+#define _GxEPD2_ColorMap_H_
+
+#include <Arduino.h>
+#include <GxEPD2.h>
+
+class GxEPD2_ColorMap
+{
+  public:
+    // pixel values, indexed by index(color), of the 7-color panels: 0 black, 1 white, 2 green, 3 blue, 4 red, 5 yellow, 6 orange
+    static const uint8_t Map7C[64];
+    // pixel values, indexed by index(color), of the 4-color panels: 0 black, 1 white, 2 yellow, 3 red
+    static const uint8_t Map4C[64];
+    // the bits the color decision depends on: red, blue and green halves, green quarters, red > blue, green > blue
+    static uint8_t index(uint16_t color)
+    {
+      uint8_t red = color >> 11, green = (color >> 5) & 0x3F, blue = color & 0x1F;
+      return (red >> 4) | ((blue >> 4) << 1) | ((green >> 4) << 2) | ((red > blue) << 4) | ((green > 2 * blue) << 5);
+    };
+    // value of color for the pixel buffer of GxEPD2_7C
+    static uint8_t color7(uint16_t color)
+    {
+      return pgm_read_byte(&Map7C[index(color)]);
+    };
+    // value of color for the pixel buffer of GxEPD2_4C; green and orange show as yellow, blue as black
+    static uint8_t color4(uint16_t color)
+    {
+      if ((color == GxEPD_GREEN) || (color == GxEPD_ORANGE)) return 0x02;
+      if (color == GxEPD_BLUE) return 0x00;
+      return pgm_read_byte(&Map4C[index(color)]);
+    };
+    // value of color for the pixel buffer of GxEPD2_16G: nearest of 16 gray levels of the luminance, 0 black to 15 white
+    static uint8_t gray16(uint16_t color)
+    {
+      uint16_t red = (color >> 8) & 0xF8, green = (color >> 3) & 0xFC, blue = (color << 3) & 0xF8;
+      return (((77 * red + 150 * green + 29 * blue) >> 8) + 8) / 17;
+    };
+    // two 4 bit pixel values to a byte, first pixel in the most significant bits
+    static uint8_t pack2(uint8_t v0, uint8_t v1)
+    {
+      return (v0 << 4) | v1;
+    };
+    // four 2 bit pixel values to a byte, first pixel in the most significant bits
+    static uint8_t pack4(uint8_t v0, uint8_t v1, uint8_t v2, uint8_t v3)
+    {
+      return (v0 << 6) | (v1 << 4) | (v2 << 2) | v3;
+    };
+    // n RGB565 pixels to (n + 1) / 2 bytes of the 7-color format, an odd last pixel is padded with white
+    static void row7(const uint16_t* rgb, uint8_t* native, uint16_t n);
+    // n RGB565 pixels to (n + 3) / 4 bytes of the 4-color format, the last byte is padded with white
+    static void row4(const uint16_t* rgb, uint8_t* native, uint16_t n);
+};
+
+#endif
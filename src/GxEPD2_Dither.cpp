@@ -0,0 +1,162 @@
+// Display Library for SPI e-paper panels from Dalian Good Display and boards from Waveshare.
+// Requires HW SPI and Adafruit_GFX. Caution: the e-paper panels require 3.3V supply AND data lines!
+//
+// GxEPD2_Dither: dithering of RGB565 rows to the colors of a panel, row by row, as the rows come in the page loop
+//
+// Author: Jean-Marc Zingg
+//
+// Version: see library.properties
+//
+// Library: https://github.com/ZinggJM/GxEPD2
+
+#include "GxEPD2_Dither.h"
+
+const GxEPD2_Dither::Color GxEPD2_Dither::PaletteBW[2] =
+{
+  {GxEPD_BLACK, 0, 0, 0}, {GxEPD_WHITE, 255, 255, 255}
+};
+
+const GxEPD2_Dither::Color GxEPD2_Dither::Palette3C[3] =
+{
+  {GxEPD_BLACK, 0, 0, 0}, {GxEPD_WHITE, 255, 255, 255}, {GxEPD_RED, 255, 0, 0}
+};
+
+const GxEPD2_Dither::Color GxEPD2_Dither::Palette3CY[3] =
+{
+  {GxEPD_BLACK, 0, 0, 0}, {GxEPD_WHITE, 255, 255, 255}, {GxEPD_YELLOW, 255, 255, 0}
+};
+
+const GxEPD2_Dither::Color GxEPD2_Dither::Palette4C[4] =
+{
+  {GxEPD_BLACK, 0, 0, 0}, {GxEPD_WHITE, 255, 255, 255}, {GxEPD_YELLOW, 255, 255, 0}, {GxEPD_RED, 255, 0, 0}
+};
+
+const GxEPD2_Dither::Color GxEPD2_Dither::Palette7C[7] =
+{
+  {GxEPD_BLACK, 0, 0, 0}, {GxEPD_WHITE, 255, 255, 255}, {GxEPD_GREEN, 0, 255, 0}, {GxEPD_BLUE, 0, 0, 255},
+  {GxEPD_RED, 255, 0, 0}, {GxEPD_YELLOW, 255, 255, 0}, {GxEPD_ORANGE, 255, 128, 0}
+};
+
+GxEPD2_Dither::GxEPD2_Dither(Method method, const Color* palette, uint8_t colors, int16_t* error_buffer, uint16_t width) :
+  _method(method), _palette(palette), _colors(colors), _buffer(error_buffer), _width(width)
+{
+  if ((_method >= FloydSteinberg) && ((0 == _buffer) || (0 == _width))) _method = Ordered;
+  reset();
+}
+
+void GxEPD2_Dither::reset()
+{
+  _current = _buffer;
+  _next = _buffer + 3 * uint32_t(_width);
+  if (_buffer) memset(_buffer, 0, bufferSize(_method, _width) * sizeof(int16_t));
+  memset(_right, 0, sizeof(_right));
+  memset(_right2, 0, sizeof(_right2));
+  memset(_below, 0, sizeof(_below));
+  memset(_below_next, 0, sizeof(_below_next));
+  _x0 = _x = _y = -0x7FFF;
+}
+
+void GxEPD2_Dither::dither(int16_t x, int16_t y, uint16_t* rgb, uint16_t n)
+{
+  // 4x4 Bayer matrix, for Ordered
+  static const uint8_t bayer[4][4] = {{0, 8, 2, 10}, {12, 4, 14, 6}, {3, 11, 1, 9}, {15, 7, 13, 5}};
+  if ((_method >= FloydSteinberg) && ((y != _y) || (x != _x))) // not the continuation of the row in work
+  {
+    if ((y == _y + 1) && (x == _x0)) _endRow();
+    else
+    {
+      reset();
+      _x0 = x;
+    }
+    _y = y;
+  }
+  for (uint16_t i = 0; i < n; i++)
+  {
+    // 565 to 888
+    int16_t c[3] = {int16_t((rgb[i] >> 8) & 0xF8), int16_t((rgb[i] >> 3) & 0xFC), int16_t((rgb[i] << 3) & 0xF8)};
+    int32_t column = int32_t(x) + i - _x0;
+    if (_method == Ordered)
+    {
+      int16_t offset = (2 * bayer[y & 3][(x + i) & 3] - 15) * 4; // -60 .. 60
+      for (uint8_t k = 0; k < 3; k++) c[k] += offset;
+    }
+    if ((_method < FloydSteinberg) || (column >= _width))
+    {
+      rgb[i] = _palette[_nearest(c[0], c[1], c[2])].color;
+      continue;
+    }
+    for (uint8_t k = 0; k < 3; k++)
+    {
+      c[k] += _current[3 * column + k] + _right[k];
+      if (c[k] < 0) c[k] = 0;
+      if (c[k] > 255) c[k] = 255;
+    }
+    const Color& p = _palette[_nearest(c[0], c[1], c[2])];
+    rgb[i] = p.color;
+    int16_t e[3] = {int16_t(c[0] - p.red), int16_t(c[1] - p.green), int16_t(c[2] - p.blue)};
+    for (uint8_t k = 0; k < 3; k++)
+    {
+      if (_method == FloydSteinberg)
+      {
+        // 7/16 right, 3/16 below left, 5/16 below, 1/16 below right; the buffer holds the next row behind this column
+        int16_t right = e[k] * 7 / 16, below_left = e[k] * 3 / 16, below = e[k] * 5 / 16;
+        if (column > 0) _current[3 * (column - 1) + k] = _below[k] + below_left;
+        _below[k] = _below_next[k] + below;
+        _below_next[k] = e[k] - right - below_left - below;
+        _right[k] = right;
+      }
+      else
+      {
+        // 1/8 to the next two pixels, to below left, below, below right, and two rows below
+        int16_t e8 = e[k] / 8;
+        _right[k] = _right2[k] + e8;
+        _right2[k] = e8;
+        if (column > 0) _next[3 * (column - 1) + k] += e8;
+        _next[3 * column + k] += e8;
+        if (column + 1 < _width) _next[3 * (column + 1) + k] += e8;
+        _current[3 * column + k] = e8; // now for the row after the next
+      }
+    }
+  }
+  _x = x + n;
+}
+
+// completes the row in work, for the next row
+void GxEPD2_Dither::_endRow()
+{
+  int32_t last = int32_t(_x) - 1 - _x0;
+  if (_method == FloydSteinberg)
+  {
+    if ((last >= 0) && (last < _width))
+    {
+      for (uint8_t k = 0; k < 3; k++) _current[3 * last + k] = _below[k];
+    }
+  }
+  else
+  {
+    int16_t* current = _current;
+    _current = _next;
+    _next = current;
+  }
+  memset(_right, 0, sizeof(_right));
+  memset(_right2, 0, sizeof(_right2));
+  memset(_below, 0, sizeof(_below));
+  memset(_below_next, 0, sizeof(_below_next));
+}
+
+uint8_t GxEPD2_Dither::_nearest(int16_t red, int16_t green, int16_t blue)
+{
+  uint8_t nearest = 0;
+  uint32_t min_distance = 0xFFFFFFFF;
+  for (uint8_t i = 0; i < _colors; i++)
+  {
+    int32_t dr = red - _palette[i].red, dg = green - _palette[i].green, db = blue - _palette[i].blue;
+    uint32_t distance = dr * dr + dg * dg + db * db;
+    if (distance < min_distance)
+    {
+      min_distance = distance;
+      nearest = i;
+    }
+  }
+  return nearest;
+}
@@ -0,0 +1,63 @@
+// Display Library for SPI e-paper panels from Dalian Good Display and boards from Waveshare.
+// Requires HW SPI and Adafruit_GFX. Caution: the e-paper panels require 3.3V supply AND data lines!
+//
+// GxEPD2_Dither: dithering of RGB565 rows to the colors of a panel, row by row, as the rows come in the page loop
+// error diffusion (Floyd-Steinberg or Atkinson) with an error buffer of one or two rows, or ordered (Bayer 4x4) without
+//
+// Author: Jean-Marc Zingg
+//
+// Version: see library.properties
+//
+// Library: https://github.com/ZinggJM/GxEPD2
+
+#ifndef _GxEPD2_Dither_H_
+#define _GxEPD2_Dither_H_
+
+#include <Arduino.h>
+#include <GxEPD2.h>
+
+class GxEPD2_Dither
+{
+  public:
+    enum Method {Nearest, Ordered, FloydSteinberg, Atkinson};
+    struct Color
+    {
+      uint16_t color; // as for drawPixel(), e.g. GxEPD_RED
+      uint8_t red, green, blue; // as it looks on the panel
+    };
+    // colors of the panel types
+    static const Color PaletteBW[2];
+    static const Color Palette3C[3]; // red
+    static const Color Palette3CY[3]; // yellow
+    static const Color Palette4C[4];
+    static const Color Palette7C[7];
+    // int16_t entries of the error buffer, for rows of up to width pixels: 3 per pixel, twice for Atkinson
+    static uint32_t bufferSize(Method method, uint16_t width)
+    {
+      return method == Atkinson ? 6 * uint32_t(width) : method == FloydSteinberg ? 3 * uint32_t(width) : 0;
+    };
+    // error_buffer of bufferSize(method, width) entries, not needed for Nearest and Ordered
+    // without error_buffer error diffusion falls back to Ordered
+    GxEPD2_Dither(Method method, const Color* palette, uint8_t colors, int16_t* error_buffer = 0, uint16_t width = 0);
+    // forget the error of previous rows, e.g. for the next picture; done anyway if a row doesn't follow the previous one
+    void reset();
+    // replaces the n RGB565 pixels of row y from column x by colors of the palette
+    // the error is diffused to the following pixels of the row and to the next row(s), if they come next:
+    // a row follows if it starts at the column of the previous one; a row may come in pieces, e.g. by chunks
+    void dither(int16_t x, int16_t y, uint16_t* rgb, uint16_t n);
+  private:
+    uint8_t _nearest(int16_t red, int16_t green, int16_t blue);
+    void _endRow();
+    Method _method;
+    const Color* _palette;
+    uint8_t _colors;
+    int16_t* _buffer;
+    uint16_t _width;
+    int16_t* _current; // errors for this row, then for the row after the next (Atkinson)
+    int16_t* _next; // errors for the next row (Atkinson)
+    int16_t _x0, _x, _y; // start column and next pixel of the row in work
+    int16_t _right[3], _right2[3]; // errors for the next pixels of the row
+    int16_t _below[3], _below_next[3]; // errors for the next row at the previous and this column (Floyd-Steinberg)
+};
+
+#endif
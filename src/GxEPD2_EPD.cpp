@@ -17,6 +17,34 @@
 #include <avr/pgmspace.h>
 #endif
 
+// chunk size for bulk transfers on processors without writeBytes/writePattern, on stack
+#if !defined(GxEPD2_TRANSFER_CHUNK_SIZE)
+#define GxEPD2_TRANSFER_CHUNK_SIZE 64
+#endif
+
+#if defined(ESP8266) || defined(ESP32)
+#define GxEPD2_ISR_ATTR IRAM_ATTR
+#else
+#define GxEPD2_ISR_ATTR
+#endif
+
+// page pipeline in a task on the other core; on a single core the transfer is done right away
+#if defined(ESP32) && !defined(CONFIG_FREERTOS_UNICORE)
+#define GxEPD2_BACKGROUND_TASK
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/semphr.h>
+#if !defined(GxEPD2_BACKGROUND_STACK_SIZE)
+#define GxEPD2_BACKGROUND_STACK_SIZE 4096
+#endif
+#endif
+
+#if defined(ENABLE_GxEPD2_STATISTICS)
+#define GxEPD2_COUNT(counter, n) _statistics.counter += (n)
+#else
+#define GxEPD2_COUNT(counter, n)
+#endif
+
 GxEPD2_EPD::GxEPD2_EPD(int16_t cs, int16_t dc, int16_t rst, int16_t busy, int16_t busy_level, uint32_t busy_timeout,
                        uint16_t w, uint16_t h, GxEPD2::Panel p, bool c, bool pu, bool fpu) :
   WIDTH(w), HEIGHT(h), panel(p), hasColor(c), hasPartialUpdate(pu), hasFastPartialUpdate(fpu),
@@ -32,6 +60,23 @@ GxEPD2_EPD::GxEPD2_EPD(int16_t cs, int16_t dc, int16_t rst, int16_t busy, int16_
   _reset_duration = 10;
   _busy_callback = 0;
   _busy_callback_parameter = 0;
+  _refresh_callback = 0;
+  _refresh_callback_parameter = 0;
+  _async_step = 0;
+  _async_step_parameter = 0;
+  _async_mode = false;
+  _async_pending = false;
+  _busy_interrupt = false;
+  _busy_released = false;
+  _async_comment = 0;
+  _background_job = 0;
+  _background_job_parameter = 0;
+  _background_busy = false;
+  _background_task = 0;
+  _background_done = 0;
+  _async_busy_time = 0;
+  _async_start = 0;
+  resetStatistics();
 }
 
 void GxEPD2_EPD::init(uint32_t serial_diag_bitrate)
@@ -88,6 +133,7 @@ void GxEPD2_EPD::init(uint32_t serial_diag_bitrate, bool initial, uint16_t reset
 
 void GxEPD2_EPD::end()
 {
+  waitBackground();
   _pSPIx->end();
   if (_cs >= 0) pinMode(_cs, INPUT);
   if (_dc >= 0) pinMode(_dc, INPUT);
@@ -100,14 +146,197 @@ void GxEPD2_EPD::setBusyCallback(void (*busyCallback)(const void*), const void*
   _busy_callback_parameter = busy_callback_parameter;
 }
 
+void GxEPD2_EPD::refreshAsync(bool partial_update_mode)
+{
+  _startAsync();
+  refresh(partial_update_mode);
+  _async_mode = false;
+}
+
+void GxEPD2_EPD::refreshAsync(int16_t x, int16_t y, int16_t w, int16_t h)
+{
+  _startAsync();
+  refresh(x, y, w, h);
+  _async_mode = false;
+}
+
+void GxEPD2_EPD::powerOffAsync()
+{
+  _startAsync();
+  powerOff();
+  _async_mode = false;
+}
+
+bool GxEPD2_EPD::isBusy()
+{
+  if (!_async_pending) return false;
+  unsigned long elapsed = micros() - _async_start;
+  if (_busy >= 0)
+  {
+    if (elapsed < 1000) return true; // margin to become active, as in _waitWhileBusy()
+    if (elapsed > _busy_timeout) Serial.println("Busy Timeout!");
+    else if (_busy_interrupt && !_busy_released) return true;
+    else if (digitalRead(_busy) == _busy_level) return true;
+  }
+  else if (elapsed < 1000ul * _async_busy_time) return true;
+  _endAsync();
+  return _async_pending; // a step may have started the next async operation
+}
+
+void GxEPD2_EPD::waitWhileBusy()
+{
+  while (isBusy())
+  {
+    if (_busy_callback) _busy_callback(_busy_callback_parameter);
+    else delay(1);
+#if defined(ESP8266) || defined(ESP32)
+    yield(); // avoid wdt
+#endif
+  }
+}
+
+void GxEPD2_EPD::setRefreshCallback(void (*refreshCallback)(const void*), const void* refresh_callback_parameter)
+{
+  _refresh_callback = refreshCallback;
+  _refresh_callback_parameter = refresh_callback_parameter;
+}
+
+void GxEPD2_EPD::setAsyncStep(void (*asyncStep)(void*), void* async_step_parameter)
+{
+  _async_step = asyncStep;
+  _async_step_parameter = async_step_parameter;
+}
+
+void GxEPD2_EPD::runInBackground(void (*job)(void*), void* job_parameter)
+{
+  waitBackground();
+#if defined(GxEPD2_BACKGROUND_TASK)
+  if (!_background_task)
+  {
+    _background_done = xSemaphoreCreateBinary();
+    TaskHandle_t task = 0;
+    if (_background_done) xTaskCreatePinnedToCore(_backgroundTask, "GxEPD2", GxEPD2_BACKGROUND_STACK_SIZE, this,
+          uxTaskPriorityGet(0), &task, xPortGetCoreID() ? 0 : 1);
+    _background_task = task;
+  }
+  if (_background_task)
+  {
+    _background_job = job;
+    _background_job_parameter = job_parameter;
+    _background_busy = true;
+    xTaskNotifyGive(TaskHandle_t(_background_task));
+    return;
+  }
+#endif
+  job(job_parameter);
+}
+
+void GxEPD2_EPD::waitBackground()
+{
+#if defined(GxEPD2_BACKGROUND_TASK)
+  while (_background_busy) xSemaphoreTake(SemaphoreHandle_t(_background_done), portMAX_DELAY);
+#endif
+}
+
+void GxEPD2_EPD::_backgroundTask(void* epd)
+{
+#if defined(GxEPD2_BACKGROUND_TASK)
+  GxEPD2_EPD* self = static_cast<GxEPD2_EPD*>(epd);
+  while (true)
+  {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    self->_background_job(self->_background_job_parameter);
+    self->_background_busy = false;
+    xSemaphoreGive(SemaphoreHandle_t(self->_background_done));
+  }
+#endif
+}
+
+// attachInterrupt() has no parameter, one instance; attachInterruptArg() on ESP8266 and ESP32
+GxEPD2_EPD* GxEPD2_EPD::_busy_interrupt_epd = 0;
+
+void GxEPD2_ISR_ATTR GxEPD2_EPD::_busyReleased(void* epd)
+{
+  static_cast<GxEPD2_EPD*>(epd)->_busy_released = true;
+}
+
+void GxEPD2_ISR_ATTR GxEPD2_EPD::_busyReleasedISR()
+{
+  if (_busy_interrupt_epd) _busy_interrupt_epd->_busy_released = true;
+}
+
+bool GxEPD2_EPD::enableBusyInterrupt(bool enable)
+{
+  if ((_busy < 0) || (digitalPinToInterrupt(_busy) < 0)) return false;
+  if (_busy_interrupt) detachInterrupt(digitalPinToInterrupt(_busy));
+  _busy_interrupt = false;
+  if (!enable) return true;
+  int mode = _busy_level == HIGH ? FALLING : RISING;
+#if defined(ESP8266) || defined(ESP32)
+  attachInterruptArg(digitalPinToInterrupt(_busy), _busyReleased, this, mode);
+#else
+  _busy_interrupt_epd = this;
+  attachInterrupt(digitalPinToInterrupt(_busy), _busyReleasedISR, mode);
+#endif
+  _busy_interrupt = true;
+  return true;
+}
+
+void GxEPD2_EPD::_startAsync()
+{
+  _waitAsync();
+  _async_mode = true;
+}
+
+void GxEPD2_EPD::_endAsync()
+{
+  _async_pending = false;
+  GxEPD2_COUNT(busy_waits, 1);
+  GxEPD2_COUNT(busy_time_us, micros() - _async_start);
+#if !defined(DISABLE_DIAGNOSTIC_OUTPUT)
+  if (_async_comment && _diag_enabled)
+  {
+    Serial.print(_async_comment);
+    Serial.print(" : ");
+    Serial.println(micros() - _async_start);
+  }
+#endif
+  if (_async_mode) return; // wait inside the sequence, before its next command
+  if (_async_step)
+  {
+    void (*step)(void*) = _async_step;
+    _async_step = 0;
+    step(_async_step_parameter);
+  }
+  if (!_async_pending && _refresh_callback) _refresh_callback(_refresh_callback_parameter);
+}
+
 void GxEPD2_EPD::selectSPI(SPIClass& spi, SPISettings spi_settings)
 {
   _pSPIx = &spi;
   _spi_settings = spi_settings;
 }
 
+GxEPD2_EPD::Statistics GxEPD2_EPD::getStatistics()
+{
+#if defined(ENABLE_GxEPD2_STATISTICS)
+  return _statistics;
+#else
+  Statistics none = {0, 0, 0, 0, 0, 0};
+  return none;
+#endif
+}
+
+void GxEPD2_EPD::resetStatistics()
+{
+#if defined(ENABLE_GxEPD2_STATISTICS)
+  memset(&_statistics, 0, sizeof(_statistics));
+#endif
+}
+
 void GxEPD2_EPD::_reset()
 {
+  _waitAsync();
   if (_rst >= 0)
   {
     if (_pulldown_rst_mode)
@@ -136,6 +365,16 @@ void GxEPD2_EPD::_reset()
 
 void GxEPD2_EPD::_waitWhileBusy(const char* comment, uint16_t busy_time)
 {
+  _waitAsync();
+  if (_async_mode) // deferred, completed by isBusy() or before the next command
+  {
+    _async_pending = true;
+    _async_comment = comment;
+    _async_busy_time = busy_time;
+    _busy_released = false;
+    _async_start = micros();
+    return;
+  }
   if (_busy >= 0)
   {
     delay(1); // add some margin to become active
@@ -155,6 +394,8 @@ void GxEPD2_EPD::_waitWhileBusy(const char* comment, uint16_t busy_time)
       yield(); // avoid wdt
 #endif
     }
+    GxEPD2_COUNT(busy_waits, 1);
+    GxEPD2_COUNT(busy_time_us, micros() - start);
     if (comment)
     {
 #if !defined(DISABLE_DIAGNOSTIC_OUTPUT)
@@ -169,15 +410,25 @@ void GxEPD2_EPD::_waitWhileBusy(const char* comment, uint16_t busy_time)
     }
     (void) start;
   }
-  else delay(busy_time);
+  else
+  {
+    delay(busy_time);
+    GxEPD2_COUNT(busy_waits, 1);
+    GxEPD2_COUNT(busy_time_us, 1000ul * busy_time);
+  }
 }
 
 void GxEPD2_EPD::_writeCommand(uint8_t c)
 {
+  _waitAsync();
   _pSPIx->beginTransaction(_spi_settings);
   if (_dc >= 0) digitalWrite(_dc, LOW);
   if (_cs >= 0) digitalWrite(_cs, LOW);
   _pSPIx->transfer(c);
+  GxEPD2_COUNT(transactions, 1);
+  GxEPD2_COUNT(cs_selects, _cs >= 0);
+  GxEPD2_COUNT(commands, 1);
+  GxEPD2_COUNT(spi_bytes, 1);
   if (_cs >= 0) digitalWrite(_cs, HIGH);
   if (_dc >= 0) digitalWrite(_dc, HIGH);
   _pSPIx->endTransaction();
@@ -185,45 +436,49 @@ void GxEPD2_EPD::_writeCommand(uint8_t c)
 
 void GxEPD2_EPD::_writeData(uint8_t d)
 {
+  _waitAsync();
   _pSPIx->beginTransaction(_spi_settings);
   if (_cs >= 0) digitalWrite(_cs, LOW);
   _pSPIx->transfer(d);
+  GxEPD2_COUNT(transactions, 1);
+  GxEPD2_COUNT(cs_selects, _cs >= 0);
+  GxEPD2_COUNT(spi_bytes, 1);
   if (_cs >= 0) digitalWrite(_cs, HIGH);
   _pSPIx->endTransaction();
 }
 
 void GxEPD2_EPD::_writeData(const uint8_t* data, uint16_t n)
 {
+  _waitAsync();
   _pSPIx->beginTransaction(_spi_settings);
   if (_cs >= 0) digitalWrite(_cs, LOW);
-  for (uint16_t i = 0; i < n; i++)
-  {
-    _pSPIx->transfer(*data++);
-  }
+  _transferBytes(data, n);
+  GxEPD2_COUNT(transactions, 1);
+  GxEPD2_COUNT(cs_selects, _cs >= 0);
   if (_cs >= 0) digitalWrite(_cs, HIGH);
   _pSPIx->endTransaction();
 }
 
 void GxEPD2_EPD::_writeDataPGM(const uint8_t* data, uint16_t n, int16_t fill_with_zeroes)
 {
+  _waitAsync();
   _pSPIx->beginTransaction(_spi_settings);
   if (_cs >= 0) digitalWrite(_cs, LOW);
-  for (uint16_t i = 0; i < n; i++)
-  {
-    _pSPIx->transfer(pgm_read_byte(&*data++));
-  }
-  while (fill_with_zeroes > 0)
-  {
-    _pSPIx->transfer(0x00);
-    fill_with_zeroes--;
-  }
+  _transferBytes(data, n, false, true);
+  if (fill_with_zeroes > 0) _transferFill(0x00, fill_with_zeroes);
+  GxEPD2_COUNT(transactions, 1);
+  GxEPD2_COUNT(cs_selects, _cs >= 0);
   if (_cs >= 0) digitalWrite(_cs, HIGH);
   _pSPIx->endTransaction();
 }
 
 void GxEPD2_EPD::_writeDataPGM_sCS(const uint8_t* data, uint16_t n, int16_t fill_with_zeroes)
 {
+  _waitAsync();
   _pSPIx->beginTransaction(_spi_settings);
+  GxEPD2_COUNT(transactions, 1);
+  GxEPD2_COUNT(cs_selects, _cs >= 0 ? n + (fill_with_zeroes > 0 ? fill_with_zeroes : 0) : 0);
+  GxEPD2_COUNT(spi_bytes, n + (fill_with_zeroes > 0 ? fill_with_zeroes : 0));
   for (uint8_t i = 0; i < n; i++)
   {
     if (_cs >= 0) digitalWrite(_cs, LOW);
@@ -242,11 +497,16 @@ void GxEPD2_EPD::_writeDataPGM_sCS(const uint8_t* data, uint16_t n, int16_t fill
 
 void GxEPD2_EPD::_writeCommandData(const uint8_t* pCommandData, uint8_t datalen)
 {
+  _waitAsync();
   _pSPIx->beginTransaction(_spi_settings);
   if (_dc >= 0) digitalWrite(_dc, LOW);
   if (_cs >= 0) digitalWrite(_cs, LOW);
   _pSPIx->transfer(*pCommandData++);
   if (_dc >= 0) digitalWrite(_dc, HIGH);
+  GxEPD2_COUNT(transactions, 1);
+  GxEPD2_COUNT(cs_selects, _cs >= 0);
+  GxEPD2_COUNT(commands, 1);
+  GxEPD2_COUNT(spi_bytes, datalen);
   for (uint8_t i = 0; i < datalen - 1; i++)  // sub the command
   {
     _pSPIx->transfer(*pCommandData++);
@@ -257,11 +517,16 @@ void GxEPD2_EPD::_writeCommandData(const uint8_t* pCommandData, uint8_t datalen)
 
 void GxEPD2_EPD::_writeCommandDataPGM(const uint8_t* pCommandData, uint8_t datalen)
 {
+  _waitAsync();
   _pSPIx->beginTransaction(_spi_settings);
   if (_dc >= 0) digitalWrite(_dc, LOW);
   if (_cs >= 0) digitalWrite(_cs, LOW);
   _pSPIx->transfer(pgm_read_byte(&*pCommandData++));
   if (_dc >= 0) digitalWrite(_dc, HIGH);
+  GxEPD2_COUNT(transactions, 1);
+  GxEPD2_COUNT(cs_selects, _cs >= 0);
+  GxEPD2_COUNT(commands, 1);
+  GxEPD2_COUNT(spi_bytes, datalen);
   for (uint8_t i = 0; i < datalen - 1; i++)  // sub the command
   {
     _pSPIx->transfer(pgm_read_byte(&*pCommandData++));
@@ -272,13 +537,99 @@ void GxEPD2_EPD::_writeCommandDataPGM(const uint8_t* pCommandData, uint8_t datal
 
 void GxEPD2_EPD::_startTransfer()
 {
+  _waitAsync();
   _pSPIx->beginTransaction(_spi_settings);
   if (_cs >= 0) digitalWrite(_cs, LOW);
+  GxEPD2_COUNT(transactions, 1);
+  GxEPD2_COUNT(cs_selects, _cs >= 0);
 }
 
 void GxEPD2_EPD::_transfer(uint8_t value)
 {
   _pSPIx->transfer(value);
+  GxEPD2_COUNT(spi_bytes, 1);
+}
+
+void GxEPD2_EPD::_transferCommand(uint8_t c)
+{
+  if (_dc >= 0) digitalWrite(_dc, LOW);
+  _pSPIx->transfer(c);
+  if (_dc >= 0) digitalWrite(_dc, HIGH);
+  GxEPD2_COUNT(commands, 1);
+  GxEPD2_COUNT(spi_bytes, 1);
+}
+
+void GxEPD2_EPD::_writeCommandsPGM(const uint8_t* table, uint16_t size)
+{
+  _startTransfer();
+  for (uint16_t i = 0; i + 1 < size; )
+  {
+    uint8_t n = pgm_read_byte(&table[i + 1]);
+    _transferCommand(pgm_read_byte(&table[i]));
+    _transferBytes(table + i + 2, n, false, true);
+    i += 2 + n;
+  }
+  _endTransfer();
+}
+
+void GxEPD2_EPD::_transferBytes(SPIClass& spi, const uint8_t* data, uint16_t n, bool invert, bool pgm)
+{
+#if defined(__AVR)
+  // no gain from buffering, keep stack use low
+  for (uint16_t i = 0; i < n; i++)
+  {
+    uint8_t d = pgm ? pgm_read_byte(&data[i]) : data[i];
+    spi.transfer(invert ? ~d : d);
+  }
+#else
+#if defined(ESP32)
+  if (!invert) // PROGMEM is memory mapped
+  {
+    spi.writeBytes(data, n); // doesn't overwrite data
+    return;
+  }
+#elif defined(ESP8266)
+  if (!invert && !pgm)
+  {
+    spi.writeBytes(data, n); // doesn't overwrite data
+    return;
+  }
+#endif
+  uint8_t buffer[GxEPD2_TRANSFER_CHUNK_SIZE];
+  while (n > 0)
+  {
+    uint16_t count = gx_uint16_min(n, sizeof(buffer));
+    for (uint16_t i = 0; i < count; i++)
+    {
+      uint8_t d = pgm ? pgm_read_byte(&data[i]) : data[i];
+      buffer[i] = invert ? ~d : d;
+    }
+    spi.transfer(buffer, count); // in place, buffer gets overwritten with received data
+    data += count;
+    n -= count;
+  }
+#endif
+}
+
+void GxEPD2_EPD::_transferFill(SPIClass& spi, uint8_t value, uint32_t n)
+{
+#if defined(__AVR)
+  for (uint32_t i = 0; i < n; i++)
+  {
+    spi.transfer(value);
+  }
+#elif defined(ESP8266) || defined(ESP32)
+  spi.writePattern(&value, 1, n);
+#else
+  uint8_t buffer[GxEPD2_TRANSFER_CHUNK_SIZE];
+  while (n > 0)
+  {
+    uint16_t count = n < sizeof(buffer) ? n : sizeof(buffer);
+    memset(buffer, value, count); // refill, buffer gets overwritten with received data
+    spi.transfer(buffer, count);
+    n -= count;
+  }
+#endif
 }
 
 void GxEPD2_EPD::_endTransfer()
@@ -17,6 +17,9 @@
 
 #include <GxEPD2.h>
 
+// uncomment next line to count SPI bytes, transactions, CS selects, commands and BUSY waits, see getStatistics()
+//#define ENABLE_GxEPD2_STATISTICS
+
 #pragma GCC diagnostic ignored "-Wunused-parameter"
 //#pragma GCC diagnostic ignored "-Wsign-compare"
 
@@ -30,6 +33,17 @@ class GxEPD2_EPD
     const bool hasColor;
     const bool hasPartialUpdate;
     const bool hasFastPartialUpdate;
+    // counters of the transfer methods of this class, see ENABLE_GxEPD2_STATISTICS
+    // drivers with their own SPI code (GxEPD2_1248, GxEPD2_1248c, GxEPD2_1085_GDEM1085T51, IT8951) only count BUSY waits
+    struct Statistics
+    {
+      uint32_t spi_bytes;      // command and data bytes
+      uint32_t commands;
+      uint32_t transactions;   // beginTransaction() calls
+      uint32_t cs_selects;     // CS set LOW
+      uint32_t busy_waits;     // _waitWhileBusy() calls
+      uint32_t busy_time_us;   // time spent in _waitWhileBusy()
+    };
     // constructor
     GxEPD2_EPD(int16_t cs, int16_t dc, int16_t rst, int16_t busy, int16_t busy_level, uint32_t busy_timeout,
                uint16_t w, uint16_t h, GxEPD2::Panel p, bool c, bool pu, bool fpu);
@@ -91,6 +105,28 @@ class GxEPD2_EPD
     virtual void drawNativeColors() {}; // for test (7-color native mapping)
     // register a callback function to be called during _waitWhileBusy continuously.
     void setBusyCallback(void (*busyCallback)(const void*), const void* busy_callback_parameter = 0);
+    // non-blocking refresh: returns after the refresh is started, the last BUSY wait of the refresh sequence is deferred
+    // isBusy() polls, completes the refresh when BUSY is released, then calls the refresh callback
+    // any further command to the controller waits for the refresh to complete, e.g. writeImage() or powerOff()
+    void refreshAsync(bool partial_update_mode = false);
+    void refreshAsync(int16_t x, int16_t y, int16_t w, int16_t h);
+    void powerOffAsync();
+    bool isBusy(); // for a refresh or powerOff started async
+    void waitWhileBusy(); // waits for completion, with busy callback
+    // register a callback function to be called once when an async refresh or powerOff is complete
+    void setRefreshCallback(void (*refreshCallback)(const void*), const void* refresh_callback_parameter = 0);
+    // used by the display classes: one step to be done on completion, e.g. writeImageAgain(); may start the next async step
+    void setAsyncStep(void (*asyncStep)(void*), void* async_step_parameter);
+    // isBusy() checks BUSY only after the released edge seen by an interrupt; false if BUSY pin has no interrupt
+    bool enableBusyInterrupt(bool enable = true);
+    // used by the display classes for the page pipeline: runs job(job_parameter) in a background task on a dual core ESP32,
+    // else right away; the caller must not use this driver or the data of the job until waitBackground() returns
+    void runInBackground(void (*job)(void*), void* job_parameter);
+    void waitBackground();
+    bool isBackgroundBusy()
+    {
+      return _background_busy;
+    };
     static inline uint16_t gx_uint16_min(uint16_t a, uint16_t b)
     {
       return (a < b ? a : b);
@@ -100,9 +136,17 @@ class GxEPD2_EPD
       return (a > b ? a : b);
     };
     void selectSPI(SPIClass& spi, SPISettings spi_settings);
+    // all zero unless ENABLE_GxEPD2_STATISTICS is defined
+    Statistics getStatistics();
+    void resetStatistics();
   protected:
     void _reset();
     void _waitWhileBusy(const char* comment = 0, uint16_t busy_time = 5000);
+    // completes a deferred BUSY wait, before any further command
+    void _waitAsync()
+    {
+      if (_async_pending) waitWhileBusy();
+    };
     void _writeCommand(uint8_t c);
     void _writeData(uint8_t d);
     void _writeData(const uint8_t* data, uint16_t n);
@@ -112,6 +156,27 @@ class GxEPD2_EPD
     void _writeCommandDataPGM(const uint8_t* pCommandData, uint8_t datalen);
     void _startTransfer();
     void _transfer(uint8_t value);
+    // command byte with DC low, used between _startTransfer() and _endTransfer(), parameters follow with _transfer()
+    void _transferCommand(uint8_t c);
+    // sequence of commands with parameters in one transaction, table in PROGMEM: command, n, n parameters, command, ...
+    void _writeCommandsPGM(const uint8_t* table, uint16_t size);
+    // bulk transfers, used between _startTransfer() and _endTransfer()
+    void _transferBytes(const uint8_t* data, uint16_t n, bool invert = false, bool pgm = false)
+    {
+      _transferBytes(*_pSPIx, data, n, invert, pgm);
+#if defined(ENABLE_GxEPD2_STATISTICS)
+      _statistics.spi_bytes += n;
+#endif
+    };
+    void _transferFill(uint8_t value, uint32_t n)
+    {
+      _transferFill(*_pSPIx, value, n);
+#if defined(ENABLE_GxEPD2_STATISTICS)
+      _statistics.spi_bytes += n;
+#endif
+    };
+    static void _transferBytes(SPIClass& spi, const uint8_t* data, uint16_t n, bool invert, bool pgm);
+    static void _transferFill(SPIClass& spi, uint8_t value, uint32_t n);
     void _endTransfer();
   protected:
     int16_t _cs, _dc, _rst, _busy, _busy_level;
@@ -125,6 +190,30 @@ class GxEPD2_EPD
     uint16_t _reset_duration;
     void (*_busy_callback)(const void*); 
     const void* _busy_callback_parameter;
+    void (*_refresh_callback)(const void*);
+    const void* _refresh_callback_parameter;
+    void (*_async_step)(void*);
+    void* _async_step_parameter;
+    bool _async_mode, _async_pending, _busy_interrupt;
+    volatile bool _busy_released;
+    const char* _async_comment;
+    uint16_t _async_busy_time;
+    unsigned long _async_start;
+    void (*_background_job)(void*);
+    void* _background_job_parameter;
+    volatile bool _background_busy;
+    void* _background_task; // TaskHandle_t
+    void* _background_done; // SemaphoreHandle_t
+  private:
+    void _startAsync();
+    void _endAsync();
+    static void _backgroundTask(void* epd);
+    static void _busyReleased(void* epd);
+    static void _busyReleasedISR();
+    static GxEPD2_EPD* _busy_interrupt_epd;
+#if defined(ENABLE_GxEPD2_STATISTICS)
+    Statistics _statistics;
+#endif
 };
 
 #endif
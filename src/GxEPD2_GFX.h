@@ -41,6 +41,9 @@ class GxEPD2_GFX : public GxEPD2_GFX_ROOT_CLASS
     virtual void fillScreen(uint16_t color) = 0; // 0x0 black, >0x0 white, to buffer
     // display buffer content to screen, useful for full screen buffer
     virtual void display(bool partial_update_mode = false) = 0;
+    // non-blocking display(), see GxEPD2_EPD::refreshAsync()
+    virtual void displayAsync(bool partial_update_mode = false) = 0;
+    virtual bool isBusy() = 0;
     // display part of buffer content to screen, useful for full screen buffer
     // displayWindow, use parameters according to actual rotation.
     // x and w should be multiple of 8, for rotation 0 or 2,
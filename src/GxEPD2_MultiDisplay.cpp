@@ -0,0 +1,78 @@
+// Display Library for SPI e-paper panels from Dalian Good Display and boards from Waveshare.
+// Requires HW SPI and Adafruit_GFX. Caution: the e-paper panels require 3.3V supply AND data lines!
+//
+// GxEPD2_MultiDisplay: updates of several displays on one SPI bus, the data of one is sent while others refresh
+//
+// Author: Jean-Marc Zingg
+//
+// Version: see library.properties
+//
+// Library: https://github.com/ZinggJM/GxEPD2
+
+#include "GxEPD2_MultiDisplay.h"
+
+GxEPD2_MultiDisplay::GxEPD2_MultiDisplay() :
+  _count(0), _sequence(0), _done_callback(0), _done_callback_parameter(0)
+{
+}
+
+bool GxEPD2_MultiDisplay::queue(uint8_t index, bool partial_update_mode)
+{
+  if ((index >= _count) || !isDone(index)) return false;
+  Entry& entry = _entries[index];
+  entry.queued = ++_sequence;
+  entry.partial = partial_update_mode;
+  return true;
+}
+
+bool GxEPD2_MultiDisplay::run()
+{
+  // refreshes done, isBusy() also does the steps after the refresh, e.g. writeImageAgain() and powerOff()
+  for (uint8_t i = 0; i < _count; i++)
+  {
+    Entry& entry = _entries[i];
+    if (entry.running && !entry.busy(entry.display))
+    {
+      entry.running = false;
+      if (_done_callback) _done_callback(i, _done_callback_parameter);
+    }
+  }
+  // queued updates, oldest first: displayAsync() uses the bus until the refresh is started
+  while (true)
+  {
+    int8_t next = -1;
+    for (uint8_t i = 0; i < _count; i++)
+    {
+      if (_entries[i].queued && ((next < 0) || (_entries[i].queued < _entries[next].queued))) next = i;
+    }
+    if (next < 0) break;
+    Entry& entry = _entries[next];
+    entry.queued = 0;
+    entry.running = true;
+    entry.start(entry.display, entry.partial);
+  }
+  for (uint8_t i = 0; i < _count; i++)
+  {
+    if (_entries[i].running) return true;
+  }
+  return false;
+}
+
+void GxEPD2_MultiDisplay::runAll()
+{
+  while (run())
+  {
+    delay(1); // yield() to avoid WDT on ESP8266 and ESP32
+  }
+}
+
+bool GxEPD2_MultiDisplay::isDone(uint8_t index) const
+{
+  return (index < _count) && !_entries[index].queued && !_entries[index].running;
+}
+
+void GxEPD2_MultiDisplay::setDoneCallback(void (*doneCallback)(uint8_t index, const void* parameter), const void* done_callback_parameter)
+{
+  _done_callback = doneCallback;
+  _done_callback_parameter = done_callback_parameter;
+}
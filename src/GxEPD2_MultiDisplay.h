@@ -0,0 +1,72 @@
+// Display Library for SPI e-paper panels from Dalian Good Display and boards from Waveshare.
+// Requires HW SPI and Adafruit_GFX. Caution: the e-paper panels require 3.3V supply AND data lines!
+//
+// GxEPD2_MultiDisplay: updates of several displays on one SPI bus, the data of one is sent while others refresh
+// uses displayAsync() of the display classes, the displays need a full screen buffer and a BUSY pin of their own
+//
+// Author: Jean-Marc Zingg
+//
+// Version: see library.properties
+//
+// Library: https://github.com/ZinggJM/GxEPD2
+
+#ifndef _GxEPD2_MultiDisplay_H_
+#define _GxEPD2_MultiDisplay_H_
+
+#include <Arduino.h>
+
+class GxEPD2_MultiDisplay
+{
+  public:
+    static const uint8_t max_displays = 8;
+    GxEPD2_MultiDisplay();
+    // any display class with displayAsync() and isBusy(), e.g. GxEPD2_BW; returns the index, or -1 if full
+    template<typename GxEPD2_Display> int8_t add(GxEPD2_Display& display)
+    {
+      if (_count >= max_displays) return -1;
+      Entry& entry = _entries[_count];
+      entry.display = &display;
+      entry.start = &_start<GxEPD2_Display>;
+      entry.busy = &_busy<GxEPD2_Display>;
+      entry.queued = 0;
+      entry.partial = false;
+      entry.running = false;
+      return _count++;
+    };
+    // queues the update of the screen from the buffer of the display; false if an update of it is queued or running
+    // the buffer must not change until isDone(index)
+    bool queue(uint8_t index, bool partial_update_mode = false);
+    // starts the queued updates in queue order and completes the refreshes that are done, without waiting;
+    // true while any update is queued or running
+    bool run();
+    // runs until all updates are done
+    void runAll();
+    // true if no update of the display is queued or running, as of the last run()
+    bool isDone(uint8_t index) const;
+    // register a callback function to be called by run() when the update of a display is done
+    void setDoneCallback(void (*doneCallback)(uint8_t index, const void* parameter), const void* done_callback_parameter = 0);
+  private:
+    struct Entry
+    {
+      void* display;
+      void (*start)(void* display, bool partial_update_mode);
+      bool (*busy)(void* display);
+      uint32_t queued; // queue sequence number, 0 if not queued
+      bool partial, running;
+    };
+    template<typename GxEPD2_Display> static void _start(void* display, bool partial_update_mode)
+    {
+      static_cast<GxEPD2_Display*>(display)->displayAsync(partial_update_mode);
+    };
+    template<typename GxEPD2_Display> static bool _busy(void* display)
+    {
+      return static_cast<GxEPD2_Display*>(display)->isBusy();
+    };
+    Entry _entries[max_displays];
+    uint8_t _count;
+    uint32_t _sequence;
+    void (*_done_callback)(uint8_t index, const void* parameter);
+    const void* _done_callback_parameter;
+};
+
+#endif
@@ -0,0 +1,134 @@
+// Display Library for SPI e-paper panels from Dalian Good Display and boards from Waveshare.
+// Requires HW SPI and Adafruit_GFX. Caution: the e-paper panels require 3.3V supply AND data lines!
+//
+// GxEPD2_NativeReader: reader for images precompiled to the pixel format of the panels, loaded without conversion
+//
+// Author: Jean-Marc Zingg
+//
+// Version: see library.properties
+//
+// Library: https://github.com/ZinggJM/GxEPD2
+
+#include "GxEPD2_NativeReader.h"
+
+bool GxEPD2_NativeReader::begin()
+{
+  uint8_t header[24];
+  _width = 0;
+  _height = 0;
+  if (!_source.seek(0) || (_source.read(header, sizeof(header)) != int16_t(sizeof(header)))) return false;
+  if ((header[0] != 'G') || (header[1] != 'x') || (header[2] != 'N') || (header[3] != 'I') || (header[4] != 1)) return false;
+  _format = header[5];
+  _planes = header[14];
+  if ((_format != Format1) && (_format != Format3C) && (_format != Format4C) && (_format != Format7C)) return false;
+  if (_planes != (_format == Format3C ? 2 : 1)) return false;
+  _band_height = header[10] | (header[11] << 8);
+  _bytes_per_row = header[12] | (header[13] << 8);
+  _band_offset = _read32(16);
+  _index_offset = _read32(20);
+  int16_t width = header[6] | (header[7] << 8);
+  int16_t height = header[8] | (header[9] << 8);
+  if ((width <= 0) || (height <= 0) || (_band_height == 0)) return false;
+  if (_bytes_per_row != (uint16_t(width) * _bitsPerPixel() + 7) / 8) return false;
+  _width = width;
+  _height = height;
+  return true;
+}
+
+bool GxEPD2_NativeReader::readRow(uint16_t row, uint8_t plane, uint8_t* buffer)
+{
+  if ((row >= _height) || (plane >= _planes)) return false;
+  return _startRow(_stream[0], row, plane, 0) && _unpack(_stream[0], buffer, _bytes_per_row);
+}
+
+bool GxEPD2_NativeReader::readRow(uint16_t row, uint8_t plane, uint8_t* buffer, uint16_t first, uint16_t n)
+{
+  if ((row >= _height) || (plane >= _planes) || (uint32_t(first) + n > _bytes_per_row)) return false;
+  return _startRow(_stream[0], row, plane, first) && _unpack(_stream[0], buffer, n);
+}
+
+// color of pixel i of the chunk, for the drawPixel() of any display class
+uint16_t GxEPD2_NativeReader::_color(uint16_t i)
+{
+  static const uint16_t colors4[] = {GxEPD_BLACK, GxEPD_WHITE, GxEPD_YELLOW, GxEPD_RED};
+  static const uint16_t colors7[] = {GxEPD_BLACK, GxEPD_WHITE, GxEPD_GREEN, GxEPD_BLUE, GxEPD_RED, GxEPD_YELLOW, GxEPD_ORANGE, GxEPD_WHITE};
+  switch (_format)
+  {
+    case Format4C:
+      return colors4[(_chunk[0][i / 4] >> (6 - 2 * (i % 4))) & 0x03];
+    case Format7C:
+      return colors7[(_chunk[0][i / 2] >> (i % 2 ? 0 : 4)) & 0x07];
+    case Format3C:
+      if (!(_chunk[1][i / 8] & (0x80 >> (i % 8)))) return GxEPD_COLORED;
+      break;
+  }
+  return _chunk[0][i / 8] & (0x80 >> (i % 8)) ? GxEPD_WHITE : GxEPD_BLACK;
+}
+
+bool GxEPD2_NativeReader::_startRow(_Stream& stream, uint16_t row, uint8_t plane, uint16_t skip_bytes)
+{
+  uint8_t flags;
+  stream.position = _read32(_index_offset + 4 * (uint32_t(row) * _planes + plane));
+  if (!_source.seek(_band_offset + row / _band_height) || (_source.read(&flags, 1) != 1)) return false;
+  stream.packed = flags & 0x01;
+  stream.count = 0;
+  stream.in_size = 0;
+  stream.in_index = 0;
+  return _unpack(stream, 0, skip_bytes);
+}
+
+// n bytes of the plane row to buffer, or skipped if buffer is 0
+bool GxEPD2_NativeReader::_unpack(_Stream& stream, uint8_t* buffer, uint16_t n)
+{
+  while (n > 0)
+  {
+    if (!stream.packed)
+    {
+      if (!_next(stream, stream.value)) return false;
+      if (buffer) *buffer++ = stream.value;
+      n--;
+      continue;
+    }
+    if (0 == stream.count)
+    {
+      uint8_t header;
+      if (!_next(stream, header)) return false;
+      if (header == 128) continue; // no operation
+      stream.repeat = header > 128;
+      stream.count = stream.repeat ? 257 - header : header + 1;
+      if (stream.repeat && !_next(stream, stream.value)) return false;
+    }
+    uint8_t k = n < stream.count ? n : stream.count;
+    stream.count -= k;
+    n -= k;
+    for (; k > 0; k--)
+    {
+      if (!stream.repeat && !_next(stream, stream.value)) return false;
+      if (buffer) *buffer++ = stream.value;
+    }
+  }
+  return true;
+}
+
+// next byte of the stream, read ahead in chunks, as the streams of the planes take turns
+bool GxEPD2_NativeReader::_next(_Stream& stream, uint8_t& value)
+{
+  if (stream.in_index >= stream.in_size)
+  {
+    if (!_source.seek(stream.position)) return false;
+    int16_t n = _source.read(stream.in, sizeof(stream.in));
+    if (n <= 0) return false;
+    stream.position += n;
+    stream.in_size = n;
+    stream.in_index = 0;
+  }
+  value = stream.in[stream.in_index++];
+  return true;
+}
+
+uint32_t GxEPD2_NativeReader::_read32(uint32_t position)
+{
+  uint8_t b[4] = {0, 0, 0, 0};
+  if (_source.seek(position)) _source.read(b, 4);
+  return b[0] | (uint32_t(b[1]) << 8) | (uint32_t(b[2]) << 16) | (uint32_t(b[3]) << 24);
+}
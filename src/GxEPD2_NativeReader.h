@@ -0,0 +1,220 @@
+// Display Library for SPI e-paper panels from Dalian Good Display and boards from Waveshare.
+// Requires HW SPI and Adafruit_GFX. Caution: the e-paper panels require 3.3V supply AND data lines!
+//
+// GxEPD2_NativeReader: reader for images precompiled to the pixel format of the panels, loaded without conversion
+// created from BMP files with extras/host/tools/GxEPD2_NativeConvert, or from bitmap arrays with GxEPD2_BitmapCompress
+//
+// Author: Jean-Marc Zingg
+//
+// Version: see library.properties
+//
+// Library: https://github.com/ZinggJM/GxEPD2
+
+// GxEPD2 native image format, numbers are little-endian as in BMP
+//
+// offset size
+//   0     4   signature "GxNI"
+//   4     1   version, 1
+//   5     1   format, see GxEPD2_NativeReader::Format
+//   6     2   width in pixels
+//   8     2   height in pixels
+//  10     2   rows per band, for the band flags
+//  12     2   bytes per row of a plane, bitmaps are padded to bytes with white
+//  14     1   planes, 2 for Format3C, else 1
+//  15     1   reserved, 0
+//  16     4   offset of the band flags, one byte per band: bit 0 set if the rows of the band are PackBits compressed
+//  20     4   offset of the row index, height * planes + 1 offsets of 4 bytes, row by row and plane by plane,
+//             the last one is the end of the data; any row of any plane can be read alone
+//
+// pixels of the planes, as in the buffers of the display classes, first pixel in the most significant bits:
+//   Format1:  1 bit, 1 is white, as GxEPD2_BW
+//   Format3C: 1 bit black plane, 1 is white, then 1 bit color plane, 0 is colored, as GxEPD2_3C
+//   Format4C: 2 bits, 0 black, 1 white, 2 yellow, 3 red, as GxEPD2_4C
+//   Format7C: 4 bits, 0 black, 1 white, 2 green, 3 blue, 4 red, 5 yellow, 6 orange, as GxEPD2_7C
+//
+// PackBits, of each plane row: header n < 128 is followed by n + 1 literal bytes, n > 128 by one byte repeated 257 - n times
+
+#ifndef _GxEPD2_NativeReader_H_
+#define _GxEPD2_NativeReader_H_
+
+#include <Arduino.h>
+#include <GxEPD2.h>
+#include "GxEPD2_ByteSource.h"
+
+// bytes per plane decoded and drawn at a time, up to 8191 for the 16 bit pixel index of a chunk
+#if !defined(GxEPD2_NATIVE_CHUNK_BYTES)
+#define GxEPD2_NATIVE_CHUNK_BYTES 16
+#endif
+static_assert(GxEPD2_NATIVE_CHUNK_BYTES <= 8191, "GxEPD2_NATIVE_CHUNK_BYTES too large");
+
+template<typename GxEPD2_Type, const uint16_t page_height> class GxEPD2_BW;
+
+class GxEPD2_NativeReader
+{
+  public:
+    enum Format {Format1 = 1, Format3C = 3, Format4C = 4, Format7C = 7};
+    GxEPD2_NativeReader(GxEPD2_ByteSource& source) : _source(source), _width(0), _height(0), _format(0), _planes(0) {};
+    // reads the header; false if not a native image of a known format
+    bool begin();
+    int16_t width()
+    {
+      return _width;
+    };
+    int16_t height()
+    {
+      return _height;
+    };
+    uint8_t format()
+    {
+      return _format;
+    };
+    uint8_t planes()
+    {
+      return _planes;
+    };
+    uint16_t bytesPerRow()
+    {
+      return _bytes_per_row;
+    };
+    // reads and unpacks row of plane to buffer of bytesPerRow() bytes
+    bool readRow(uint16_t row, uint8_t plane, uint8_t* buffer);
+    // reads n bytes of row of plane from byte first to buffer
+    bool readRow(uint16_t row, uint8_t plane, uint8_t* buffer, uint16_t first, uint16_t n);
+    // writes the image to controller memory at x, y as is, with writeImage() or writeNative(), refresh() is up to the caller
+    // the rows are collected in buffer, as many as fit, for fewer transfers; x should be a multiple of 8 for Format1 and Format3C
+    // the format should be the one of the panel, false on a read error or if buffer can't hold one row
+    template<typename GxEPD2_Display> bool write(GxEPD2_Display& display, int16_t x, int16_t y, uint8_t* buffer, uint32_t size)
+    {
+      return writePart(display, 0, 0, _width, _height, x, y, buffer, size);
+    };
+    // writes the part w * h at x_part, y_part of the image to controller memory at x, y, as writeImagePart() does for bitmaps
+    // only the bytes of the part are unpacked; x_part should start a byte, a multiple of 8 for Format1 and Format3C
+    template<typename GxEPD2_Display> bool writePart(GxEPD2_Display& display, int16_t x_part, int16_t y_part, int16_t w, int16_t h,
+        int16_t x, int16_t y, uint8_t* buffer, uint32_t size)
+    {
+      if ((x_part < 0) || (y_part < 0) || (x_part >= _width) || (y_part >= _height)) return true; // nothing to write
+      if (w > _width - x_part) w = _width - x_part;
+      if (h > _height - y_part) h = _height - y_part;
+      if ((w <= 0) || (h <= 0)) return true;
+      uint8_t pixels_per_byte = 8 / _bitsPerPixel();
+      uint16_t first = x_part / pixels_per_byte, part_bytes = (w + pixels_per_byte - 1) / pixels_per_byte;
+      uint32_t row_bytes = uint32_t(part_bytes) * _planes;
+      if ((row_bytes == 0) || (size < row_bytes)) return false;
+      uint16_t rows = size / row_bytes < uint32_t(h) ? size / row_bytes : h;
+      for (uint16_t row = 0; row < h; row += rows)
+      {
+        uint16_t n = h - row < rows ? h - row : rows;
+        for (uint16_t i = 0; i < n; i++)
+        {
+          for (uint8_t p = 0; p < _planes; p++)
+          {
+            if (!readRow(y_part + row + i, p, buffer + (uint32_t(p) * n + i) * part_bytes, first, part_bytes)) return false;
+          }
+        }
+        switch (_format)
+        {
+          case Format1:
+            display.writeImage(buffer, x, y + row, w, n);
+            break;
+          case Format3C:
+            display.writeImage(buffer, buffer + uint32_t(n) * part_bytes, x, y + row, w, n, false, false, false);
+            break;
+          default:
+            display.writeNative(buffer, 0, x, y + row, w, n, false, false, false);
+            break;
+        }
+      }
+      return true;
+    };
+    // draws the part of the image at x, y that falls into the current page of display, call it in each page of the page loop
+    // GxEPD2_BW gets Format1 8 pixels at a time through drawBitmap(), the others get the colors of the pixel values
+    // false on a read error
+    template<typename GxEPD2_Display> bool draw(GxEPD2_Display& display, int16_t x, int16_t y)
+    {
+      int16_t px, py, pw, ph;
+      display.getPageWindow(px, py, pw, ph);
+      // intersection of image, page and screen
+      int32_t xs = x > px ? x : px, xe = int32_t(x) + _width;
+      int32_t ys = y > py ? y : py, ye = int32_t(y) + _height;
+      if (xs < 0) xs = 0;
+      if (ys < 0) ys = 0;
+      if (xe > int32_t(px) + pw) xe = int32_t(px) + pw;
+      if (ye > int32_t(py) + ph) ye = int32_t(py) + ph;
+      if (xe > display.width()) xe = display.width();
+      if (ye > display.height()) ye = display.height();
+      if (xs >= xe) return true; // nothing of this page
+      uint8_t pixels_per_byte = 8 / _bitsPerPixel();
+      uint16_t first_byte = (xs - x) / pixels_per_byte;
+      uint16_t skip = (xs - x) % pixels_per_byte; // pixels before xs in the first byte
+      for (int32_t yd = ys; yd < ye; yd++)
+      {
+        for (uint8_t p = 0; p < _planes; p++)
+        {
+          if (!_startRow(_stream[p], yd - y, p, first_byte)) return false;
+        }
+        for (int32_t xd = x + int32_t(first_byte) * pixels_per_byte; xd < xe; xd += GxEPD2_NATIVE_CHUNK_BYTES * pixels_per_byte)
+        {
+          uint16_t n = (xe - xd + pixels_per_byte - 1) / pixels_per_byte;
+          if (n > GxEPD2_NATIVE_CHUNK_BYTES) n = GxEPD2_NATIVE_CHUNK_BYTES;
+          for (uint8_t p = 0; p < _planes; p++)
+          {
+            if (!_unpack(_stream[p], _chunk[p], n)) return false;
+          }
+          uint16_t pixels = xe - xd < n * pixels_per_byte ? xe - xd : n * pixels_per_byte;
+          _drawChunk(display, xd, yd, skip, pixels);
+          skip = 0;
+        }
+        skip = (xs - x) % pixels_per_byte;
+      }
+      return true;
+    };
+  private:
+    struct _Stream
+    {
+      uint32_t position; // of the next byte to read into in
+      bool packed;
+      bool repeat;
+      uint8_t count; // of the current PackBits run
+      uint8_t value; // of a repeat run
+      uint16_t in_size, in_index;
+      uint8_t in[GxEPD2_NATIVE_CHUNK_BYTES];
+    };
+    template<typename GxEPD2_Display> void _drawChunk(GxEPD2_Display& display, int16_t x, int16_t y, uint16_t i0, uint16_t n)
+    {
+      for (uint16_t i = i0; i < n; i++)
+      {
+        display.drawPixel(x + i, y, _color(i));
+      }
+    };
+    template<typename GxEPD2_Type, const uint16_t page_height> void _drawChunk(GxEPD2_BW<GxEPD2_Type, page_height>& display, int16_t x, int16_t y, uint16_t i0, uint16_t n)
+    {
+      if (_format != Format1)
+      {
+        for (uint16_t i = i0; i < n; i++)
+        {
+          display.drawPixel(x + i, y, _color(i));
+        }
+        return;
+      }
+      // pixels before i0 are outside of page or screen
+      display.drawBitmap(x, y, _chunk[0], n, 1, GxEPD_WHITE, GxEPD_BLACK);
+    };
+    uint8_t _bitsPerPixel()
+    {
+      return _format == Format7C ? 4 : _format == Format4C ? 2 : 1;
+    };
+    uint16_t _color(uint16_t i);
+    bool _startRow(_Stream& stream, uint16_t row, uint8_t plane, uint16_t skip_bytes);
+    bool _unpack(_Stream& stream, uint8_t* buffer, uint16_t n);
+    bool _next(_Stream& stream, uint8_t& value);
+    uint32_t _read32(uint32_t position);
+    GxEPD2_ByteSource& _source;
+    int16_t _width, _height;
+    uint8_t _format, _planes;
+    uint16_t _band_height, _bytes_per_row;
+    uint32_t _band_offset, _index_offset;
+    _Stream _stream[2];
+    uint8_t _chunk[2][GxEPD2_NATIVE_CHUNK_BYTES];
+};
+
+#endif
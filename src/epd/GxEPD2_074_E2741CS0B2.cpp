@@ -37,20 +37,14 @@ void GxEPD2_074_E2741CS0B2::writeScreenBuffer(uint8_t value)
   // Send black frame (frame1) - 0x00 for black, 0xFF for white
   _writeCommand(0x10);
   _startTransfer();
-  for (uint32_t i = 0; i < _frame_size; i++)
-  {
-    _transfer(value);
-  }
+  _transferFill(value, _frame_size);
   _endTransfer();
   // Send RAM_RW again for second frame (dummy for B/W display)
   _sendIndexData(0x12, data3, 3);
   // Send dummy frame2 (all white/no-color)
   _writeCommand(0x11);
   _startTransfer();
-  for (uint32_t i = 0; i < _frame_size; i++)
-  {
-    _transfer(0xFF); // no color
-  }
+  _transferFill(0xFF, _frame_size); // no color
   _endTransfer();
   _initial_write = false;
 }
@@ -110,10 +104,7 @@ void GxEPD2_074_E2741CS0B2::writeImage(const uint8_t bitmap[], int16_t x, int16_
   // Send dummy frame2 (no color)
   _writeCommand(0x11);
   _startTransfer();
-  for (uint32_t i = 0; i < _frame_size; i++)
-  {
-    _transfer(0xFF);
-  }
+  _transferFill(0xFF, _frame_size);
   _endTransfer();
   delay(1); // yield() to avoid WDT on ESP8266 and ESP32
 }
@@ -198,10 +189,7 @@ void GxEPD2_074_E2741CS0B2::writeImagePart(const uint8_t bitmap[], int16_t x_par
   // Send dummy frame2 (no color)
   _writeCommand(0x11);
   _startTransfer();
-  for (uint32_t i = 0; i < _frame_size; i++)
-  {
-    _transfer(0xFF);
-  }
+  _transferFill(0xFF, _frame_size);
   _endTransfer();
   delay(1); // yield() to avoid WDT on ESP8266 and ESP32
 }
@@ -31,20 +31,14 @@ void GxEPD2_102::writeScreenBuffer(uint8_t value)
   if (!_using_partial_mode) _Init_Part();
   if (_initial_refresh)
   {
-    _writeCommand(0x10); // init old data
     _startTransfer();
-    for (uint32_t i = 0; i < uint32_t(WIDTH) * uint32_t(HEIGHT) / 8; i++)
-    {
-      _transfer(value);
-    }
+    _transferCommand(0x10); // init old data
+    _transferFill(value, uint32_t(WIDTH) * uint32_t(HEIGHT) / 8);
     _endTransfer();
   }
-  _writeCommand(0x13);
   _startTransfer();
-  for (uint32_t i = 0; i < uint32_t(WIDTH) * uint32_t(HEIGHT) / 8; i++)
-  {
-    _transfer(value);
-  }
+  _transferCommand(0x13);
+  _transferFill(value, uint32_t(WIDTH) * uint32_t(HEIGHT) / 8);
   _endTransfer();
 }
 
@@ -79,30 +73,13 @@ void GxEPD2_102::_writeImage(uint8_t command, const uint8_t bitmap[], int16_t x,
   //uint32_t start = micros();
   _writeCommand(0x91); // partial in
   _setPartialRamArea(x1, y1, w1, h1);
-  _writeCommand(command);
   _startTransfer();
+  _transferCommand(command);
   for (int16_t i = 0; i < h1; i++)
   {
-    for (int16_t j = 0; j < w1 / 8; j++)
-    {
-      uint8_t data;
-      // use wb, h of bitmap for index!
-      int16_t idx = mirror_y ? j + dx / 8 + ((h - 1 - (i + dy))) * wb : j + dx / 8 + (i + dy) * wb;
-      if (pgm)
-      {
-#if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-        data = pgm_read_byte(&bitmap[idx]);
-#else
-        data = bitmap[idx];
-#endif
-      }
-      else
-      {
-        data = bitmap[idx];
-      }
-      if (invert) data = ~data;
-      _transfer(data);
-    }
+    // use wb, h of bitmap for index!
+    int16_t idx = mirror_y ? dx / 8 + ((h - 1 - (i + dy))) * wb : dx / 8 + (i + dy) * wb;
+    _transferBytes(&bitmap[idx], w1 / 8, invert, pgm);
   }
   _endTransfer();
   _writeCommand(0x92); // partial out
@@ -142,30 +119,13 @@ void GxEPD2_102::_writeImagePart(uint8_t command, const uint8_t bitmap[], int16_
   if (!_using_partial_mode) _Init_Part();
   _writeCommand(0x91); // partial in
   _setPartialRamArea(x1, y1, w1, h1);
-  _writeCommand(command);
   _startTransfer();
+  _transferCommand(command);
   for (int16_t i = 0; i < h1; i++)
   {
-    for (int16_t j = 0; j < w1 / 8; j++)
-    {
-      uint8_t data;
-      // use wb_bitmap, h_bitmap of bitmap for index!
-      int16_t idx = mirror_y ? x_part / 8 + j + dx / 8 + ((h_bitmap - 1 - (y_part + i + dy))) * wb_bitmap : x_part / 8 + j + dx / 8 + (y_part + i + dy) * wb_bitmap;
-      if (pgm)
-      {
-#if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-        data = pgm_read_byte(&bitmap[idx]);
-#else
-        data = bitmap[idx];
-#endif
-      }
-      else
-      {
-        data = bitmap[idx];
-      }
-      if (invert) data = ~data;
-      _transfer(data);
-    }
+    // use wb_bitmap, h_bitmap of bitmap for index!
+    int16_t idx = mirror_y ? x_part / 8 + dx / 8 + ((h_bitmap - 1 - (y_part + i + dy))) * wb_bitmap : x_part / 8 + dx / 8 + (y_part + i + dy) * wb_bitmap;
+    _transferBytes(&bitmap[idx], w1 / 8, invert, pgm);
   }
   _endTransfer();
   _writeCommand(0x92); // partial out
@@ -277,8 +237,10 @@ void GxEPD2_102::hibernate()
   _PowerOff();
   if (_rst >= 0)
   {
-    _writeCommand(0x07); // deep sleep
-    _writeData(0xA5);    // check code
+    _startTransfer();
+    _transferCommand(0x07); // deep sleep
+    _transfer(0xA5);     // check code
+    _endTransfer();
     _hibernating = true;
   }
 }
@@ -288,12 +250,14 @@ void GxEPD2_102::_setPartialRamArea(uint16_t x, uint16_t y, uint16_t w, uint16_t
   uint16_t xe = (x + w - 1) | 0x0007; // byte boundary inclusive (last byte)
   uint16_t ye = y + h - 1;
   x &= 0xFFF8; // byte boundary
-  _writeCommand(0x90); // partial window
-  _writeData(x);
-  _writeData(xe);
-  _writeData(y);
-  _writeData(ye);
-  _writeData(0x00);
+  _startTransfer();
+  _transferCommand(0x90); // partial window
+  _transfer(x);
+  _transfer(xe);
+  _transfer(y);
+  _transfer(ye);
+  _transfer(0x00);
+  _endTransfer();
 }
 
 void GxEPD2_102::_PowerOn()
@@ -317,33 +281,35 @@ void GxEPD2_102::_PowerOff()
 void GxEPD2_102::_InitDisplay()
 {
   if (_hibernating) _reset();
-  _writeCommand(0xD2); // ??
-  _writeData(0x3F);
-  _writeCommand(0x00); // Panel Setting Register
-  _writeData (useOTPforFullRefresh ? 0x4F : 0x6F);   // LUT from OTP or from Registers
-  _writeCommand(0x01); // Power Setting
-  _writeData (0x03);   // internal VDH/VDL VGH/VGL
-  _writeData (0x00);   // VDG_LVL +15,-15
-  _writeData (0x2b);   // VDH_LVL +11
-  _writeData (0x2b);   // VDL_LVL -11
-  _writeCommand(0x06); // Charge Pump Setting
-  _writeData(0x3f);    // 50ms, Stength 4, 8kHz
-  _writeCommand(0x2A); // LUT Option
-  _writeData(0x00);    // no all gate on
-  _writeData(0x00);    // 0..5 : 10s, 20..30 : 4.8s
-  _writeCommand(0x30); // PLL
-  _writeData(0x13);    // 30 Hz
-  _writeCommand(0x50); // VCOM and Data interval setting
-  _writeData(0x57);    // default
-  _writeCommand(0x60); // TCON
-  _writeData(0x22);    // 24us
-  _writeCommand(0x61); // Resolution Setting
-  _writeData (0x50);   // HRES 80
-  _writeData (0x80);   // VRES 128
-  _writeCommand(0x82); // Vcom DC Setting
-  _writeData(0x12);    // -1 V
-  _writeCommand(0xe3); // Power Saving
-  _writeData(0x33);    //
+  _startTransfer();
+  _transferCommand(0xD2); // ??
+  _transfer(0x3F);
+  _transferCommand(0x00); // Panel Setting Register
+  _transfer(useOTPforFullRefresh ? 0x4F : 0x6F);     // LUT from OTP or from Registers
+  _transferCommand(0x01); // Power Setting
+  _transfer(0x03);     // internal VDH/VDL VGH/VGL
+  _transfer(0x00);     // VDG_LVL +15,-15
+  _transfer(0x2b);     // VDH_LVL +11
+  _transfer(0x2b);     // VDL_LVL -11
+  _transferCommand(0x06); // Charge Pump Setting
+  _transfer(0x3f);     // 50ms, Stength 4, 8kHz
+  _transferCommand(0x2A); // LUT Option
+  _transfer(0x00);     // no all gate on
+  _transfer(0x00);     // 0..5 : 10s, 20..30 : 4.8s
+  _transferCommand(0x30); // PLL
+  _transfer(0x13);     // 30 Hz
+  _transferCommand(0x50); // VCOM and Data interval setting
+  _transfer(0x57);     // default
+  _transferCommand(0x60); // TCON
+  _transfer(0x22);     // 24us
+  _transferCommand(0x61); // Resolution Setting
+  _transfer(0x50);     // HRES 80
+  _transfer(0x80);     // VRES 128
+  _transferCommand(0x82); // Vcom DC Setting
+  _transfer(0x12);     // -1 V
+  _transferCommand(0xe3); // Power Saving
+  _transfer(0x33);     //
+  _endTransfer();
 }
 
 const unsigned char GxEPD2_102::lut_w_full[] PROGMEM =
@@ -404,15 +370,17 @@ void GxEPD2_102::_Init_Full()
 void GxEPD2_102::_Init_Part()
 {
   _InitDisplay();
-  _writeCommand(0x00); // Panel Setting Register
-  _writeData (0x6F);   // LUT from Registers
-  _writeCommand(0x30); // PLL
-  _writeData(0x05);    // 15Hz
-  _writeCommand(0x50); // VCOM and Data interval setting
-  _writeData(0xF2);    // DDX 11 : differential, VBD 11 : vcom, CDI 2 : 5 hsync
-  _writeCommand(0x82); // Vcom DC Setting
-  _writeData(0x00);    // -0.1 V
-  _writeCommand(0x23);
+  _startTransfer();
+  _transferCommand(0x00); // Panel Setting Register
+  _transfer(0x6F);     // LUT from Registers
+  _transferCommand(0x30); // PLL
+  _transfer(0x05);     // 15Hz
+  _transferCommand(0x50); // VCOM and Data interval setting
+  _transfer(0xF2);     // DDX 11 : differential, VBD 11 : vcom, CDI 2 : 5 hsync
+  _transferCommand(0x82); // Vcom DC Setting
+  _transfer(0x00);     // -0.1 V
+  _transferCommand(0x23);
+  _endTransfer();
   _writeDataPGM(lut_w_partial, sizeof(lut_w_partial));
   _writeCommand(0x24);
   _writeDataPGM(lut_b_partial, sizeof(lut_b_partial));
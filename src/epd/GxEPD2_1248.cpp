@@ -137,10 +137,7 @@ void GxEPD2_1248::writeImage(const uint8_t bitmap[], int16_t x, int16_t y, int16
 {
   if (_initial_write) writeScreenBuffer(); // initial full screen buffer clean
   if (!_using_partial_mode) _Init_Part();
-  S2.writeImagePart(0x13, bitmap, 0, 0, w, h, x, y, w, h, invert, mirror_y, pgm);
-  M2.writeImagePart(0x13, bitmap, 0, 0, w, h, x - S2.WIDTH, y, w, h, invert, mirror_y, pgm);
-  M1.writeImagePart(0x13, bitmap, 0, 0, w, h, x, y - S2.HEIGHT, w, h, invert, mirror_y, pgm);
-  S1.writeImagePart(0x13, bitmap, 0, 0, w, h, x - M1.WIDTH, y - M2.HEIGHT, w, h, invert, mirror_y, pgm);
+  _writeImagePart(0x13, bitmap, 0, 0, w, h, x, y, w, h, invert, mirror_y, pgm);
 }
 
 void GxEPD2_1248::writeImagePart(const uint8_t bitmap[], int16_t x_part, int16_t y_part, int16_t w_bitmap, int16_t h_bitmap,
@@ -148,20 +145,14 @@ void GxEPD2_1248::writeImagePart(const uint8_t bitmap[], int16_t x_part, int16_t
 {
   if (_initial_write) writeScreenBuffer(); // initial full screen buffer clean
   if (!_using_partial_mode) _Init_Part();
-  S2.writeImagePart(0x13, bitmap, x_part, y_part, w, h, x, y, w, h, invert, mirror_y, pgm);
-  M2.writeImagePart(0x13, bitmap, x_part, y_part, w, h, x - S2.WIDTH, y, w, h, invert, mirror_y, pgm);
-  M1.writeImagePart(0x13, bitmap, x_part, y_part, w, h, x, y - S2.HEIGHT, w, h, invert, mirror_y, pgm);
-  S1.writeImagePart(0x13, bitmap, x_part, y_part, w, h, x - M1.WIDTH, y - M2.HEIGHT, w, h, invert, mirror_y, pgm);
+  _writeImagePart(0x13, bitmap, x_part, y_part, w_bitmap, h_bitmap, x, y, w, h, invert, mirror_y, pgm);
 }
 
 void GxEPD2_1248::writeImageAgain(const uint8_t bitmap[], int16_t x, int16_t y, int16_t w, int16_t h, bool invert, bool mirror_y, bool pgm)
 {
   if (_initial_write) writeScreenBuffer(); // initial full screen buffer clean
   if (!_using_partial_mode) _Init_Part();
-  S2.writeImagePart(0x10, bitmap, 0, 0, w, h, x, y, w, h, invert, mirror_y, pgm);
-  M2.writeImagePart(0x10, bitmap, 0, 0, w, h, x - S2.WIDTH, y, w, h, invert, mirror_y, pgm);
-  M1.writeImagePart(0x10, bitmap, 0, 0, w, h, x, y - S2.HEIGHT, w, h, invert, mirror_y, pgm);
-  S1.writeImagePart(0x10, bitmap, 0, 0, w, h, x - M1.WIDTH, y - M2.HEIGHT, w, h, invert, mirror_y, pgm);
+  _writeImagePart(0x10, bitmap, 0, 0, w, h, x, y, w, h, invert, mirror_y, pgm);
 }
 
 void GxEPD2_1248::writeImagePartAgain(const uint8_t bitmap[], int16_t x_part, int16_t y_part, int16_t w_bitmap, int16_t h_bitmap,
@@ -169,10 +160,32 @@ void GxEPD2_1248::writeImagePartAgain(const uint8_t bitmap[], int16_t x_part, in
 {
   if (_initial_write) writeScreenBuffer(); // initial full screen buffer clean
   if (!_using_partial_mode) _Init_Part();
-  S2.writeImagePart(0x10, bitmap, x_part, y_part, w, h, x, y, w, h, invert, mirror_y, pgm);
-  M2.writeImagePart(0x10, bitmap, x_part, y_part, w, h, x - S2.WIDTH, y, w, h, invert, mirror_y, pgm);
-  M1.writeImagePart(0x10, bitmap, x_part, y_part, w, h, x, y - S2.HEIGHT, w, h, invert, mirror_y, pgm);
-  S1.writeImagePart(0x10, bitmap, x_part, y_part, w, h, x - M1.WIDTH, y - M2.HEIGHT, w, h, invert, mirror_y, pgm);
+  _writeImagePart(0x10, bitmap, x_part, y_part, w_bitmap, h_bitmap, x, y, w, h, invert, mirror_y, pgm);
+}
+
+// writes to the controllers of the screen parts touched only
+void GxEPD2_1248::_writeImagePart(uint8_t command, const uint8_t bitmap[], int16_t x_part, int16_t y_part, int16_t w_bitmap, int16_t h_bitmap,
+                                  int16_t x, int16_t y, int16_t w, int16_t h, bool invert, bool mirror_y, bool pgm)
+{
+  uint8_t parts = _parts(x, y, w, h);
+  if (parts & PartS2) S2.writeImagePart(command, bitmap, x_part, y_part, w_bitmap, h_bitmap, x, y, w, h, invert, mirror_y, pgm);
+  if (parts & PartM2) M2.writeImagePart(command, bitmap, x_part, y_part, w_bitmap, h_bitmap, x - S2.WIDTH, y, w, h, invert, mirror_y, pgm);
+  if (parts & PartM1) M1.writeImagePart(command, bitmap, x_part, y_part, w_bitmap, h_bitmap, x, y - S2.HEIGHT, w, h, invert, mirror_y, pgm);
+  if (parts & PartS1) S1.writeImagePart(command, bitmap, x_part, y_part, w_bitmap, h_bitmap, x - M1.WIDTH, y - M2.HEIGHT, w, h, invert, mirror_y, pgm);
+}
+
+uint8_t GxEPD2_1248::_parts(int16_t x, int16_t y, int16_t w, int16_t h)
+{
+  if ((w <= 0) || (h <= 0)) return 0;
+  int16_t x1 = x - x % 8; // byte boundary, as the screen parts write
+  int16_t x2 = x1 + 8 * ((w + 7) / 8);
+  int16_t y2 = y + h;
+  uint8_t parts = 0;
+  if ((x1 < int16_t(S2.WIDTH)) && (x2 > 0) && (y < int16_t(S2.HEIGHT)) && (y2 > 0)) parts |= PartS2;
+  if ((x1 < int16_t(WIDTH)) && (x2 > int16_t(S2.WIDTH)) && (y < int16_t(M2.HEIGHT)) && (y2 > 0)) parts |= PartM2;
+  if ((x1 < int16_t(M1.WIDTH)) && (x2 > 0) && (y < int16_t(HEIGHT)) && (y2 > int16_t(S2.HEIGHT))) parts |= PartM1;
+  if ((x1 < int16_t(WIDTH)) && (x2 > int16_t(M1.WIDTH)) && (y < int16_t(HEIGHT)) && (y2 > int16_t(M2.HEIGHT))) parts |= PartS1;
+  return parts;
 }
 
 void GxEPD2_1248::writeImage(const uint8_t* black, const uint8_t* color, int16_t x, int16_t y, int16_t w, int16_t h, bool invert, bool mirror_y, bool pgm)
@@ -255,7 +268,13 @@ void GxEPD2_1248::refresh(int16_t x, int16_t y, int16_t w, int16_t h)
 {
   if (_initial_refresh) return refresh(false); // initial update needs be full update
   if (!_using_partial_mode) _Init_Part();
-  _Update_Part();
+  // only the controllers of the screen parts touched, each with its partial window
+  uint8_t parts = 0;
+  if (S2.partialIn(x, y, w, h)) parts |= PartS2;
+  if (M2.partialIn(x - S2.WIDTH, y, w, h)) parts |= PartM2;
+  if (M1.partialIn(x, y - S2.HEIGHT, w, h)) parts |= PartM1;
+  if (S1.partialIn(x - M1.WIDTH, y - M2.HEIGHT, w, h)) parts |= PartS1;
+  if (parts) _Update_Part(parts);
 }
 
 void GxEPD2_1248::powerOff(void)
@@ -506,10 +525,17 @@ void GxEPD2_1248::_Update_Full()
   _waitWhileAnyBusy("_Update_Full", full_refresh_time);
 }
 
-void GxEPD2_1248::_Update_Part()
+void GxEPD2_1248::_Update_Part(uint8_t parts)
 {
-  _writeCommandAll(0x12); //display refresh
-  _waitWhileAnyBusy("_Update_Part", partial_refresh_time);
+  if (parts & PartS2) S2.writeCommand(0x12); //display refresh
+  if (parts & PartM2) M2.writeCommand(0x12);
+  if (parts & PartM1) M1.writeCommand(0x12);
+  if (parts & PartS1) S1.writeCommand(0x12);
+  _waitWhilePartsBusy(parts, "_Update_Part", partial_refresh_time);
+  if (parts & PartS2) S2.writeCommand(0x92); // partial out
+  if (parts & PartM2) M2.writeCommand(0x92);
+  if (parts & PartM1) M1.writeCommand(0x92);
+  if (parts & PartS1) S1.writeCommand(0x92);
 }
 
 void GxEPD2_1248::_writeCommandMaster(uint8_t c)
@@ -596,6 +622,11 @@ void GxEPD2_1248::_writeDataPGM_All(const uint8_t* data, uint16_t n, int16_t fil
 }
 
 void GxEPD2_1248::_waitWhileAnyBusy(const char* comment, uint16_t busy_time)
+{
+  _waitWhilePartsBusy(PartsAll, comment, busy_time);
+}
+
+void GxEPD2_1248::_waitWhilePartsBusy(uint8_t parts, const char* comment, uint16_t busy_time)
 {
   if (_busy_m1 >= 0)
   {
@@ -604,10 +635,10 @@ void GxEPD2_1248::_waitWhileAnyBusy(const char* comment, uint16_t busy_time)
     while (1)
     {
       delay(1); // add some margin to become active
-      bool nb_m1 = _busy_m1 >= 0 ? _busy_level != digitalRead(_busy_m1) : true;
-      bool nb_s1 = _busy_m1 >= 0 ? _busy_level != digitalRead(_busy_s1) : true;
-      bool nb_m2 = _busy_m1 >= 0 ? _busy_level != digitalRead(_busy_m2) : true;
-      bool nb_s2 = _busy_m1 >= 0 ? _busy_level != digitalRead(_busy_s2) : true;
+      bool nb_m1 = (_busy_m1 >= 0) && (parts & PartM1) ? _busy_level != digitalRead(_busy_m1) : true;
+      bool nb_s1 = (_busy_m1 >= 0) && (parts & PartS1) ? _busy_level != digitalRead(_busy_s1) : true;
+      bool nb_m2 = (_busy_m1 >= 0) && (parts & PartM2) ? _busy_level != digitalRead(_busy_m2) : true;
+      bool nb_s2 = (_busy_m1 >= 0) && (parts & PartS2) ? _busy_level != digitalRead(_busy_s2) : true;
       if (nb_m1 && nb_s1 && nb_m2 && nb_s2) break;
       delay(1);
       if (micros() - start > _busy_timeout)
@@ -711,10 +742,9 @@ GxEPD2_1248::ScreenPart::ScreenPart(uint16_t width, uint16_t height, bool rev_sc
 void GxEPD2_1248::ScreenPart::writeScreenBuffer(uint8_t command, uint8_t value)
 {
   writeCommand(command); // set current or previous
-  for (uint32_t i = 0; i < uint32_t(WIDTH) * uint32_t(HEIGHT) / 8; i++)
-  {
-    writeData(value);
-  }
+  _startTransfer();
+  _transferFill(value, uint32_t(WIDTH) * uint32_t(HEIGHT) / 8);
+  _endTransfer();
 }
 
 void GxEPD2_1248::ScreenPart::writeImagePart(uint8_t command, const uint8_t bitmap[], int16_t x_part, int16_t y_part, int16_t w_bitmap, int16_t h_bitmap,
@@ -748,32 +778,27 @@ void GxEPD2_1248::ScreenPart::writeImagePart(uint8_t command, const uint8_t bitm
   _startTransfer();
   for (int16_t i = 0; i < h1; i++)
   {
-    for (int16_t j = 0; j < w1 / 8; j++)
-    {
-      uint8_t data;
-      // use wb_bitmap, h_bitmap of bitmap for index!
-      int32_t idx = mirror_y ? x_part / 8 + j + dx / 8 + ((h_bitmap - 1 - (y_part + i + dy))) * wb_bitmap : x_part / 8 + j + dx / 8 + (y_part + i + dy) * wb_bitmap;
-      if (pgm)
-      {
-#if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-        data = pgm_read_byte(&bitmap[idx]);
-#else
-        data = bitmap[idx];
-#endif
-      }
-      else
-      {
-        data = bitmap[idx];
-      }
-      if (invert) data = ~data;
-      _transfer(data);
-    }
+    // use wb_bitmap, h_bitmap of bitmap for index!
+    int32_t idx = mirror_y ? x_part / 8 + dx / 8 + ((h_bitmap - 1 - (y_part + i + dy))) * wb_bitmap : x_part / 8 + dx / 8 + (y_part + i + dy) * wb_bitmap;
+    _transferBytes(&bitmap[idx], w1 / 8, invert, pgm);
   }
   _endTransfer();
   writeCommand(0x92); // partial out
   delay(1); // yield() to avoid WDT on ESP8266 and ESP32
 }
 
+bool GxEPD2_1248::ScreenPart::partialIn(int16_t x, int16_t y, int16_t w, int16_t h)
+{
+  int16_t x1 = x < 0 ? 0 : x; // limit
+  int16_t y1 = y < 0 ? 0 : y; // limit
+  int16_t x2 = x + w < int16_t(WIDTH) ? x + w : int16_t(WIDTH); // limit, exclusive
+  int16_t y2 = y + h < int16_t(HEIGHT) ? y + h : int16_t(HEIGHT); // limit, exclusive
+  if ((x2 <= x1) || (y2 <= y1)) return false;
+  writeCommand(0x91); // partial in
+  _setPartialRamArea(x1, y1, x2 - x1, y2 - y1);
+  return true;
+}
+
 void GxEPD2_1248::ScreenPart::writeCommand(uint8_t c)
 {
   SPI.beginTransaction(_spi_settings);
@@ -823,6 +848,16 @@ void GxEPD2_1248::ScreenPart::_transfer(uint8_t value)
   SPI.transfer(value);
 }
 
+void GxEPD2_1248::ScreenPart::_transferBytes(const uint8_t* data, uint16_t n, bool invert, bool pgm)
+{
+  GxEPD2_EPD::_transferBytes(SPI, data, n, invert, pgm);
+}
+
+void GxEPD2_1248::ScreenPart::_transferFill(uint8_t value, uint32_t n)
+{
+  GxEPD2_EPD::_transferFill(SPI, value, n);
+}
+
 void GxEPD2_1248::ScreenPart::_endTransfer()
 {
   if (_cs >= 0) digitalWrite(_cs, HIGH);
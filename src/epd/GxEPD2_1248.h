@@ -88,13 +88,19 @@ class GxEPD2_1248 : public GxEPD2_EPD
     void _Init_Full();
     void _Init_Part();
     void _Update_Full();
-    void _Update_Part();
+    void _Update_Part(uint8_t parts);
     void _writeCommandMaster(uint8_t c);
     void _writeDataMaster(uint8_t d);
     void _writeCommandAll(uint8_t c);
     void _writeDataAll(uint8_t d);
     void _writeDataPGM_All(const uint8_t* data, uint16_t n, int16_t fill_with_zeroes = 0);
     void _waitWhileAnyBusy(const char* comment = 0, uint16_t busy_time = 5000);
+    void _waitWhilePartsBusy(uint8_t parts, const char* comment = 0, uint16_t busy_time = 5000);
+    // screen parts, controllers: S2 top left, M2 top right, M1 bottom left, S1 bottom right
+    enum {PartS2 = 0x01, PartM2 = 0x02, PartM1 = 0x04, PartS1 = 0x08, PartsAll = 0x0F};
+    uint8_t _parts(int16_t x, int16_t y, int16_t w, int16_t h); // screen parts touched by the area
+    void _writeImagePart(uint8_t command, const uint8_t bitmap[], int16_t x_part, int16_t y_part, int16_t w_bitmap, int16_t h_bitmap,
+                         int16_t x, int16_t y, int16_t w, int16_t h, bool invert, bool mirror_y, bool pgm);
     void _getMasterTemperature();
   private:
     friend class GDEW1248T3_OTP;
@@ -118,12 +124,15 @@ class GxEPD2_1248 : public GxEPD2_EPD
         void writeScreenBuffer(uint8_t command, uint8_t value = 0xFF); // init controller memory current (default white)
         void writeImagePart(uint8_t command, const uint8_t bitmap[], int16_t x_part, int16_t y_part, int16_t w_bitmap, int16_t h_bitmap,
                             int16_t x, int16_t y, int16_t w, int16_t h, bool invert = false, bool mirror_y = false, bool pgm = false);
+        bool partialIn(int16_t x, int16_t y, int16_t w, int16_t h); // partial in with window clipped to the part, false if outside
         void writeCommand(uint8_t c);
         void writeData(uint8_t d);
       private:
         void _setPartialRamArea(uint16_t x, uint16_t y, uint16_t w, uint16_t h);
         void _startTransfer();
         void _transfer(uint8_t value);
+        void _transferBytes(const uint8_t* data, uint16_t n, bool invert = false, bool pgm = false);
+        void _transferFill(uint8_t value, uint32_t n);
         void _endTransfer();
       public:
         const uint16_t WIDTH, HEIGHT;
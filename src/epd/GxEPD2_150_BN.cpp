@@ -44,12 +44,9 @@ void GxEPD2_150_BN::_writeScreenBuffer(uint8_t command, uint8_t value)
 {
   if (!_init_display_done) _InitDisplay();
   _setPartialRamArea(0, 0, WIDTH, HEIGHT);
-  _writeCommand(command);
   _startTransfer();
-  for (uint32_t i = 0; i < uint32_t(WIDTH) * uint32_t(HEIGHT) / 8; i++)
-  {
-    _transfer(value);
-  }
+  _transferCommand(command);
+  _transferFill(value, uint32_t(WIDTH) * uint32_t(HEIGHT) / 8);
   _endTransfer();
 }
 
@@ -88,30 +85,13 @@ void GxEPD2_150_BN::_writeImage(uint8_t command, const uint8_t bitmap[], int16_t
   if (!_init_display_done) _InitDisplay();
   if (_initial_write) writeScreenBuffer(); // initial full screen buffer clean
   _setPartialRamArea(x1, y1, w1, h1);
-  _writeCommand(command);
   _startTransfer();
+  _transferCommand(command);
   for (int16_t i = 0; i < h1; i++)
   {
-    for (int16_t j = 0; j < w1 / 8; j++)
-    {
-      uint8_t data;
-      // use wb, h of bitmap for index!
-      int16_t idx = mirror_y ? j + dx / 8 + ((h - 1 - (i + dy))) * wb : j + dx / 8 + (i + dy) * wb;
-      if (pgm)
-      {
-#if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-        data = pgm_read_byte(&bitmap[idx]);
-#else
-        data = bitmap[idx];
-#endif
-      }
-      else
-      {
-        data = bitmap[idx];
-      }
-      if (invert) data = ~data;
-      _transfer(data);
-    }
+    // use wb, h of bitmap for index!
+    int16_t idx = mirror_y ? dx / 8 + ((h - 1 - (i + dy))) * wb : dx / 8 + (i + dy) * wb;
+    _transferBytes(&bitmap[idx], w1 / 8, invert, pgm);
   }
   _endTransfer();
   delay(1); // yield() to avoid WDT on ESP8266 and ESP32
@@ -155,30 +135,13 @@ void GxEPD2_150_BN::_writeImagePart(uint8_t command, const uint8_t bitmap[], int
   if (!_init_display_done) _InitDisplay();
   if (_initial_write) writeScreenBuffer(); // initial full screen buffer clean
   _setPartialRamArea(x1, y1, w1, h1);
-  _writeCommand(command);
   _startTransfer();
+  _transferCommand(command);
   for (int16_t i = 0; i < h1; i++)
   {
-    for (int16_t j = 0; j < w1 / 8; j++)
-    {
-      uint8_t data;
-      // use wb_bitmap, h_bitmap of bitmap for index!
-      int16_t idx = mirror_y ? x_part / 8 + j + dx / 8 + ((h_bitmap - 1 - (y_part + i + dy))) * wb_bitmap : x_part / 8 + j + dx / 8 + (y_part + i + dy) * wb_bitmap;
-      if (pgm)
-      {
-#if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-        data = pgm_read_byte(&bitmap[idx]);
-#else
-        data = bitmap[idx];
-#endif
-      }
-      else
-      {
-        data = bitmap[idx];
-      }
-      if (invert) data = ~data;
-      _transfer(data);
-    }
+    // use wb_bitmap, h_bitmap of bitmap for index!
+    int16_t idx = mirror_y ? x_part / 8 + dx / 8 + ((h_bitmap - 1 - (y_part + i + dy))) * wb_bitmap : x_part / 8 + dx / 8 + (y_part + i + dy) * wb_bitmap;
+    _transferBytes(&bitmap[idx], w1 / 8, invert, pgm);
   }
   _endTransfer();
   delay(1); // yield() to avoid WDT on ESP8266 and ESP32
@@ -288,8 +251,10 @@ void GxEPD2_150_BN::hibernate()
   _PowerOff();
   if (_rst >= 0)
   {
-    _writeCommand(0x10); // deep sleep mode
-    _writeData(0x1);     // enter deep sleep
+    _startTransfer();
+    _transferCommand(0x10); // deep sleep mode
+    _transfer(0x1);      // enter deep sleep
+    _endTransfer();
     _hibernating = true;
     _init_display_done = false;
   }
@@ -297,30 +262,34 @@ void GxEPD2_150_BN::hibernate()
 
 void GxEPD2_150_BN::_setPartialRamArea(uint16_t x, uint16_t y, uint16_t w, uint16_t h)
 {
-  _writeCommand(0x11); // set ram entry mode
-  _writeData(0x03);    // x increase, y increase : normal mode
-  _writeCommand(0x44);
-  _writeData(x / 8);
-  _writeData((x + w - 1) / 8);
-  _writeCommand(0x45);
-  _writeData(y % 256);
-  _writeData(y / 256);
-  _writeData((y + h - 1) % 256);
-  _writeData((y + h - 1) / 256);
-  _writeCommand(0x4e);
-  _writeData(x / 8);
-  _writeCommand(0x4f);
-  _writeData(y % 256);
-  _writeData(y / 256);
+  _startTransfer();
+  _transferCommand(0x11); // set ram entry mode
+  _transfer(0x03);     // x increase, y increase : normal mode
+  _transferCommand(0x44);
+  _transfer(x / 8);
+  _transfer((x + w - 1) / 8);
+  _transferCommand(0x45);
+  _transfer(y % 256);
+  _transfer(y / 256);
+  _transfer((y + h - 1) % 256);
+  _transfer((y + h - 1) / 256);
+  _transferCommand(0x4e);
+  _transfer(x / 8);
+  _transferCommand(0x4f);
+  _transfer(y % 256);
+  _transfer(y / 256);
+  _endTransfer();
 }
 
 void GxEPD2_150_BN::_PowerOn()
 {
   if (!_power_is_on)
   {
-    _writeCommand(0x22);
-    _writeData(0xf8);
-    _writeCommand(0x20);
+    _startTransfer();
+    _transferCommand(0x22);
+    _transfer(0xf8);
+    _transferCommand(0x20);
+    _endTransfer();
     _waitWhileBusy("_PowerOn", power_on_time);
   }
   _power_is_on = true;
@@ -330,9 +299,11 @@ void GxEPD2_150_BN::_PowerOff()
 {
   if (_power_is_on)
   {
-    _writeCommand(0x22);
-    _writeData(0x83);
-    _writeCommand(0x20);
+    _startTransfer();
+    _transferCommand(0x22);
+    _transfer(0x83);
+    _transferCommand(0x20);
+    _endTransfer();
     _waitWhileBusy("_PowerOff", power_off_time);
   }
   _power_is_on = false;
@@ -345,14 +316,16 @@ void GxEPD2_150_BN::_InitDisplay()
   delay(10); // 10ms according to specs
   _writeCommand(0x12); // soft reset
   delay(10); // 10ms according to specs
-  _writeCommand(0x01); // Driver output control
-  _writeData(0xC7);
-  _writeData(0x00);
-  _writeData(0x00);
-  _writeCommand(0x3C); // BorderWavefrom
-  _writeData(0x05);
-  _writeCommand(0x18); // Read built-in temperature sensor
-  _writeData(0x80);
+  _startTransfer();
+  _transferCommand(0x01); // Driver output control
+  _transfer(0xC7);
+  _transfer(0x00);
+  _transfer(0x00);
+  _transferCommand(0x3C); // BorderWavefrom
+  _transfer(0x05);
+  _transferCommand(0x18); // Read built-in temperature sensor
+  _transfer(0x80);
+  _endTransfer();
   _setPartialRamArea(0, 0, WIDTH, HEIGHT);
   _using_partial_mode = false;
   _init_display_done = true;
@@ -391,9 +364,11 @@ void GxEPD2_150_BN::_Update_Full()
 {
   _using_partial_mode = false;
   _PowerOn();
-  _writeCommand(0x22);
-  _writeData(0xf7); // immediate power off
-  _writeCommand(0x20);
+  _startTransfer();
+  _transferCommand(0x22);
+  _transfer(0xf7);  // immediate power off
+  _transferCommand(0x20);
+  _endTransfer();
   _waitWhileBusy("_Update_Full", full_refresh_time);
   _power_is_on = false;
 }
@@ -402,8 +377,10 @@ void GxEPD2_150_BN::_Update_Part()
 {
   if (!_using_partial_mode) _Init_Part();
   _PowerOn();
-  _writeCommand(0x22);
-  _writeData(0xfc);
-  _writeCommand(0x20);
+  _startTransfer();
+  _transferCommand(0x22);
+  _transfer(0xfc);
+  _transferCommand(0x20);
+  _endTransfer();
   _waitWhileBusy("_Update_Part", partial_refresh_time);
 }
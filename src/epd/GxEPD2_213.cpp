@@ -24,12 +24,9 @@ void GxEPD2_213::clearScreen(uint8_t value)
   {
     _Init_Full();
     _setPartialRamArea(0, 0, WIDTH, HEIGHT);
-    _writeCommand(0x24);
     _startTransfer();
-    for (uint32_t i = 0; i < uint32_t(WIDTH) * uint32_t(HEIGHT) / 8; i++)
-    {
-      _transfer(value);
-    }
+    _transferCommand(0x24);
+    _transferFill(value, uint32_t(WIDTH) * uint32_t(HEIGHT) / 8);
     _endTransfer();
     _Update_Full();
     _initial_refresh = false; // initial full update done
@@ -38,23 +35,17 @@ void GxEPD2_213::clearScreen(uint8_t value)
   {
     if (!_using_partial_mode) _Init_Part();
     _setPartialRamArea(0, 0, WIDTH, HEIGHT);
-    _writeCommand(0x24);
     _startTransfer();
-    for (uint32_t i = 0; i < uint32_t(WIDTH) * uint32_t(HEIGHT) / 8; i++)
-    {
-      _transfer(value);
-    }
+    _transferCommand(0x24);
+    _transferFill(value, uint32_t(WIDTH) * uint32_t(HEIGHT) / 8);
     _endTransfer();
     _Update_Part();
   }
   if (!_using_partial_mode) _Init_Part();
   _setPartialRamArea(0, 0, WIDTH, HEIGHT);
-  _writeCommand(0x24);
   _startTransfer();
-  for (uint32_t i = 0; i < uint32_t(WIDTH) * uint32_t(HEIGHT) / 8; i++)
-  {
-    _transfer(value);
-  }
+  _transferCommand(0x24);
+  _transferFill(value, uint32_t(WIDTH) * uint32_t(HEIGHT) / 8);
   _endTransfer();
   _Update_Part();
 }
@@ -71,12 +62,9 @@ void GxEPD2_213::_writeScreenBuffer(uint8_t value)
 {
   if (!_using_partial_mode) _Init_Part();
   _setPartialRamArea(0, 0, WIDTH, HEIGHT);
-  _writeCommand(0x24);
   _startTransfer();
-  for (uint32_t i = 0; i < uint32_t(WIDTH) * uint32_t(HEIGHT) / 8; i++)
-  {
-    _transfer(value);
-  }
+  _transferCommand(0x24);
+  _transferFill(value, uint32_t(WIDTH) * uint32_t(HEIGHT) / 8);
   _endTransfer();
 }
 
@@ -98,30 +86,13 @@ void GxEPD2_213::writeImage(const uint8_t bitmap[], int16_t x, int16_t y, int16_
   if ((w1 <= 0) || (h1 <= 0)) return;
   if (!_using_partial_mode) _Init_Part();
   _setPartialRamArea(x1, y1, w1, h1);
-  _writeCommand(0x24);
   _startTransfer();
+  _transferCommand(0x24);
   for (int16_t i = 0; i < h1; i++)
   {
-    for (int16_t j = 0; j < w1 / 8; j++)
-    {
-      uint8_t data;
-      // use wb, h of bitmap for index!
-      int16_t idx = mirror_y ? j + dx / 8 + (h - 1 - i) * wb : j + dx / 8 + i * wb;
-      if (pgm)
-      {
-#if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-        data = pgm_read_byte(&bitmap[idx]);
-#else
-        data = bitmap[idx];
-#endif
-      }
-      else
-      {
-        data = bitmap[idx];
-      }
-      if (invert) data = ~data;
-      _transfer(data);
-    }
+    // use wb, h of bitmap for index!
+    int16_t idx = mirror_y ? dx / 8 + (h - 1 - i) * wb : dx / 8 + i * wb;
+    _transferBytes(&bitmap[idx], w1 / 8, invert, pgm);
   }
   _endTransfer();
   delay(1); // yield() to avoid WDT on ESP8266 and ESP32
@@ -152,30 +123,13 @@ void GxEPD2_213::writeImagePart(const uint8_t bitmap[], int16_t x_part, int16_t
   if ((w1 <= 0) || (h1 <= 0)) return;
   if (!_using_partial_mode) _Init_Part();
   _setPartialRamArea(x1, y1, w1, h1);
-  _writeCommand(0x24);
   _startTransfer();
+  _transferCommand(0x24);
   for (int16_t i = 0; i < h1; i++)
   {
-    for (int16_t j = 0; j < w1 / 8; j++)
-    {
-      uint8_t data;
-      // use wb_bitmap, h_bitmap of bitmap for index!
-      int16_t idx = mirror_y ? x_part / 8 + j + dx / 8 + ((h_bitmap - 1 - (y_part + i + dy))) * wb_bitmap : x_part / 8 + j + dx / 8 + (y_part + i + dy) * wb_bitmap;
-      if (pgm)
-      {
-#if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-        data = pgm_read_byte(&bitmap[idx]);
-#else
-        data = bitmap[idx];
-#endif
-      }
-      else
-      {
-        data = bitmap[idx];
-      }
-      if (invert) data = ~data;
-      _transfer(data);
-    }
+    // use wb_bitmap, h_bitmap of bitmap for index!
+    int16_t idx = mirror_y ? x_part / 8 + dx / 8 + ((h_bitmap - 1 - (y_part + i + dy))) * wb_bitmap : x_part / 8 + dx / 8 + (y_part + i + dy) * wb_bitmap;
+    _transferBytes(&bitmap[idx], w1 / 8, invert, pgm);
   }
   _endTransfer();
   delay(1); // yield() to avoid WDT on ESP8266 and ESP32
@@ -284,38 +238,44 @@ void GxEPD2_213::hibernate()
   _PowerOff();
   if (_rst >= 0)
   {
-    _writeCommand(0x10); // deep sleep mode
-    _writeData(0x1);     // enter deep sleep
+    _startTransfer();
+    _transferCommand(0x10); // deep sleep mode
+    _transfer(0x1);      // enter deep sleep
+    _endTransfer();
     _hibernating = true;
   }
 }
 
 void GxEPD2_213::_setPartialRamArea(uint16_t x, uint16_t y, uint16_t w, uint16_t h)
 {
-  _writeCommand(0x11); // set ram entry mode
-  _writeData(0x01);    // x increase, y decrease : as in demo code
-  _writeCommand(0x44);
-  _writeData(x / 8);
-  _writeData((x + w - 1) / 8);
-  _writeCommand(0x45);
-  _writeData((y + h - 1) % 256);
-  _writeData((y + h - 1) / 256);
-  _writeData(y % 256);
-  _writeData(y / 256);
-  _writeCommand(0x4e);
-  _writeData(x / 8);
-  _writeCommand(0x4f);
-  _writeData((y + h - 1) % 256);
-  _writeData((y + h - 1) / 256);
+  _startTransfer();
+  _transferCommand(0x11); // set ram entry mode
+  _transfer(0x01);     // x increase, y decrease : as in demo code
+  _transferCommand(0x44);
+  _transfer(x / 8);
+  _transfer((x + w - 1) / 8);
+  _transferCommand(0x45);
+  _transfer((y + h - 1) % 256);
+  _transfer((y + h - 1) / 256);
+  _transfer(y % 256);
+  _transfer(y / 256);
+  _transferCommand(0x4e);
+  _transfer(x / 8);
+  _transferCommand(0x4f);
+  _transfer((y + h - 1) % 256);
+  _transfer((y + h - 1) / 256);
+  _endTransfer();
 }
 
 void GxEPD2_213::_PowerOn()
 {
   if (!_power_is_on)
   {
-    _writeCommand(0x22);
-    _writeData(0xc0);
-    _writeCommand(0x20);
+    _startTransfer();
+    _transferCommand(0x22);
+    _transfer(0xc0);
+    _transferCommand(0x20);
+    _endTransfer();
     _waitWhileBusy("_PowerOn", power_on_time);
   }
   _power_is_on = true;
@@ -325,9 +285,11 @@ void GxEPD2_213::_PowerOff()
 {
   if (_power_is_on)
   {
-    _writeCommand(0x22);
-    _writeData(0xc3);
-    _writeCommand(0x20);
+    _startTransfer();
+    _transferCommand(0x22);
+    _transfer(0xc3);
+    _transferCommand(0x20);
+    _endTransfer();
     _waitWhileBusy("_PowerOff", power_off_time);
   }
   _power_is_on = false;
@@ -337,20 +299,22 @@ void GxEPD2_213::_PowerOff()
 void GxEPD2_213::_InitDisplay()
 {
   if (_hibernating) _reset();
-  _writeCommand(0x01); // Panel configuration, Gate selection
-  _writeData((HEIGHT - 1) % 256);
-  _writeData((HEIGHT - 1) / 256);
-  _writeData(0x00);
-  _writeCommand(0x0c); // softstart
-  _writeData(0xd7);
-  _writeData(0xd6);
-  _writeData(0x9d);
-  _writeCommand(0x2c); // VCOM setting
-  _writeData(0xa8);    // * different
-  _writeCommand(0x3a); // DummyLine
-  _writeData(0x1a);    // 4 dummy line per gate
-  _writeCommand(0x3b); // Gatetime
-  _writeData(0x08);    // 2us per line
+  _startTransfer();
+  _transferCommand(0x01); // Panel configuration, Gate selection
+  _transfer((HEIGHT - 1) % 256);
+  _transfer((HEIGHT - 1) / 256);
+  _transfer(0x00);
+  _transferCommand(0x0c); // softstart
+  _transfer(0xd7);
+  _transfer(0xd6);
+  _transfer(0x9d);
+  _transferCommand(0x2c); // VCOM setting
+  _transfer(0xa8);     // * different
+  _transferCommand(0x3a); // DummyLine
+  _transfer(0x1a);     // 4 dummy line per gate
+  _transferCommand(0x3b); // Gatetime
+  _transfer(0x08);     // 2us per line
+  _endTransfer();
   _setPartialRamArea(0, 0, WIDTH, HEIGHT);
 }
 
@@ -386,18 +350,22 @@ void GxEPD2_213::_Init_Part()
 
 void GxEPD2_213::_Update_Full()
 {
-  _writeCommand(0x22);
-  _writeData(0xc4);
-  _writeCommand(0x20);
+  _startTransfer();
+  _transferCommand(0x22);
+  _transfer(0xc4);
+  _transferCommand(0x20);
+  _endTransfer();
   _waitWhileBusy("_Update_Full", full_refresh_time);
   _writeCommand(0xff);
 }
 
 void GxEPD2_213::_Update_Part()
 {
-  _writeCommand(0x22);
-  _writeData(0x04);
-  _writeCommand(0x20);
+  _startTransfer();
+  _transferCommand(0x22);
+  _transfer(0x04);
+  _transferCommand(0x20);
+  _endTransfer();
   _waitWhileBusy("_Update_Part", partial_refresh_time);
   _writeCommand(0xff);
 }
@@ -76,30 +76,13 @@ void GxEPD2_213_B72::_writeImage(uint8_t command, const uint8_t bitmap[], int16_
   if ((w1 <= 0) || (h1 <= 0)) return;
   if (!_using_partial_mode) _Init_Part();
   _setPartialRamArea(x1, y1, w1, h1);
-  _writeCommand(command);
   _startTransfer();
+  _transferCommand(command);
   for (int16_t i = 0; i < h1; i++)
   {
-    for (int16_t j = 0; j < w1 / 8; j++)
-    {
-      uint8_t data;
-      // use wb, h of bitmap for index!
-      int16_t idx = mirror_y ? j + dx / 8 + ((h - 1 - (i + dy))) * wb : j + dx / 8 + (i + dy) * wb;
-      if (pgm)
-      {
-#if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-        data = pgm_read_byte(&bitmap[idx]);
-#else
-        data = bitmap[idx];
-#endif
-      }
-      else
-      {
-        data = bitmap[idx];
-      }
-      if (invert) data = ~data;
-      _transfer(data);
-    }
+    // use wb, h of bitmap for index!
+    int16_t idx = mirror_y ? dx / 8 + ((h - 1 - (i + dy))) * wb : dx / 8 + (i + dy) * wb;
+    _transferBytes(&bitmap[idx], w1 / 8, invert, pgm);
   }
   _endTransfer();
   delay(1); // yield() to avoid WDT on ESP8266 and ESP32
@@ -142,30 +125,13 @@ void GxEPD2_213_B72::_writeImagePart(uint8_t command, const uint8_t bitmap[], in
   if ((w1 <= 0) || (h1 <= 0)) return;
   if (!_using_partial_mode) _Init_Part();
   _setPartialRamArea(x1, y1, w1, h1);
-  _writeCommand(command);
   _startTransfer();
+  _transferCommand(command);
   for (int16_t i = 0; i < h1; i++)
   {
-    for (int16_t j = 0; j < w1 / 8; j++)
-    {
-      uint8_t data;
-      // use wb_bitmap, h_bitmap of bitmap for index!
-      int16_t idx = mirror_y ? x_part / 8 + j + dx / 8 + ((h_bitmap - 1 - (y_part + i + dy))) * wb_bitmap : x_part / 8 + j + dx / 8 + (y_part + i + dy) * wb_bitmap;
-      if (pgm)
-      {
-#if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-        data = pgm_read_byte(&bitmap[idx]);
-#else
-        data = bitmap[idx];
-#endif
-      }
-      else
-      {
-        data = bitmap[idx];
-      }
-      if (invert) data = ~data;
-      _transfer(data);
-    }
+    // use wb_bitmap, h_bitmap of bitmap for index!
+    int16_t idx = mirror_y ? x_part / 8 + dx / 8 + ((h_bitmap - 1 - (y_part + i + dy))) * wb_bitmap : x_part / 8 + dx / 8 + (y_part + i + dy) * wb_bitmap;
+    _transferBytes(&bitmap[idx], w1 / 8, invert, pgm);
   }
   _endTransfer();
   delay(1); // yield() to avoid WDT on ESP8266 and ESP32
@@ -277,38 +243,44 @@ void GxEPD2_213_B72::hibernate()
   _PowerOff();
   if (_rst >= 0)
   {
-    _writeCommand(0x10); // deep sleep mode
-    _writeData(0x1);     // enter deep sleep
+    _startTransfer();
+    _transferCommand(0x10); // deep sleep mode
+    _transfer(0x1);      // enter deep sleep
+    _endTransfer();
     _hibernating = true;
   }
 }
 
 void GxEPD2_213_B72::_setPartialRamArea(uint16_t x, uint16_t y, uint16_t w, uint16_t h)
 {
-  _writeCommand(0x11); // set ram entry mode
-  _writeData(0x03);    // x increase, y increase : normal mode
-  _writeCommand(0x44);
-  _writeData(x / 8);
-  _writeData((x + w - 1) / 8);
-  _writeCommand(0x45);
-  _writeData(y % 256);
-  _writeData(y / 256);
-  _writeData((y + h - 1) % 256);
-  _writeData((y + h - 1) / 256);
-  _writeCommand(0x4e);
-  _writeData(x / 8);
-  _writeCommand(0x4f);
-  _writeData(y % 256);
-  _writeData(y / 256);
+  _startTransfer();
+  _transferCommand(0x11); // set ram entry mode
+  _transfer(0x03);     // x increase, y increase : normal mode
+  _transferCommand(0x44);
+  _transfer(x / 8);
+  _transfer((x + w - 1) / 8);
+  _transferCommand(0x45);
+  _transfer(y % 256);
+  _transfer(y / 256);
+  _transfer((y + h - 1) % 256);
+  _transfer((y + h - 1) / 256);
+  _transferCommand(0x4e);
+  _transfer(x / 8);
+  _transferCommand(0x4f);
+  _transfer(y % 256);
+  _transfer(y / 256);
+  _endTransfer();
 }
 
 void GxEPD2_213_B72::_PowerOn()
 {
   if (!_power_is_on)
   {
-    _writeCommand(0x22);
-    _writeData(0xc0);
-    _writeCommand(0x20);
+    _startTransfer();
+    _transferCommand(0x22);
+    _transfer(0xc0);
+    _transferCommand(0x20);
+    _endTransfer();
     _waitWhileBusy("_PowerOn", power_on_time);
   }
   _power_is_on = true;
@@ -316,9 +288,11 @@ void GxEPD2_213_B72::_PowerOn()
 
 void GxEPD2_213_B72::_PowerOff()
 {
-  _writeCommand(0x22);
-  _writeData(0xc3);
-  _writeCommand(0x20);
+  _startTransfer();
+  _transferCommand(0x22);
+  _transfer(0xc3);
+  _transferCommand(0x20);
+  _endTransfer();
   _waitWhileBusy("_PowerOff", power_off_time);
   _power_is_on = false;
   _using_partial_mode = false;
@@ -327,28 +301,30 @@ void GxEPD2_213_B72::_PowerOff()
 void GxEPD2_213_B72::_InitDisplay()
 {
   if (_hibernating) _reset();
-  _writeCommand(0x74); //set analog block control
-  _writeData(0x54);
-  _writeCommand(0x7E); //set digital block control
-  _writeData(0x3B);
-  _writeCommand(0x01); //Driver output control
-  _writeData(0xF9);    // (HEIGHT - 1) % 256
-  _writeData(0x00);    // (HEIGHT - 1) / 256
-  _writeData(0x00);
-  _writeCommand(0x3C); //BorderWavefrom
-  _writeData(0x03);
-  _writeCommand(0x2C); //VCOM Voltage
-  _writeData(0x70);    // NA ??
-  _writeCommand(0x03); //Gate Driving voltage Control
-  _writeData(0x15);    // 19V
-  _writeCommand(0x04); //Source Driving voltage Control
-  _writeData(0x41);    // VSH1 15V
-  _writeData(0xA8);    // VSH2 5V
-  _writeData(0x32);    // VSL -15V
-  _writeCommand(0x3A); //Dummy Line
-  _writeData(0x30);
-  _writeCommand(0x3B); //Gate time
-  _writeData(0x0A);
+  _startTransfer();
+  _transferCommand(0x74); //set analog block control
+  _transfer(0x54);
+  _transferCommand(0x7E); //set digital block control
+  _transfer(0x3B);
+  _transferCommand(0x01); //Driver output control
+  _transfer(0xF9);     // (HEIGHT - 1) % 256
+  _transfer(0x00);     // (HEIGHT - 1) / 256
+  _transfer(0x00);
+  _transferCommand(0x3C); //BorderWavefrom
+  _transfer(0x03);
+  _transferCommand(0x2C); //VCOM Voltage
+  _transfer(0x70);     // NA ??
+  _transferCommand(0x03); //Gate Driving voltage Control
+  _transfer(0x15);     // 19V
+  _transferCommand(0x04); //Source Driving voltage Control
+  _transfer(0x41);     // VSH1 15V
+  _transfer(0xA8);     // VSH2 5V
+  _transfer(0x32);     // VSL -15V
+  _transferCommand(0x3A); //Dummy Line
+  _transfer(0x30);
+  _transferCommand(0x3B); //Gate time
+  _transfer(0x0A);
+  _endTransfer();
   _setPartialRamArea(0, 0, WIDTH, HEIGHT);
 }
 
@@ -396,9 +372,11 @@ void GxEPD2_213_B72::_Init_Full()
 void GxEPD2_213_B72::_Init_Part()
 {
   _InitDisplay();
-  _writeCommand(0x2C); //VCOM Voltage
-  _writeData(0x26);    // NA ??
-  _writeCommand(0x32);
+  _startTransfer();
+  _transferCommand(0x2C); //VCOM Voltage
+  _transfer(0x26);     // NA ??
+  _transferCommand(0x32);
+  _endTransfer();
   _writeDataPGM(LUT_DATA_part, sizeof(LUT_DATA_part));
   _PowerOn();
   _using_partial_mode = true;
@@ -406,16 +384,20 @@ void GxEPD2_213_B72::_Init_Part()
 
 void GxEPD2_213_B72::_Update_Full()
 {
-  _writeCommand(0x22);
-  _writeData(0xc4);
-  _writeCommand(0x20);
+  _startTransfer();
+  _transferCommand(0x22);
+  _transfer(0xc4);
+  _transferCommand(0x20);
+  _endTransfer();
   _waitWhileBusy("_Update_Full", full_refresh_time);
 }
 
 void GxEPD2_213_B72::_Update_Part()
 {
-  _writeCommand(0x22);
-  _writeData(0x04);
-  _writeCommand(0x20);
+  _startTransfer();
+  _transferCommand(0x22);
+  _transfer(0x04);
+  _transferCommand(0x20);
+  _endTransfer();
   _waitWhileBusy("_Update_Part", partial_refresh_time);
 }
@@ -63,30 +63,13 @@ void GxEPD2_260::writeImage(const uint8_t bitmap[], int16_t x, int16_t y, int16_
   if (!_using_partial_mode) _Init_Part();
   _writeCommand(0x91); // partial in
   _setPartialRamArea(x1, y1, w1, h1);
-  _writeCommand(0x13);
   _startTransfer();
+  _transferCommand(0x13);
   for (int16_t i = 0; i < h1; i++)
   {
-    for (int16_t j = 0; j < w1 / 8; j++)
-    {
-      uint8_t data;
-      // use wb, h of bitmap for index!
-      int16_t idx = mirror_y ? j + dx / 8 + ((h - 1 - (i + dy))) * wb : j + dx / 8 + (i + dy) * wb;
-      if (pgm)
-      {
-#if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-        data = pgm_read_byte(&bitmap[idx]);
-#else
-        data = bitmap[idx];
-#endif
-      }
-      else
-      {
-        data = bitmap[idx];
-      }
-      if (invert) data = ~data;
-      _transfer(data);
-    }
+    // use wb, h of bitmap for index!
+    int16_t idx = mirror_y ? dx / 8 + ((h - 1 - (i + dy))) * wb : dx / 8 + (i + dy) * wb;
+    _transferBytes(&bitmap[idx], w1 / 8, invert, pgm);
   }
   _endTransfer();
   _writeCommand(0x92); // partial out
@@ -119,30 +102,13 @@ void GxEPD2_260::writeImagePart(const uint8_t bitmap[], int16_t x_part, int16_t
   if (!_using_partial_mode) _Init_Part();
   _writeCommand(0x91); // partial in
   _setPartialRamArea(x1, y1, w1, h1);
-  _writeCommand(0x13);
   _startTransfer();
+  _transferCommand(0x13);
   for (int16_t i = 0; i < h1; i++)
   {
-    for (int16_t j = 0; j < w1 / 8; j++)
-    {
-      uint8_t data;
-      // use wb_bitmap, h_bitmap of bitmap for index!
-      int16_t idx = mirror_y ? x_part / 8 + j + dx / 8 + ((h_bitmap - 1 - (y_part + i + dy))) * wb_bitmap : x_part / 8 + j + dx / 8 + (y_part + i + dy) * wb_bitmap;
-      if (pgm)
-      {
-#if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-        data = pgm_read_byte(&bitmap[idx]);
-#else
-        data = bitmap[idx];
-#endif
-      }
-      else
-      {
-        data = bitmap[idx];
-      }
-      if (invert) data = ~data;
-      _transfer(data);
-    }
+    // use wb_bitmap, h_bitmap of bitmap for index!
+    int16_t idx = mirror_y ? x_part / 8 + dx / 8 + ((h_bitmap - 1 - (y_part + i + dy))) * wb_bitmap : x_part / 8 + dx / 8 + (y_part + i + dy) * wb_bitmap;
+    _transferBytes(&bitmap[idx], w1 / 8, invert, pgm);
   }
   _endTransfer();
   _writeCommand(0x92); // partial out
@@ -254,8 +220,10 @@ void GxEPD2_260::hibernate()
   _PowerOff();
   if (_rst >= 0)
   {
-    _writeCommand(0x07); // deep sleep
-    _writeData(0xA5);    // check code
+    _startTransfer();
+    _transferCommand(0x07); // deep sleep
+    _transfer(0xA5);     // check code
+    _endTransfer();
     _hibernating = true;
   }
 }
@@ -265,14 +233,16 @@ void GxEPD2_260::_setPartialRamArea(uint16_t x, uint16_t y, uint16_t w, uint16_t
   uint16_t xe = (x + w - 1) | 0x0007; // byte boundary inclusive (last byte)
   uint16_t ye = y + h - 1;
   x &= 0xFFF8; // byte boundary
-  _writeCommand(0x90); // partial window
-  _writeData(x % 256);
-  _writeData(xe % 256);
-  _writeData(y / 256);
-  _writeData(y % 256);
-  _writeData(ye / 256);
-  _writeData(ye % 256);
-  _writeData(0x00);
+  _startTransfer();
+  _transferCommand(0x90); // partial window
+  _transfer(x % 256);
+  _transfer(xe % 256);
+  _transfer(y / 256);
+  _transfer(y % 256);
+  _transfer(ye / 256);
+  _transfer(ye % 256);
+  _transfer(0x00);
+  _endTransfer();
 }
 
 void GxEPD2_260::_PowerOn()
@@ -296,34 +266,38 @@ void GxEPD2_260::_PowerOff()
 void GxEPD2_260::_InitDisplay()
 {
   if (_hibernating) _reset();
-  _writeCommand(0x01); // POWER SETTING
-  _writeData (0x03);
-  _writeData (0x00);
-  _writeData (0x2b);
-  _writeData (0x2b);
-  _writeData (0x03);
-  _writeCommand(0x06); // boost soft start
-  _writeData (0x17);   // A
-  _writeData (0x17);   // B
-  _writeData (0x17);   // C
-  _writeCommand(0x00); // panel setting
-  _writeData(0xbf);    // LUT from REG 128x296
-  _writeData(0x0d);    // VCOM to 0V fast
-  _writeCommand(0x30); // PLL setting
-  _writeData (0x3a);   // 3a 100HZ   29 150Hz 39 200HZ 31 171HZ
-  _writeCommand(0x61); //resolution setting
-  _writeData (WIDTH);
-  _writeData (HEIGHT / 256);
-  _writeData (HEIGHT % 256);
-  _writeCommand(0x82); // vcom_DC setting
+  _startTransfer();
+  _transferCommand(0x01); // POWER SETTING
+  _transfer(0x03);
+  _transfer(0x00);
+  _transfer(0x2b);
+  _transfer(0x2b);
+  _transfer(0x03);
+  _transferCommand(0x06); // boost soft start
+  _transfer(0x17);     // A
+  _transfer(0x17);     // B
+  _transfer(0x17);     // C
+  _transferCommand(0x00); // panel setting
+  _transfer(0xbf);     // LUT from REG 128x296
+  _transfer(0x0d);     // VCOM to 0V fast
+  _transferCommand(0x30); // PLL setting
+  _transfer(0x3a);     // 3a 100HZ   29 150Hz 39 200HZ 31 171HZ
+  _transferCommand(0x61); //resolution setting
+  _transfer(WIDTH);
+  _transfer(HEIGHT / 256);
+  _transfer(HEIGHT % 256);
+  _transferCommand(0x82); // vcom_DC setting
+  _endTransfer();
   //_writeData (0x00);   // -0.1
   //_writeData (0x08);   // -0.1 + 8 * -0.05 = -0.5V from demo
   //_writeData (0x12);   // -0.1 + 18 * -0.05 = -1.0V from OTP, slightly better
   _writeData (0x1c);   // -0.1 + 28 * -0.05 = -1.5V test, better
   //_writeData (0x26);   // -0.1 + 38 * -0.05 = -2.0V test, same
   //_writeData (0x30);   // -0.1 + 48 * -0.05 = -2.5V test, darker
-  _writeCommand(0x50); //VCOM AND DATA INTERVAL SETTING
-  _writeData(0x17);    //WBmode:VBDF 17|D7 VBDW 97 VBDB 57   WBRmode:VBDF F7 VBDW 77 VBDB 37  VBDR B7
+  _startTransfer();
+  _transferCommand(0x50); //VCOM AND DATA INTERVAL SETTING
+  _transfer(0x17);     //WBmode:VBDF 17|D7 VBDW 97 VBDB 57   WBRmode:VBDF F7 VBDW 77 VBDB 37  VBDR B7
+  _endTransfer();
 }
 
 const unsigned char GxEPD2_260::lut_20_vcom0_full[] PROGMEM =
@@ -44,12 +44,9 @@ void GxEPD2_370_TC1::_writeScreenBuffer(uint8_t command, uint8_t value)
 {
   if (!_init_display_done) _InitDisplay();
   _setPartialRamArea(0, 0, WIDTH, HEIGHT);
-  _writeCommand(command);
   _startTransfer();
-  for (uint32_t i = 0; i < uint32_t(WIDTH) * uint32_t(HEIGHT) / 8; i++)
-  {
-    _transfer(value);
-  }
+  _transferCommand(command);
+  _transferFill(value, uint32_t(WIDTH) * uint32_t(HEIGHT) / 8);
   _endTransfer();
 }
 
@@ -89,30 +86,13 @@ void GxEPD2_370_TC1::_writeImage(uint8_t command, const uint8_t bitmap[], int16_
   if (!_init_display_done) _InitDisplay();
   if (_initial_write) writeScreenBuffer(); // initial full screen buffer clean
   _setPartialRamArea(x1, y1, w1, h1);
-  _writeCommand(command);
   _startTransfer();
+  _transferCommand(command);
   for (int16_t i = 0; i < h1; i++)
   {
-    for (int16_t j = 0; j < w1 / 8; j++)
-    {
-      uint8_t data;
-      // use wb, h of bitmap for index!
-      int32_t idx = mirror_y ? j + dx / 8 + ((h - 1 - (i + dy))) * wb : j + dx / 8 + (i + dy) * wb;
-      if (pgm)
-      {
-#if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-        data = pgm_read_byte(&bitmap[idx]);
-#else
-        data = bitmap[idx];
-#endif
-      }
-      else
-      {
-        data = bitmap[idx];
-      }
-      if (invert) data = ~data;
-      _transfer(data);
-    }
+    // use wb, h of bitmap for index!
+    int32_t idx = mirror_y ? dx / 8 + ((h - 1 - (i + dy))) * wb : dx / 8 + (i + dy) * wb;
+    _transferBytes(&bitmap[idx], w1 / 8, invert, pgm);
   }
   _endTransfer();
   delay(1); // yield() to avoid WDT on ESP8266 and ESP32
@@ -156,30 +136,13 @@ void GxEPD2_370_TC1::_writeImagePart(uint8_t command, const uint8_t bitmap[], in
   if (!_init_display_done) _InitDisplay();
   if (_initial_write) writeScreenBuffer(); // initial full screen buffer clean
   _setPartialRamArea(x1, y1, w1, h1);
-  _writeCommand(command);
   _startTransfer();
+  _transferCommand(command);
   for (int16_t i = 0; i < h1; i++)
   {
-    for (int16_t j = 0; j < w1 / 8; j++)
-    {
-      uint8_t data;
-      // use wb_bitmap, h_bitmap of bitmap for index!
-      int32_t idx = mirror_y ? x_part / 8 + j + dx / 8 + ((h_bitmap - 1 - (y_part + i + dy))) * wb_bitmap : x_part / 8 + j + dx / 8 + (y_part + i + dy) * wb_bitmap;
-      if (pgm)
-      {
-#if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-        data = pgm_read_byte(&bitmap[idx]);
-#else
-        data = bitmap[idx];
-#endif
-      }
-      else
-      {
-        data = bitmap[idx];
-      }
-      if (invert) data = ~data;
-      _transfer(data);
-    }
+    // use wb_bitmap, h_bitmap of bitmap for index!
+    int32_t idx = mirror_y ? x_part / 8 + dx / 8 + ((h_bitmap - 1 - (y_part + i + dy))) * wb_bitmap : x_part / 8 + dx / 8 + (y_part + i + dy) * wb_bitmap;
+    _transferBytes(&bitmap[idx], w1 / 8, invert, pgm);
   }
   _endTransfer();
   delay(1); // yield() to avoid WDT on ESP8266 and ESP32
@@ -289,8 +252,10 @@ void GxEPD2_370_TC1::hibernate()
   _PowerOff();
   if (_rst >= 0)
   {
-    _writeCommand(0x10); // deep sleep mode
-    _writeData(0x3);     // enter deep sleep
+    _startTransfer();
+    _transferCommand(0x10); // deep sleep mode
+    _transfer(0x3);      // enter deep sleep
+    _endTransfer();
     _hibernating = true;
     _init_display_done = false;
   }
@@ -298,33 +263,37 @@ void GxEPD2_370_TC1::hibernate()
 
 void GxEPD2_370_TC1::_setPartialRamArea(uint16_t x, uint16_t y, uint16_t w, uint16_t h)
 {
-  _writeCommand(0x11); // set ram entry mode
-  _writeData(0x03);    // x increase, y increase : normal mode
-  _writeCommand(0x44);
-  _writeData(x % 256);
-  _writeData(x / 256);
-  _writeData((x + w - 1) % 256);
-  _writeData((x + w - 1) / 256);
-  _writeCommand(0x45);
-  _writeData(y % 256);
-  _writeData(y / 256);
-  _writeData((y + h - 1) % 256);
-  _writeData((y + h - 1) / 256);
-  _writeCommand(0x4e);
-  _writeData(x % 256);
-  _writeData(x / 256);
-  _writeCommand(0x4f);
-  _writeData(y % 256);
-  _writeData(y / 256);
+  _startTransfer();
+  _transferCommand(0x11); // set ram entry mode
+  _transfer(0x03);     // x increase, y increase : normal mode
+  _transferCommand(0x44);
+  _transfer(x % 256);
+  _transfer(x / 256);
+  _transfer((x + w - 1) % 256);
+  _transfer((x + w - 1) / 256);
+  _transferCommand(0x45);
+  _transfer(y % 256);
+  _transfer(y / 256);
+  _transfer((y + h - 1) % 256);
+  _transfer((y + h - 1) / 256);
+  _transferCommand(0x4e);
+  _transfer(x % 256);
+  _transfer(x / 256);
+  _transferCommand(0x4f);
+  _transfer(y % 256);
+  _transfer(y / 256);
+  _endTransfer();
 }
 
 void GxEPD2_370_TC1::_PowerOn()
 {
   if (!_power_is_on)
   {
-    _writeCommand(0x22);
-    _writeData(0xc0);
-    _writeCommand(0x20);
+    _startTransfer();
+    _transferCommand(0x22);
+    _transfer(0xc0);
+    _transferCommand(0x20);
+    _endTransfer();
     _waitWhileBusy("_PowerOn", power_on_time);
   }
   _power_is_on = true;
@@ -334,9 +303,11 @@ void GxEPD2_370_TC1::_PowerOff()
 {
   if (_power_is_on)
   {
-    _writeCommand(0x22);
-    _writeData(0x83);
-    _writeCommand(0x20);
+    _startTransfer();
+    _transferCommand(0x22);
+    _transfer(0x83);
+    _transferCommand(0x20);
+    _endTransfer();
     _waitWhileBusy("_PowerOff", power_off_time);
   }
   _power_is_on = false;
@@ -354,39 +325,41 @@ void GxEPD2_370_TC1::_InitDisplay()
   //_writeCommand(0x47); // Auto Write B/W RAM **DON'T USE WITH GxEPD2**
   //_writeData(0xF7);
   //_waitWhileBusy("_InitDisplay 2", power_on_time);
-  _writeCommand(0x01); // Driver Output control
-  _writeData(0xDF);
-  _writeData(0x01);
-  _writeData(0x00);
-  _writeCommand(0x03); // Gate Driving voltage Control
-  _writeData(0x00);
-  _writeCommand(0x04); // Source Driving voltage Control
-  _writeData(0x41);
-  _writeData(0xA8);
-  _writeData(0x32);
-  _writeCommand(0x11); // Data Entry mode setting
-  _writeData(0x03);
-  _writeCommand(0x0C); // Booster Soft-start Control
-  _writeData(0xAE);
-  _writeData(0xC7);
-  _writeData(0xC3);
-  _writeData(0xC0);
-  _writeData(0xC0);
-  _writeCommand(0x18); // Temperature Sensor Control
-  _writeData(0x80);    // A[7:0] = 80h Internal temperature sensor
-  _writeCommand(0x2C); // Write VCOM register
-  _writeData(0x44);    // -1.7
-  _writeCommand(0x37); // Write Register for Display Option, these setting turn on previous function
-  _writeData(0x00);
-  _writeData(0xff);
-  _writeData(0xff);
-  _writeData(0xff);
-  _writeData(0xff);
-  _writeData(0x4f); // enable ping pong for mode 2
-  _writeData(0xff);
-  _writeData(0xff);
-  _writeData(0xff);
-  _writeData(0xff);
+  _startTransfer();
+  _transferCommand(0x01); // Driver Output control
+  _transfer(0xDF);
+  _transfer(0x01);
+  _transfer(0x00);
+  _transferCommand(0x03); // Gate Driving voltage Control
+  _transfer(0x00);
+  _transferCommand(0x04); // Source Driving voltage Control
+  _transfer(0x41);
+  _transfer(0xA8);
+  _transfer(0x32);
+  _transferCommand(0x11); // Data Entry mode setting
+  _transfer(0x03);
+  _transferCommand(0x0C); // Booster Soft-start Control
+  _transfer(0xAE);
+  _transfer(0xC7);
+  _transfer(0xC3);
+  _transfer(0xC0);
+  _transfer(0xC0);
+  _transferCommand(0x18); // Temperature Sensor Control
+  _transfer(0x80);     // A[7:0] = 80h Internal temperature sensor
+  _transferCommand(0x2C); // Write VCOM register
+  _transfer(0x44);     // -1.7
+  _transferCommand(0x37); // Write Register for Display Option, these setting turn on previous function
+  _transfer(0x00);
+  _transfer(0xff);
+  _transfer(0xff);
+  _transfer(0xff);
+  _transfer(0xff);
+  _transfer(0x4f);  // enable ping pong for mode 2
+  _transfer(0xff);
+  _transfer(0xff);
+  _transfer(0xff);
+  _transfer(0xff);
+  _endTransfer();
   _setPartialRamArea(0, 0, WIDTH, HEIGHT);
   _Init_Full();
   _init_display_done = true;
@@ -424,18 +397,22 @@ const uint8_t GxEPD2_370_TC1::lut_partial[] PROGMEM =
 
 void GxEPD2_370_TC1::_Init_Full()
 {
-  _writeCommand(0x3C); // Border Waveform Control
-  _writeData(0x01); // LUT1, for white
-  _writeCommand(0x32);
+  _startTransfer();
+  _transferCommand(0x3C); // Border Waveform Control
+  _transfer(0x01);  // LUT1, for white
+  _transferCommand(0x32);
+  _endTransfer();
   _writeDataPGM(lut_full, sizeof(lut_full));
   _using_partial_mode = false;
 }
 
 void GxEPD2_370_TC1::_Init_Part()
 {
-  _writeCommand(0x3C); // Border Waveform Control
-  _writeData(0xC0);    // HiZ, [POR], floating
-  _writeCommand(0x32);
+  _startTransfer();
+  _transferCommand(0x3C); // Border Waveform Control
+  _transfer(0xC0);     // HiZ, [POR], floating
+  _transferCommand(0x32);
+  _endTransfer();
   _writeDataPGM(lut_partial, sizeof(lut_partial));
   _using_partial_mode = true;
 }
@@ -444,8 +421,10 @@ void GxEPD2_370_TC1::_Update_Full()
 {
   if (_using_partial_mode) _Init_Full();
   _PowerOn();
-  _writeCommand(0x22);
-  _writeData(0xcf); // enable clock, enable analog, display mode 2, disable analog, disable clock. Waveshare demo
+  _startTransfer();
+  _transferCommand(0x22);
+  _transfer(0xcf);  // enable clock, enable analog, display mode 2, disable analog, disable clock. Waveshare demo
+  _endTransfer();
   //_writeData(0xc4); // enable clock, enable analog, display mode 1
   //_writeData(0xf4); // enable clock, enable analog, read temp, load LUT, display mode 1
   _writeCommand(0x20);
@@ -457,8 +436,10 @@ void GxEPD2_370_TC1::_Update_Part()
 {
   if (!_using_partial_mode) _Init_Part();
   _PowerOn();
-  _writeCommand(0x22);
-  _writeData(0xcf); // enable clock, enable analog, display mode 2, disable analog, disable clock. Waveshare demo
+  _startTransfer();
+  _transferCommand(0x22);
+  _transfer(0xcf);  // enable clock, enable analog, display mode 2, disable analog, disable clock. Waveshare demo
+  _endTransfer();
   //_writeData(0xc8); // enable clock, enable analog, display mode 2, ?
   //_writeData(0xcc); // enable clock, enable analog, display mode 2, ?
   _writeCommand(0x20);
@@ -29,21 +29,15 @@ void GxEPD2_371::writeScreenBuffer(uint8_t value)
 {
   _initial_write = false; // initial full screen buffer clean done
   if (!_using_partial_mode) _Init_Part();
-  _writeCommand(0x13); // set current
   _startTransfer();
-  for (uint32_t i = 0; i < uint32_t(WIDTH) * uint32_t(HEIGHT) / 8; i++)
-  {
-    _transfer(value);
-  }
+  _transferCommand(0x13); // set current
+  _transferFill(value, uint32_t(WIDTH) * uint32_t(HEIGHT) / 8);
   _endTransfer();
   if (_initial_refresh)
   {
-    _writeCommand(0x10); // preset previous
     _startTransfer();
-    for (uint32_t i = 0; i < uint32_t(WIDTH) * uint32_t(HEIGHT) / 8; i++)
-    {
-      _transfer(0xFF); // 0xFF is white
-    }
+    _transferCommand(0x10); // preset previous
+    _transferFill(0xFF, uint32_t(WIDTH) * uint32_t(HEIGHT) / 8); // 0xFF is white
     _endTransfer();
   }
 }
@@ -67,30 +61,13 @@ void GxEPD2_371::writeImage(const uint8_t bitmap[], int16_t x, int16_t y, int16_
   if (!_using_partial_mode) _Init_Part();
   _writeCommand(0x91); // partial in
   _setPartialRamArea(x1, y1, w1, h1);
-  _writeCommand(0x13);
   _startTransfer();
+  _transferCommand(0x13);
   for (int16_t i = 0; i < h1; i++)
   {
-    for (int16_t j = 0; j < w1 / 8; j++)
-    {
-      uint8_t data;
-      // use wb, h of bitmap for index!
-      int16_t idx = mirror_y ? j + dx / 8 + ((h - 1 - (i + dy))) * wb : j + dx / 8 + (i + dy) * wb;
-      if (pgm)
-      {
-#if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-        data = pgm_read_byte(&bitmap[idx]);
-#else
-        data = bitmap[idx];
-#endif
-      }
-      else
-      {
-        data = bitmap[idx];
-      }
-      if (invert) data = ~data;
-      _transfer(data);
-    }
+    // use wb, h of bitmap for index!
+    int16_t idx = mirror_y ? dx / 8 + ((h - 1 - (i + dy))) * wb : dx / 8 + (i + dy) * wb;
+    _transferBytes(&bitmap[idx], w1 / 8, invert, pgm);
   }
   _endTransfer();
   _writeCommand(0x92); // partial out
@@ -123,30 +100,13 @@ void GxEPD2_371::writeImagePart(const uint8_t bitmap[], int16_t x_part, int16_t
   if (!_using_partial_mode) _Init_Part();
   _writeCommand(0x91); // partial in
   _setPartialRamArea(x1, y1, w1, h1);
-  _writeCommand(0x13);
   _startTransfer();
+  _transferCommand(0x13);
   for (int16_t i = 0; i < h1; i++)
   {
-    for (int16_t j = 0; j < w1 / 8; j++)
-    {
-      uint8_t data;
-      // use wb_bitmap, h_bitmap of bitmap for index!
-      int16_t idx = mirror_y ? x_part / 8 + j + dx / 8 + ((h_bitmap - 1 - (y_part + i + dy))) * wb_bitmap : x_part / 8 + j + dx / 8 + (y_part + i + dy) * wb_bitmap;
-      if (pgm)
-      {
-#if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-        data = pgm_read_byte(&bitmap[idx]);
-#else
-        data = bitmap[idx];
-#endif
-      }
-      else
-      {
-        data = bitmap[idx];
-      }
-      if (invert) data = ~data;
-      _transfer(data);
-    }
+    // use wb_bitmap, h_bitmap of bitmap for index!
+    int16_t idx = mirror_y ? x_part / 8 + dx / 8 + ((h_bitmap - 1 - (y_part + i + dy))) * wb_bitmap : x_part / 8 + dx / 8 + (y_part + i + dy) * wb_bitmap;
+    _transferBytes(&bitmap[idx], w1 / 8, invert, pgm);
   }
   _endTransfer();
   _writeCommand(0x92); // partial out
@@ -258,8 +218,10 @@ void GxEPD2_371::hibernate()
   _PowerOff();
   if (_rst >= 0)
   {
-    _writeCommand(0x07); // deep sleep
-    _writeData(0xA5);    // check code
+    _startTransfer();
+    _transferCommand(0x07); // deep sleep
+    _transfer(0xA5);     // check code
+    _endTransfer();
     _hibernating = true;
   }
 }
@@ -269,14 +231,16 @@ void GxEPD2_371::_setPartialRamArea(uint16_t x, uint16_t y, uint16_t w, uint16_t
   uint16_t xe = (x + w - 1) | 0x0007; // byte boundary inclusive (last byte)
   uint16_t ye = y + h - 1;
   x &= 0xFFF8; // byte boundary
-  _writeCommand(0x90); // partial window
-  _writeData(x % 256);
-  _writeData(xe % 256);
-  _writeData(y / 256);
-  _writeData(y % 256);
-  _writeData(ye / 256);
-  _writeData(ye % 256);
-  _writeData(0x01);
+  _startTransfer();
+  _transferCommand(0x90); // partial window
+  _transfer(x % 256);
+  _transfer(xe % 256);
+  _transfer(y / 256);
+  _transfer(y % 256);
+  _transfer(ye / 256);
+  _transfer(ye % 256);
+  _transfer(0x01);
+  _endTransfer();
 }
 
 void GxEPD2_371::_PowerOn()
@@ -293,9 +257,11 @@ void GxEPD2_371::_PowerOff()
 {
   if (_power_is_on)
   {
-    _writeCommand(0x03); // power off sequence
-    _writeData(0x30);
-    _writeCommand(0x02); // power off
+    _startTransfer();
+    _transferCommand(0x03); // power off sequence
+    _transfer(0x30);
+    _transferCommand(0x02); // power off
+    _endTransfer();
     _waitWhileBusy("_PowerOff", power_off_time);
   }
   _power_is_on = false;
@@ -305,27 +271,31 @@ void GxEPD2_371::_PowerOff()
 void GxEPD2_371::_InitDisplay()
 {
   if (_hibernating) _reset();
-  _writeCommand(0x01); // power setting
-  _writeData (0x07);
-  _writeData (0x07);   // VGH=20V,VGL=-20V
-  _writeData (0x3f);   // VDH=15V
-  _writeData (0x3f);   // VDL=-15V
-  _writeCommand(0x06); // boost soft start
-  _writeData (0x17);   // A
-  _writeData (0x17);   // B
-  _writeData (0x1d);   // C
+  _startTransfer();
+  _transferCommand(0x01); // power setting
+  _transfer(0x07);
+  _transfer(0x07);     // VGH=20V,VGL=-20V
+  _transfer(0x3f);     // VDH=15V
+  _transfer(0x3f);     // VDL=-15V
+  _transferCommand(0x06); // boost soft start
+  _transfer(0x17);     // A
+  _transfer(0x17);     // B
+  _transfer(0x1d);     // C
+  _endTransfer();
   _PowerOn();
-  _writeCommand(0x00); // panel setting
-  _writeData(0x1f);    // LUT from OTP
-  _writeCommand(0x61); // resolution setting
-  _writeData (WIDTH);
-  _writeData (HEIGHT / 256);
-  _writeData (HEIGHT % 256);
-  _writeCommand(0x82); // vcom_DC setting
-  _writeData (0x1C);
-  _writeCommand(0x50); // VCOM AND DATA INTERVAL SETTING
-  _writeData(0x29);    // LUTKW, N2OCP: copy new to old
-  _writeData(0x07);
+  _startTransfer();
+  _transferCommand(0x00); // panel setting
+  _transfer(0x1f);     // LUT from OTP
+  _transferCommand(0x61); // resolution setting
+  _transfer(WIDTH);
+  _transfer(HEIGHT / 256);
+  _transfer(HEIGHT % 256);
+  _transferCommand(0x82); // vcom_DC setting
+  _transfer(0x1C);
+  _transferCommand(0x50); // VCOM AND DATA INTERVAL SETTING
+  _transfer(0x29);     // LUTKW, N2OCP: copy new to old
+  _transfer(0x07);
+  _endTransfer();
 }
 
 // experimental partial screen update LUTs with balanced charge
@@ -371,8 +341,10 @@ const unsigned char GxEPD2_371::lut_25_LUTBD_partial[] PROGMEM =
 void GxEPD2_371::_Init_Full()
 {
   _InitDisplay();
-  _writeCommand(0x00); // panel setting
-  _writeData(0x1f);    // full update LUT from OTP
+  _startTransfer();
+  _transferCommand(0x00); // panel setting
+  _transfer(0x1f);     // full update LUT from OTP
+  _endTransfer();
   _PowerOn();
   _using_partial_mode = false;
 }
@@ -380,12 +352,14 @@ void GxEPD2_371::_Init_Full()
 void GxEPD2_371::_Init_Part()
 {
   _InitDisplay();
-  _writeCommand(0x00); //panel setting
-  _writeData(hasFastPartialUpdate ? 0x3f : 0x1f); // partial update LUT from registers
-  _writeCommand(0x50); // VCOM AND DATA INTERVAL SETTING
-  _writeData(0x39);    // LUTBD, N2OCP: copy new to old
-  _writeData(0x07);
-  _writeCommand(0x20);
+  _startTransfer();
+  _transferCommand(0x00); //panel setting
+  _transfer(hasFastPartialUpdate ? 0x3f : 0x1f);  // partial update LUT from registers
+  _transferCommand(0x50); // VCOM AND DATA INTERVAL SETTING
+  _transfer(0x39);     // LUTBD, N2OCP: copy new to old
+  _transfer(0x07);
+  _transferCommand(0x20);
+  _endTransfer();
   _writeDataPGM(lut_20_LUTC_partial, sizeof(lut_20_LUTC_partial), 42 - sizeof(lut_20_LUTC_partial));
   _writeCommand(0x21);
   _writeDataPGM(lut_21_LUTWW_partial, sizeof(lut_21_LUTWW_partial), 42 - sizeof(lut_21_LUTWW_partial));
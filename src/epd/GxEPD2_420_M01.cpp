@@ -31,20 +31,14 @@ void GxEPD2_420_M01::writeScreenBuffer(uint8_t value)
   if (!_using_partial_mode) _Init_Part();
   if (_initial_refresh)
   {
-    _writeCommand(0x10); // init old data
     _startTransfer();
-    for (uint32_t i = 0; i < uint32_t(WIDTH) * uint32_t(HEIGHT) / 8; i++)
-    {
-      _transfer(value);
-    }
+    _transferCommand(0x10); // init old data
+    _transferFill(value, uint32_t(WIDTH) * uint32_t(HEIGHT) / 8);
     _endTransfer();
   }
-  _writeCommand(0x13);
   _startTransfer();
-  for (uint32_t i = 0; i < uint32_t(WIDTH) * uint32_t(HEIGHT) / 8; i++)
-  {
-    _transfer(value);
-  }
+  _transferCommand(0x13);
+  _transferFill(value, uint32_t(WIDTH) * uint32_t(HEIGHT) / 8);
   _endTransfer();
 }
 
@@ -68,30 +62,13 @@ void GxEPD2_420_M01::writeImage(const uint8_t bitmap[], int16_t x, int16_t y, in
   //uint32_t start = micros();
   _writeCommand(0x91); // partial in
   _setPartialRamArea(x1, y1, w1, h1);
-  _writeCommand(0x13);
   _startTransfer();
+  _transferCommand(0x13);
   for (int16_t i = 0; i < h1; i++)
   {
-    for (int16_t j = 0; j < w1 / 8; j++)
-    {
-      uint8_t data;
-      // use wb, h of bitmap for index!
-      int16_t idx = mirror_y ? j + dx / 8 + ((h - 1 - (i + dy))) * wb : j + dx / 8 + (i + dy) * wb;
-      if (pgm)
-      {
-#if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-        data = pgm_read_byte(&bitmap[idx]);
-#else
-        data = bitmap[idx];
-#endif
-      }
-      else
-      {
-        data = bitmap[idx];
-      }
-      if (invert) data = ~data;
-      _transfer(data);
-    }
+    // use wb, h of bitmap for index!
+    int16_t idx = mirror_y ? dx / 8 + ((h - 1 - (i + dy))) * wb : dx / 8 + (i + dy) * wb;
+    _transferBytes(&bitmap[idx], w1 / 8, invert, pgm);
   }
   _endTransfer();
   _writeCommand(0x92); // partial out
@@ -125,30 +102,13 @@ void GxEPD2_420_M01::writeImagePart(const uint8_t bitmap[], int16_t x_part, int1
   if (!_using_partial_mode) _Init_Part();
   _writeCommand(0x91); // partial in
   _setPartialRamArea(x1, y1, w1, h1);
-  _writeCommand(0x13);
   _startTransfer();
+  _transferCommand(0x13);
   for (int16_t i = 0; i < h1; i++)
   {
-    for (int16_t j = 0; j < w1 / 8; j++)
-    {
-      uint8_t data;
-      // use wb_bitmap, h_bitmap of bitmap for index!
-      int16_t idx = mirror_y ? x_part / 8 + j + dx / 8 + ((h_bitmap - 1 - (y_part + i + dy))) * wb_bitmap : x_part / 8 + j + dx / 8 + (y_part + i + dy) * wb_bitmap;
-      if (pgm)
-      {
-#if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-        data = pgm_read_byte(&bitmap[idx]);
-#else
-        data = bitmap[idx];
-#endif
-      }
-      else
-      {
-        data = bitmap[idx];
-      }
-      if (invert) data = ~data;
-      _transfer(data);
-    }
+    // use wb_bitmap, h_bitmap of bitmap for index!
+    int16_t idx = mirror_y ? x_part / 8 + dx / 8 + ((h_bitmap - 1 - (y_part + i + dy))) * wb_bitmap : x_part / 8 + dx / 8 + (y_part + i + dy) * wb_bitmap;
+    _transferBytes(&bitmap[idx], w1 / 8, invert, pgm);
   }
   _endTransfer();
   _writeCommand(0x92); // partial out
@@ -260,8 +220,10 @@ void GxEPD2_420_M01::hibernate()
   _PowerOff();
   if (_rst >= 0)
   {
-    _writeCommand(0x07); // deep sleep
-    _writeData(0xA5);    // check code
+    _startTransfer();
+    _transferCommand(0x07); // deep sleep
+    _transfer(0xA5);     // check code
+    _endTransfer();
     _hibernating = true;
   }
 }
@@ -271,16 +233,18 @@ void GxEPD2_420_M01::_setPartialRamArea(uint16_t x, uint16_t y, uint16_t w, uint
   uint16_t xe = (x + w - 1) | 0x0007; // byte boundary inclusive (last byte)
   uint16_t ye = y + h - 1;
   x &= 0xFFF8; // byte boundary
-  _writeCommand(0x90); // partial window
-  _writeData(x / 256);
-  _writeData(x % 256);
-  _writeData(xe / 256);
-  _writeData(xe % 256);
-  _writeData(y / 256);
-  _writeData(y % 256);
-  _writeData(ye / 256);
-  _writeData(ye % 256);
-  _writeData(0x01); // don't see any difference
+  _startTransfer();
+  _transferCommand(0x90); // partial window
+  _transfer(x / 256);
+  _transfer(x % 256);
+  _transfer(xe / 256);
+  _transfer(xe % 256);
+  _transfer(y / 256);
+  _transfer(y % 256);
+  _transfer(ye / 256);
+  _transfer(ye % 256);
+  _transfer(0x01);  // don't see any difference
+  _endTransfer();
   //_writeData(0x00); // don't see any difference
 }
 
@@ -305,11 +269,13 @@ void GxEPD2_420_M01::_PowerOff()
 void GxEPD2_420_M01::_InitDisplay()
 {
   if (_hibernating) _reset();
-  _writeCommand(0x00);     //panel setting
-  _writeData(0x1f);    //LUT from OTP
-  _writeData(0x0d);    //waiting for the electronic paper IC to release the idle signal
-  _writeCommand(0x50);  //VCOM AND DATA INTERVAL SETTING
-  _writeData(0x97);
+  _startTransfer();
+  _transferCommand(0x00);  //panel setting
+  _transfer(0x1f);     //LUT from OTP
+  _transfer(0x0d);     //waiting for the electronic paper IC to release the idle signal
+  _transferCommand(0x50); //VCOM AND DATA INTERVAL SETTING
+  _transfer(0x97);
+  _endTransfer();
 }
 
 // experimental partial screen update LUTs with balanced charge
@@ -361,30 +327,32 @@ void GxEPD2_420_M01::_Init_Part()
   _InitDisplay();
   if (hasPartialUpdate)
   {
-    _writeCommand(0x01); // POWER SETTING
-    _writeData (0x03);   // VDS_EN, VDG_EN internal
-    _writeData (0x00);   // VCOM_HV, VGHL_LV=16V
-    _writeData (0x2b);   // VDH=11V
-    _writeData (0x2b);   // VDL=11V
-    _writeCommand(0x06); // boost soft start
-    _writeData (0x17);   // A
-    _writeData (0x17);   // B
-    _writeData (0x17);   // C
-    _writeCommand(0x00); // panel setting
-    _writeData(0x3f);    // 300x400 B/W mode, LUT set by register
-    _writeCommand(0x30); // PLL setting
-    _writeData (0x3a);   // 3a 100HZ   29 150Hz 39 200HZ 31 171HZ
-    _writeCommand(0x61); // resolution setting
-    _writeData (WIDTH / 256);
-    _writeData (WIDTH % 256);
-    _writeData (HEIGHT / 256);
-    _writeData (HEIGHT % 256);
-    _writeCommand(0x82); // vcom_DC setting
-    _writeData (0x1A);   // -0.1 + 26 * -0.05 = -1.4V from OTP
-    _writeCommand(0x50); // VCOM AND DATA INTERVAL SETTING
+    _startTransfer();
+    _transferCommand(0x01); // POWER SETTING
+    _transfer(0x03);     // VDS_EN, VDG_EN internal
+    _transfer(0x00);     // VCOM_HV, VGHL_LV=16V
+    _transfer(0x2b);     // VDH=11V
+    _transfer(0x2b);     // VDL=11V
+    _transferCommand(0x06); // boost soft start
+    _transfer(0x17);     // A
+    _transfer(0x17);     // B
+    _transfer(0x17);     // C
+    _transferCommand(0x00); // panel setting
+    _transfer(0x3f);     // 300x400 B/W mode, LUT set by register
+    _transferCommand(0x30); // PLL setting
+    _transfer(0x3a);     // 3a 100HZ   29 150Hz 39 200HZ 31 171HZ
+    _transferCommand(0x61); // resolution setting
+    _transfer(WIDTH / 256);
+    _transfer(WIDTH % 256);
+    _transfer(HEIGHT / 256);
+    _transfer(HEIGHT % 256);
+    _transferCommand(0x82); // vcom_DC setting
+    _transfer(0x1A);     // -0.1 + 26 * -0.05 = -1.4V from OTP
+    _transferCommand(0x50); // VCOM AND DATA INTERVAL SETTING
     //_writeData(0x97);    // WBmode:VBDF 17|D7 VBDW 97 VBDB 57   WBRmode:VBDF F7 VBDW 77 VBDB 37  VBDR B7
-    _writeData(0xd7);    // border floating to avoid flashing
-    _writeCommand(0x20);
+    _transfer(0xd7);     // border floating to avoid flashing
+    _transferCommand(0x20);
+    _endTransfer();
     _writeDataPGM(lut_20_vcom0_partial, sizeof(lut_20_vcom0_partial), 44 - sizeof(lut_20_vcom0_partial));
     _writeCommand(0x21);
     _writeDataPGM(lut_21_ww_partial, sizeof(lut_21_ww_partial), 42 - sizeof(lut_21_ww_partial));
@@ -29,21 +29,15 @@ void GxEPD2_750_T7::writeScreenBuffer(uint8_t value)
 {
   _initial_write = false; // initial full screen buffer clean done
   if (!_using_partial_mode) _Init_Part();
-  _writeCommand(0x13); // set current
   _startTransfer();
-  for (uint32_t i = 0; i < uint32_t(WIDTH) * uint32_t(HEIGHT) / 8; i++)
-  {
-    _transfer(value);
-  }
+  _transferCommand(0x13); // set current
+  _transferFill(value, uint32_t(WIDTH) * uint32_t(HEIGHT) / 8);
   _endTransfer();
   if (_initial_refresh)
   {
-    _writeCommand(0x10); // preset previous
     _startTransfer();
-    for (uint32_t i = 0; i < uint32_t(WIDTH) * uint32_t(HEIGHT) / 8; i++)
-    {
-      _transfer(0xFF); // 0xFF is white
-    }
+    _transferCommand(0x10); // preset previous
+    _transferFill(0xFF, uint32_t(WIDTH) * uint32_t(HEIGHT) / 8); // 0xFF is white
     _endTransfer();
   }
 }
@@ -67,30 +61,13 @@ void GxEPD2_750_T7::writeImage(const uint8_t bitmap[], int16_t x, int16_t y, int
   if (!_using_partial_mode) _Init_Part();
   _writeCommand(0x91); // partial in
   _setPartialRamArea(x1, y1, w1, h1);
-  _writeCommand(0x13);
   _startTransfer();
+  _transferCommand(0x13);
   for (int16_t i = 0; i < h1; i++)
   {
-    for (int16_t j = 0; j < w1 / 8; j++)
-    {
-      uint8_t data;
-      // use wb, h of bitmap for index!
-      uint16_t idx = mirror_y ? j + dx / 8 + uint16_t((h - 1 - (i + dy))) * wb : j + dx / 8 + uint16_t(i + dy) * wb;
-      if (pgm)
-      {
-#if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-        data = pgm_read_byte(&bitmap[idx]);
-#else
-        data = bitmap[idx];
-#endif
-      }
-      else
-      {
-        data = bitmap[idx];
-      }
-      if (invert) data = ~data;
-      _transfer(data);
-    }
+    // use wb, h of bitmap for index!
+    uint16_t idx = mirror_y ? dx / 8 + uint16_t((h - 1 - (i + dy))) * wb : dx / 8 + uint16_t(i + dy) * wb;
+    _transferBytes(&bitmap[idx], w1 / 8, invert, pgm);
   }
   _endTransfer();
   _writeCommand(0x92); // partial out
@@ -123,30 +100,13 @@ void GxEPD2_750_T7::writeImagePart(const uint8_t bitmap[], int16_t x_part, int16
   if (!_using_partial_mode) _Init_Part();
   _writeCommand(0x91); // partial in
   _setPartialRamArea(x1, y1, w1, h1);
-  _writeCommand(0x13);
   _startTransfer();
+  _transferCommand(0x13);
   for (int16_t i = 0; i < h1; i++)
   {
-    for (int16_t j = 0; j < w1 / 8; j++)
-    {
-      uint8_t data;
-      // use wb_bitmap, h_bitmap of bitmap for index!
-      uint16_t idx = mirror_y ? x_part / 8 + j + dx / 8 + uint16_t((h_bitmap - 1 - (y_part + i + dy))) * wb_bitmap : x_part / 8 + j + dx / 8 + uint16_t(y_part + i + dy) * wb_bitmap;
-      if (pgm)
-      {
-#if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-        data = pgm_read_byte(&bitmap[idx]);
-#else
-        data = bitmap[idx];
-#endif
-      }
-      else
-      {
-        data = bitmap[idx];
-      }
-      if (invert) data = ~data;
-      _transfer(data);
-    }
+    // use wb_bitmap, h_bitmap of bitmap for index!
+    uint16_t idx = mirror_y ? x_part / 8 + dx / 8 + uint16_t((h_bitmap - 1 - (y_part + i + dy))) * wb_bitmap : x_part / 8 + dx / 8 + uint16_t(y_part + i + dy) * wb_bitmap;
+    _transferBytes(&bitmap[idx], w1 / 8, invert, pgm);
   }
   _endTransfer();
   _writeCommand(0x92); // partial out
@@ -258,8 +218,10 @@ void GxEPD2_750_T7::hibernate()
   _PowerOff();
   if (_rst >= 0)
   {
-    _writeCommand(0x07); // deep sleep
-    _writeData(0xA5);    // check code
+    _startTransfer();
+    _transferCommand(0x07); // deep sleep
+    _transfer(0xA5);     // check code
+    _endTransfer();
     _hibernating = true;
   }
 }
@@ -269,16 +231,18 @@ void GxEPD2_750_T7::_setPartialRamArea(uint16_t x, uint16_t y, uint16_t w, uint1
   uint16_t xe = (x + w - 1) | 0x0007; // byte boundary inclusive (last byte)
   uint16_t ye = y + h - 1;
   x &= 0xFFF8; // byte boundary
-  _writeCommand(0x90); // partial window
-  _writeData(x / 256);
-  _writeData(x % 256);
-  _writeData(xe / 256);
-  _writeData(xe % 256);
-  _writeData(y / 256);
-  _writeData(y % 256);
-  _writeData(ye / 256);
-  _writeData(ye % 256);
-  _writeData(0x01); // don't see any difference
+  _startTransfer();
+  _transferCommand(0x90); // partial window
+  _transfer(x / 256);
+  _transfer(x % 256);
+  _transfer(xe / 256);
+  _transfer(xe % 256);
+  _transfer(y / 256);
+  _transfer(y % 256);
+  _transfer(ye / 256);
+  _transfer(ye % 256);
+  _transfer(0x01);  // don't see any difference
+  _endTransfer();
   //_writeData(0x00); // don't see any difference
 }
 
@@ -306,25 +270,27 @@ void GxEPD2_750_T7::_PowerOff()
 void GxEPD2_750_T7::_InitDisplay()
 {
   if (_hibernating) _reset();
-  _writeCommand(0x01); // POWER SETTING
-  _writeData (0x07);
-  _writeData (0x07); // VGH=20V,VGL=-20V
-  _writeData (0x3f); // VDH=15V
-  _writeData (0x3f); // VDL=-15V
-  _writeCommand(0x00); //PANEL SETTING
-  _writeData(0x1f); //KW: 3f, KWR: 2F, BWROTP: 0f, BWOTP: 1f
-  _writeCommand(0x61); //tres
-  _writeData (WIDTH / 256); //source 800
-  _writeData (WIDTH % 256);
-  _writeData (HEIGHT / 256); //gate 480
-  _writeData (HEIGHT % 256);
-  _writeCommand(0x15);
-  _writeData(0x00);
-  _writeCommand(0x50); //VCOM AND DATA INTERVAL SETTING
-  _writeData(0x29);    // LUTKW, N2OCP: copy new to old
-  _writeData(0x07);
-  _writeCommand(0x60); //TCON SETTING
-  _writeData(0x22);
+  _startTransfer();
+  _transferCommand(0x01); // POWER SETTING
+  _transfer(0x07);
+  _transfer(0x07);   // VGH=20V,VGL=-20V
+  _transfer(0x3f);   // VDH=15V
+  _transfer(0x3f);   // VDL=-15V
+  _transferCommand(0x00); //PANEL SETTING
+  _transfer(0x1f);  //KW: 3f, KWR: 2F, BWROTP: 0f, BWOTP: 1f
+  _transferCommand(0x61); //tres
+  _transfer(WIDTH / 256);   //source 800
+  _transfer(WIDTH % 256);
+  _transfer(HEIGHT / 256);   //gate 480
+  _transfer(HEIGHT % 256);
+  _transferCommand(0x15);
+  _transfer(0x00);
+  _transferCommand(0x50); //VCOM AND DATA INTERVAL SETTING
+  _transfer(0x29);     // LUTKW, N2OCP: copy new to old
+  _transfer(0x07);
+  _transferCommand(0x60); //TCON SETTING
+  _transfer(0x22);
+  _endTransfer();
 }
 
 // experimental partial screen update LUTs with balanced charge
@@ -370,8 +336,10 @@ const unsigned char GxEPD2_750_T7::lut_25_LUTBD_partial[] PROGMEM =
 void GxEPD2_750_T7::_Init_Full()
 {
   _InitDisplay();
-  _writeCommand(0x00); // panel setting
-  _writeData(0x1f);    // full update LUT from OTP
+  _startTransfer();
+  _transferCommand(0x00); // panel setting
+  _transfer(0x1f);     // full update LUT from OTP
+  _endTransfer();
   _PowerOn();
   _using_partial_mode = false;
 }
@@ -379,16 +347,18 @@ void GxEPD2_750_T7::_Init_Full()
 void GxEPD2_750_T7::_Init_Part()
 {
   _InitDisplay();
-  _writeCommand(0x00); //panel setting
-  _writeData(hasFastPartialUpdate ? 0x3f : 0x1f); // partial update LUT from registers
-  _writeCommand(0x82); // vcom_DC setting
+  _startTransfer();
+  _transferCommand(0x00); //panel setting
+  _transfer(hasFastPartialUpdate ? 0x3f : 0x1f);  // partial update LUT from registers
+  _transferCommand(0x82); // vcom_DC setting
   //_writeData (0x2C); // -2.3V same value as in OTP
-  _writeData (0x26); // -2.0V
+  _transfer(0x26);   // -2.0V
   //_writeData (0x1C); // -1.5V
-  _writeCommand(0x50); // VCOM AND DATA INTERVAL SETTING
-  _writeData(0x39);    // LUTBD, N2OCP: copy new to old
-  _writeData(0x07);
-  _writeCommand(0x20);
+  _transferCommand(0x50); // VCOM AND DATA INTERVAL SETTING
+  _transfer(0x39);     // LUTBD, N2OCP: copy new to old
+  _transfer(0x07);
+  _transferCommand(0x20);
+  _endTransfer();
   _writeDataPGM(lut_20_LUTC_partial, sizeof(lut_20_LUTC_partial), 42 - sizeof(lut_20_LUTC_partial));
   _writeCommand(0x21);
   _writeDataPGM(lut_21_LUTWW_partial, sizeof(lut_21_LUTWW_partial), 42 - sizeof(lut_21_LUTWW_partial));
@@ -48,20 +48,14 @@ void GxEPD2_074c_E2741FS081::writeScreenBuffer(uint8_t black_value, uint8_t colo
   // Send black frame (frame1) - 0x00 for black, 0xFF for white
   _writeCommand(0x10);
   _startTransfer();
-  for (uint32_t i = 0; i < _frame_size; i++)
-  {
-    _transfer(black_value);
-  }
+  _transferFill(black_value, _frame_size);
   _endTransfer();
   // Send RAM_RW again for second frame
   _sendIndexData(0x12, data3, 3);
   // Send color frame (frame2) - 0x00 for red, 0xFF for no-red
   _writeCommand(0x11);
   _startTransfer();
-  for (uint32_t i = 0; i < _frame_size; i++)
-  {
-    _transfer(color_value);
-  }
+  _transferFill(color_value, _frame_size);
   _endTransfer();
   _initial_write = false;
 }
@@ -120,6 +120,8 @@ class GxEPD2_1248c : public GxEPD2_EPD
         void _setPartialRamArea(uint16_t x, uint16_t y, uint16_t w, uint16_t h);
         void _startTransfer();
         void _transfer(uint8_t value);
+        void _transferBytes(const uint8_t* data, uint16_t n, bool invert = false, bool pgm = false);
+        void _transferFill(uint8_t value, uint32_t n);
         void _endTransfer();
       public:
         const uint16_t WIDTH, HEIGHT;
@@ -52,8 +52,10 @@ void GxEPD2_154c::clearScreen(uint8_t black_value, uint8_t color_value)
   _writeCommand(0x10);
   for (uint32_t i = 0; i < uint32_t(WIDTH) * uint32_t(HEIGHT) / 8; i++)
   {
-    _writeData(bw2grey[(black_value & 0xF0) >> 4]);
-    _writeData(bw2grey[black_value & 0x0F]);
+    _startTransfer();
+    _transfer(bw2grey[(black_value & 0xF0) >> 4]);
+    _transfer(bw2grey[black_value & 0x0F]);
+    _endTransfer();
   }
   _writeCommand(0x13);
   for (uint32_t i = 0; i < uint32_t(WIDTH) * uint32_t(HEIGHT) / 8; i++)
@@ -74,8 +76,10 @@ void GxEPD2_154c::writeScreenBuffer(uint8_t black_value, uint8_t color_value)
   _writeCommand(0x10);
   for (uint32_t i = 0; i < uint32_t(WIDTH) * uint32_t(HEIGHT) / 8; i++)
   {
-    _writeData(bw2grey[(black_value & 0xF0) >> 4]);
-    _writeData(bw2grey[black_value & 0x0F]);
+    _startTransfer();
+    _transfer(bw2grey[(black_value & 0xF0) >> 4]);
+    _transfer(bw2grey[black_value & 0x0F]);
+    _endTransfer();
   }
   _writeCommand(0x13);
   for (uint32_t i = 0; i < uint32_t(WIDTH) * uint32_t(HEIGHT) / 8; i++)
@@ -101,8 +105,10 @@ void GxEPD2_154c::writeImage(const uint8_t* black, const uint8_t* color, int16_t
     {
       for (uint32_t i = 0; i < uint32_t(WIDTH) * uint32_t(h) / 8; i++)
       {
-        _writeData(bw2grey[(black[i] & 0xF0) >> 4]);
-        _writeData(bw2grey[black[i] & 0x0F]);
+        _startTransfer();
+        _transfer(bw2grey[(black[i] & 0xF0) >> 4]);
+        _transfer(bw2grey[black[i] & 0x0F]);
+        _endTransfer();
       }
       if (y + h == HEIGHT) // last page
       {
@@ -160,8 +166,10 @@ void GxEPD2_154c::writeImage(const uint8_t* black, const uint8_t* color, int16_t
           }
         }
         //_writeData(data);
-        _writeData(bw2grey[(data & 0xF0) >> 4]);
-        _writeData(bw2grey[data & 0x0F]);
+        _startTransfer();
+        _transfer(bw2grey[(data & 0xF0) >> 4]);
+        _transfer(bw2grey[data & 0x0F]);
+        _endTransfer();
       }
     }
     _writeCommand(0x13);
@@ -255,8 +263,10 @@ void GxEPD2_154c::writeImagePart(const uint8_t* black, const uint8_t* color, int
         }
       }
       //_writeData(data);
-      _writeData(bw2grey[(data & 0xF0) >> 4]);
-      _writeData(bw2grey[data & 0x0F]);
+      _startTransfer();
+      _transfer(bw2grey[(data & 0xF0) >> 4]);
+      _transfer(bw2grey[data & 0x0F]);
+      _endTransfer();
     }
   }
   _writeCommand(0x13);
@@ -354,8 +364,10 @@ void GxEPD2_154c::hibernate()
   if (_rst >= 0)
   {
     // check if it supports this command!
-    _writeCommand(0x07); // deep sleep
-    _writeData(0xA5);    // check code
+    _startTransfer();
+    _transferCommand(0x07); // deep sleep
+    _transfer(0xA5);     // check code
+    _endTransfer();
     _hibernating = true;
   }
 }
@@ -378,15 +390,17 @@ void GxEPD2_154c::_PowerOff()
 {
   if (_power_is_on)
   {
-    _writeCommand(0x50);
-    _writeData(0x17);    //BD floating
-    _writeCommand(0x82);     //to solve Vcom drop
-    _writeData(0x00);
-    _writeCommand(0x01);     //power setting
-    _writeData(0x02);    //gate switch to external
-    _writeData(0x00);
-    _writeData(0x00);
-    _writeData(0x00);
+    _startTransfer();
+    _transferCommand(0x50);
+    _transfer(0x17);     //BD floating
+    _transferCommand(0x82);  //to solve Vcom drop
+    _transfer(0x00);
+    _transferCommand(0x01);  //power setting
+    _transfer(0x02);     //gate switch to external
+    _transfer(0x00);
+    _transfer(0x00);
+    _transfer(0x00);
+    _endTransfer();
     delay(1500);     //delay 1.5S
     _writeCommand(0x02); // power off
     //_waitWhileBusy("_PowerOff", power_off_time); // causes busy timeout
@@ -405,28 +419,32 @@ void GxEPD2_154c::setPaged()
 void GxEPD2_154c::_InitDisplay()
 {
   if (_hibernating) _reset();
-  _writeCommand(0x01);
-  _writeData(0x07);
-  _writeData(0x00);
-  _writeData(0x08);
-  _writeData(0x00);
-  _writeCommand(0x06);
-  _writeData(0x07);
-  _writeData(0x07);
-  _writeData(0x07);
+  _startTransfer();
+  _transferCommand(0x01);
+  _transfer(0x07);
+  _transfer(0x00);
+  _transfer(0x08);
+  _transfer(0x00);
+  _transferCommand(0x06);
+  _transfer(0x07);
+  _transfer(0x07);
+  _transfer(0x07);
+  _endTransfer();
   _PowerOn(); //power on needed here!
-  _writeCommand(0x00);
-  _writeData(0xcf);
-  _writeCommand(0x50);
-  _writeData(0x37);
-  _writeCommand(0x30);
-  _writeData(0x39);
-  _writeCommand(0x61);
-  _writeData(0xC8);
-  _writeData(0x00);
-  _writeData(0xC8);
-  _writeCommand(0x82);
-  _writeData(0x0E);
+  _startTransfer();
+  _transferCommand(0x00);
+  _transfer(0xcf);
+  _transferCommand(0x50);
+  _transfer(0x37);
+  _transferCommand(0x30);
+  _transfer(0x39);
+  _transferCommand(0x61);
+  _transfer(0xC8);
+  _transfer(0x00);
+  _transfer(0xC8);
+  _transferCommand(0x82);
+  _transfer(0x0E);
+  _endTransfer();
 }
 
 const uint8_t GxEPD2_154c::lut_20_vcom0[] PROGMEM = {  0x0E  , 0x14 , 0x01 , 0x0A , 0x06 , 0x04 , 0x0A , 0x0A , 0x0F , 0x03 , 0x03 , 0x0C , 0x06 , 0x0A , 0x00 };
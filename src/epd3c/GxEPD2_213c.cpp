@@ -312,8 +312,10 @@ void GxEPD2_213c::hibernate()
   _PowerOff();
   if (_rst >= 0)
   {
-    _writeCommand(0x07); // deep sleep
-    _writeData(0xA5);    // check code
+    _startTransfer();
+    _transferCommand(0x07); // deep sleep
+    _transfer(0xA5);     // check code
+    _endTransfer();
     _hibernating = true;
   }
 }
@@ -323,16 +325,18 @@ void GxEPD2_213c::_setPartialRamArea(uint16_t x, uint16_t y, uint16_t w, uint16_
   uint16_t xe = (x + w - 1) | 0x0007; // byte boundary inclusive (last byte)
   uint16_t ye = y + h - 1;
   x &= 0xFFF8; // byte boundary
-  _writeCommand(0x90); // partial window
+  _startTransfer();
+  _transferCommand(0x90); // partial window
   //_writeData(x / 256);
-  _writeData(x % 256);
+  _transfer(x % 256);
   //_writeData(xe / 256);
-  _writeData(xe % 256);
-  _writeData(y / 256);
-  _writeData(y % 256);
-  _writeData(ye / 256);
-  _writeData(ye % 256);
-  _writeData(0x01); // don't see any difference
+  _transfer(xe % 256);
+  _transfer(y / 256);
+  _transfer(y % 256);
+  _transfer(ye / 256);
+  _transfer(ye % 256);
+  _transfer(0x01);  // don't see any difference
+  _endTransfer();
   //_writeData(0x00); // don't see any difference
 }
 
@@ -359,20 +363,24 @@ void GxEPD2_213c::_PowerOff()
 void GxEPD2_213c::_InitDisplay()
 {
   if (_hibernating) _reset();
-  _writeCommand(0x06);
-  _writeData (0x17);
-  _writeData (0x17);
-  _writeData (0x17);
+  _startTransfer();
+  _transferCommand(0x06);
+  _transfer(0x17);
+  _transfer(0x17);
+  _transfer(0x17);
+  _endTransfer();
   //_writeCommand(0x04);
   //_waitWhileBusy("_wakeUp Power On");
-  _writeCommand(0X00);
-  _writeData(0x8f);
-  _writeCommand(0x50); //VCOM AND DATA INTERVAL SETTING
-  _writeData(0x77);    //WBmode:VBDF 17|D7 VBDW 97 VBDB 57   WBRmode:VBDF F7 VBDW 77 VBDB 37  VBDR B7
-  _writeCommand(0x61); //resolution setting
-  _writeData (0x68);   //source 104
-  _writeData (0x00);
-  _writeData (0xd4);   //gate 212
+  _startTransfer();
+  _transferCommand(0X00);
+  _transfer(0x8f);
+  _transferCommand(0x50); //VCOM AND DATA INTERVAL SETTING
+  _transfer(0x77);     //WBmode:VBDF 17|D7 VBDW 97 VBDB 57   WBRmode:VBDF F7 VBDW 77 VBDB 37  VBDR B7
+  _transferCommand(0x61); //resolution setting
+  _transfer(0x68);     //source 104
+  _transfer(0x00);
+  _transfer(0xd4);     //gate 212
+  _endTransfer();
 }
 
 void GxEPD2_213c::_Init_Full()
@@ -384,8 +392,10 @@ void GxEPD2_213c::_Init_Full()
 void GxEPD2_213c::_Init_Part()
 {
   _InitDisplay();
-  _writeCommand(0x50); //VCOM AND DATA INTERVAL SETTING
-  _writeData(0x77);    //WBmode:VBDF 17|D7 VBDW 97 VBDB 57   WBRmode:VBDF F7 VBDW 77 VBDB 37  VBDR B7
+  _startTransfer();
+  _transferCommand(0x50); //VCOM AND DATA INTERVAL SETTING
+  _transfer(0x77);     //WBmode:VBDF 17|D7 VBDW 97 VBDB 57   WBRmode:VBDF F7 VBDW 77 VBDB 37  VBDR B7
+  _endTransfer();
   //_writeData(0xF7);    //WBmode:VBDF 17|D7 VBDW 97 VBDB 57   WBRmode:VBDF F7 VBDW 77 VBDB 37  VBDR B7
   _PowerOn();
 }
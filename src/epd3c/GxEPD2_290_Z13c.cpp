@@ -293,8 +293,10 @@ void GxEPD2_290_Z13c::hibernate()
   _PowerOff();
   if (_rst >= 0)
   {
-    _writeCommand(0x07); // deep sleep
-    _writeData(0xA5);    // check code
+    _startTransfer();
+    _transferCommand(0x07); // deep sleep
+    _transfer(0xA5);     // check code
+    _endTransfer();
     _hibernating = true;
   }
 }
@@ -305,17 +307,19 @@ void GxEPD2_290_Z13c::_setPartialRamArea(uint16_t x, uint16_t y, uint16_t w, uin
   uint16_t xe = (x + w - 1) | 0x0007; // byte boundary inclusive (last byte)
   uint16_t ye = y + h - 1;
   x &= 0xFFF8; // byte boundary
-  _writeCommand(0x90); // partial window
+  _startTransfer();
+  _transferCommand(0x90); // partial window
   //_writeData(x / 256);
-  _writeData(x % 256);
+  _transfer(x % 256);
   //_writeData(xe / 256);
-  _writeData(xe % 256);
-  _writeData(y / 256);
-  _writeData(y % 256);
-  _writeData(ye / 256);
-  _writeData(ye % 256);
+  _transfer(xe % 256);
+  _transfer(y / 256);
+  _transfer(y % 256);
+  _transfer(ye / 256);
+  _transfer(ye % 256);
   //_writeData(0x01); // don't see any difference
-  _writeData(0x00); // don't see any difference
+  _transfer(0x00);  // don't see any difference
+  _endTransfer();
 }
 
 void GxEPD2_290_Z13c::_PowerOn()
@@ -332,9 +336,11 @@ void GxEPD2_290_Z13c::_PowerOff()
 {
   if (_power_is_on)
   {
-    _writeCommand(0x50);
-    _writeData(0xf7); // border floating
-    _writeCommand(0x02); // power off
+    _startTransfer();
+    _transferCommand(0x50);
+    _transfer(0xf7);  // border floating
+    _transferCommand(0x02); // power off
+    _endTransfer();
     _waitWhileBusy("_PowerOff", power_off_time);
     _power_is_on = false;
   }
@@ -343,14 +349,16 @@ void GxEPD2_290_Z13c::_PowerOff()
 void GxEPD2_290_Z13c::_InitDisplay()
 {
   if (_hibernating) _reset();
-  _writeCommand(0x00); // panel setting
-  _writeData(0x8f);    // LUT from OTP
-  _writeCommand(0x61); // resolution setting
-  _writeData (WIDTH);
-  _writeData (HEIGHT >> 8);
-  _writeData (HEIGHT & 0xFF);
-  _writeCommand(0x50); // VCOM AND DATA INTERVAL SETTING
-  _writeData(0x77);    // WBmode:VBDF 17|D7 VBDW 97 VBDB 57   WBRmode:VBDF F7 VBDW 77 VBDB 37  VBDR B7
+  _startTransfer();
+  _transferCommand(0x00); // panel setting
+  _transfer(0x8f);     // LUT from OTP
+  _transferCommand(0x61); // resolution setting
+  _transfer(WIDTH);
+  _transfer(HEIGHT >> 8);
+  _transfer(HEIGHT & 0xFF);
+  _transferCommand(0x50); // VCOM AND DATA INTERVAL SETTING
+  _transfer(0x77);     // WBmode:VBDF 17|D7 VBDW 97 VBDB 57   WBRmode:VBDF F7 VBDW 77 VBDB 37  VBDR B7
+  _endTransfer();
 }
 
 void GxEPD2_290_Z13c::_Init_Full()
@@ -423,14 +431,18 @@ void GxEPD2_290_Z13c::refresh_bw(int16_t x, int16_t y, int16_t w, int16_t h)
   _writeDataPGM(lut_23_wb_partial, sizeof(lut_23_wb_partial), 42 - sizeof(lut_23_wb_partial));
   _writeCommand(0x24);
   _writeDataPGM(lut_24_bb_partial, sizeof(lut_24_bb_partial), 42 - sizeof(lut_24_bb_partial));
-  _writeCommand(0x00); // panel setting
-  _writeData(0xbf);    // LUT from registers, b/w
-  _writeCommand(0x50); // VCOM AND DATA INTERVAL SETTING
-  _writeData(0xf7);    // WBmode:VBDF 17|D7 VBDW 97 VBDB 57   WBRmode:VBDF F7 VBDW 77 VBDB 37  VBDR B7
-  _writeCommand(0x91); // partial in
+  _startTransfer();
+  _transferCommand(0x00); // panel setting
+  _transfer(0xbf);     // LUT from registers, b/w
+  _transferCommand(0x50); // VCOM AND DATA INTERVAL SETTING
+  _transfer(0xf7);     // WBmode:VBDF 17|D7 VBDW 97 VBDB 57   WBRmode:VBDF F7 VBDW 77 VBDB 37  VBDR B7
+  _transferCommand(0x91); // partial in
+  _endTransfer();
   _setPartialRamArea(x1, y1, w1, h1);
   _Update_Part();
-  _writeCommand(0x92); // partial out
-  _writeCommand(0x00); // panel setting
-  _writeData(0x8f);    // LUT from OTP
+  _startTransfer();
+  _transferCommand(0x92); // partial out
+  _transferCommand(0x00); // panel setting
+  _transfer(0x8f);     // LUT from OTP
+  _endTransfer();
 }
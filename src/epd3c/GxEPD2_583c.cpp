@@ -24,12 +24,9 @@ void GxEPD2_583c::clearScreen(uint8_t value)
   _Init_Part();
   _writeCommand(0x91); // partial in
   _setPartialRamArea(0, 0, WIDTH, HEIGHT);
-  _writeCommand(0x10);
   _startTransfer();
-  for (uint32_t i = 0; i < uint32_t(WIDTH) * uint32_t(HEIGHT) / 2; i++)
-  {
-    _transfer(value);
-  }
+  _transferCommand(0x10);
+  _transferFill(value, uint32_t(WIDTH) * uint32_t(HEIGHT) / 2);
   _endTransfer();
   _Update_Part();
   _writeCommand(0x92); // partial out
@@ -41,8 +38,8 @@ void GxEPD2_583c::clearScreen(uint8_t black_value, uint8_t color_value)
   _Init_Part();
   _writeCommand(0x91); // partial in
   _setPartialRamArea(0, 0, WIDTH, HEIGHT);
-  _writeCommand(0x10);
   _startTransfer();
+  _transferCommand(0x10);
   for (uint32_t i = 0; i < uint32_t(WIDTH) * uint32_t(HEIGHT) / 8; i++)
   {
     _send8pixel(~black_value, ~color_value);
@@ -59,12 +56,9 @@ void GxEPD2_583c::writeScreenBuffer(uint8_t value)
   _Init_Part();
   _writeCommand(0x91); // partial in
   _setPartialRamArea(0, 0, WIDTH, HEIGHT);
-  _writeCommand(0x10);
   _startTransfer();
-  for (uint32_t i = 0; i < uint32_t(WIDTH) * uint32_t(HEIGHT) / 2; i++)
-  {
-    _transfer(value);
-  }
+  _transferCommand(0x10);
+  _transferFill(value, uint32_t(WIDTH) * uint32_t(HEIGHT) / 2);
   _endTransfer();
   _writeCommand(0x92); // partial out
 }
@@ -75,8 +69,8 @@ void GxEPD2_583c::writeScreenBuffer(uint8_t black_value, uint8_t color_value)
   _Init_Part();
   _writeCommand(0x91); // partial in
   _setPartialRamArea(0, 0, WIDTH, HEIGHT);
-  _writeCommand(0x10);
   _startTransfer();
+  _transferCommand(0x10);
   for (uint32_t i = 0; uint32_t(WIDTH) * uint32_t(HEIGHT) / 8; i++)
   {
     _send8pixel(~black_value, ~color_value);
@@ -109,8 +103,8 @@ void GxEPD2_583c::writeImage(const uint8_t* black, const uint8_t* color, int16_t
   _Init_Part();
   _writeCommand(0x91); // partial in
   _setPartialRamArea(x1, y1, w1, h1);
-  _writeCommand(0x10);
   _startTransfer();
+  _transferCommand(0x10);
   for (int16_t i = 0; i < h1; i++)
   {
     for (int16_t j = 0; j < w1 / 8; j++)
@@ -196,8 +190,8 @@ void GxEPD2_583c::writeImagePart(const uint8_t* black, const uint8_t* color, int
   if (!_using_partial_mode) _Init_Part();
   _writeCommand(0x91); // partial in
   _setPartialRamArea(x1, y1, w1, h1);
-  _writeCommand(0x10);
   _startTransfer();
+  _transferCommand(0x10);
   for (int16_t i = 0; i < h1; i++)
   {
     for (int16_t j = 0; j < w1 / 8; j++)
@@ -270,30 +264,13 @@ void GxEPD2_583c::writeNative(const uint8_t* data1, const uint8_t* data2, int16_
     _Init_Part();
     _writeCommand(0x91); // partial in
     _setPartialRamArea(x1, y1, w1, h1);
-    _writeCommand(0x10);
     _startTransfer();
+    _transferCommand(0x10);
     for (int16_t i = 0; i < h1; i++)
     {
-      for (int16_t j = 0; j < w1 / 2; j++)
-      {
-        uint8_t data;
-        // use wb, h of bitmap for index!
-        uint16_t idx = mirror_y ? j + dx / 2 + uint16_t((h - 1 - (i + dy))) * wb : j + dx / 2 + uint16_t(i + dy) * wb;
-        if (pgm)
-        {
-#if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-          data = pgm_read_byte(&data1[idx]);
-#else
-          data = data1[idx];
-#endif
-        }
-        else
-        {
-          data = data1[idx];
-        }
-        if (invert) data = ~data;
-        _transfer(data);
-      }
+      // use wb, h of bitmap for index!
+      uint16_t idx = mirror_y ? dx / 2 + uint16_t((h - 1 - (i + dy))) * wb : dx / 2 + uint16_t(i + dy) * wb;
+      _transferBytes(&data1[idx], w1 / 2, invert, pgm);
     }
     _endTransfer();
     _writeCommand(0x92); // partial out
@@ -369,8 +346,10 @@ void GxEPD2_583c::hibernate()
   if (_rst >= 0)
   {
     // check if it supports this command!
-    _writeCommand(0x07); // deep sleep
-    _writeData(0xA5);    // check code
+    _startTransfer();
+    _transferCommand(0x07); // deep sleep
+    _transfer(0xA5);     // check code
+    _endTransfer();
     _hibernating = true;
   }
 }
@@ -402,17 +381,19 @@ void GxEPD2_583c::_setPartialRamArea(uint16_t x, uint16_t y, uint16_t w, uint16_
   uint16_t ye = y + h - 1;
   x &= 0xFFF8; // byte boundary
   xe |= 0x0007; // byte boundary
-  _writeCommand(0x90); // partial window
-  _writeData(x / 256);
-  _writeData(x % 256);
-  _writeData(xe / 256);
-  _writeData(xe % 256);
-  _writeData(y / 256);
-  _writeData(y % 256);
-  _writeData(ye / 256);
-  _writeData(ye % 256);
+  _startTransfer();
+  _transferCommand(0x90); // partial window
+  _transfer(x / 256);
+  _transfer(x % 256);
+  _transfer(xe / 256);
+  _transfer(xe % 256);
+  _transfer(y / 256);
+  _transfer(y % 256);
+  _transfer(ye / 256);
+  _transfer(ye % 256);
   //_writeData(0x01); // distortion on full right half
-  _writeData(0x00); // distortion on right half
+  _transfer(0x00);  // distortion on right half
+  _endTransfer();
 }
 
 void GxEPD2_583c::_PowerOn()
@@ -438,34 +419,36 @@ void GxEPD2_583c::_PowerOff()
 void GxEPD2_583c::_InitDisplay()
 {
   if (_hibernating) _reset();
-  _writeCommand(0x01);
-  _writeData (0x37); //POWER SETTING
-  _writeData (0x00);
-  _writeCommand(0X00); //PANNEL SETTING
-  _writeData(0xCF);
-  _writeData(0x08);
-  _writeCommand(0x06); //boost
-  _writeData (0xc7);
-  _writeData (0xcc);
-  _writeData (0x28);
-  _writeCommand(0x30); //PLL setting
+  _startTransfer();
+  _transferCommand(0x01);
+  _transfer(0x37);   //POWER SETTING
+  _transfer(0x00);
+  _transferCommand(0X00); //PANNEL SETTING
+  _transfer(0xCF);
+  _transfer(0x08);
+  _transferCommand(0x06); //boost
+  _transfer(0xc7);
+  _transfer(0xcc);
+  _transfer(0x28);
+  _transferCommand(0x30); //PLL setting
   //_writeData (0x3a);   //PLL:    0-15��:0x3C, 15+:0x3A
-  _writeData (0x3c); //PLL:    0-15��:0x3C, 15+:0x3A
-  _writeCommand(0X41); //TEMPERATURE SETTING
-  _writeData(0x00);
-  _writeCommand(0X50); //VCOM AND DATA INTERVAL SETTING
-  _writeData(0x77);
-  _writeCommand(0X60); //TCON SETTING
-  _writeData(0x22);
-  _writeCommand(0x61); //600*448
-  _writeData (0x02);   //source 600
-  _writeData (0x58);
-  _writeData (0x01);   //gate 448
-  _writeData (0xc0);
-  _writeCommand(0X82); //VCOM VOLTAGE SETTING
-  _writeData(0x28);    //all temperature  range
-  _writeCommand(0xe5); //FLASH MODE
-  _writeData(0x03);
+  _transfer(0x3c);   //PLL:    0-15��:0x3C, 15+:0x3A
+  _transferCommand(0X41); //TEMPERATURE SETTING
+  _transfer(0x00);
+  _transferCommand(0X50); //VCOM AND DATA INTERVAL SETTING
+  _transfer(0x77);
+  _transferCommand(0X60); //TCON SETTING
+  _transfer(0x22);
+  _transferCommand(0x61); //600*448
+  _transfer(0x02);     //source 600
+  _transfer(0x58);
+  _transfer(0x01);     //gate 448
+  _transfer(0xc0);
+  _transferCommand(0X82); //VCOM VOLTAGE SETTING
+  _transfer(0x28);     //all temperature  range
+  _transferCommand(0xe5); //FLASH MODE
+  _transfer(0x03);
+  _endTransfer();
 }
 
 void GxEPD2_583c::_Init_Full()
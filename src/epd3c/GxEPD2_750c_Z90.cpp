@@ -39,19 +39,11 @@ void GxEPD2_750c_Z90::writeScreenBuffer(uint8_t black_value, uint8_t color_value
   _initial_write = false; // initial full screen buffer clean done
   _Init_Full();
   _setPartialRamArea(0, 0, WIDTH, HEIGHT);
-  _writeCommand(0x24);
   _startTransfer();
-  for (uint32_t i = 0; i < uint32_t(WIDTH) * uint32_t(HEIGHT) / 8; i++)
-  {
-    _transfer(black_value);
-  }
-  _endTransfer();
-  _writeCommand(0x26);
-  _startTransfer();
-  for (uint32_t i = 0; i < uint32_t(WIDTH) * uint32_t(HEIGHT) / 8; i++)
-  {
-    _transfer(~color_value);
-  }
+  _transferCommand(0x24);
+  _transferFill(black_value, uint32_t(WIDTH) * uint32_t(HEIGHT) / 8);
+  _transferCommand(0x26);
+  _transferFill(~color_value, uint32_t(WIDTH) * uint32_t(HEIGHT) / 8);
   _endTransfer();
 }
 
@@ -78,62 +70,28 @@ void GxEPD2_750c_Z90::writeImage(const uint8_t* black, const uint8_t* color, int
   if ((w1 <= 0) || (h1 <= 0)) return;
   _Init_Part();
   _setPartialRamArea(x1, y1, w1, h1);
-  _writeCommand(0x24);
   _startTransfer();
+  _transferCommand(0x24);
   for (int16_t i = 0; i < h1; i++)
   {
-    for (int16_t j = 0; j < w1 / 8; j++)
+    if (black)
     {
-      uint8_t data = 0xFF;
-      if (black)
-      {
-        // use wb, h of bitmap for index!
-        uint16_t idx = mirror_y ? j + dx / 8 + uint16_t((h - 1 - (i + dy))) * wb : j + dx / 8 + uint16_t(i + dy) * wb;
-        if (pgm)
-        {
-#if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-          data = pgm_read_byte(&black[idx]);
-#else
-          data = black[idx];
-#endif
-        }
-        else
-        {
-          data = black[idx];
-        }
-        if (invert) data = ~data;
-      }
-      _transfer(data);
+      // use wb, h of bitmap for index!
+      uint16_t idx = mirror_y ? dx / 8 + uint16_t((h - 1 - (i + dy))) * wb : dx / 8 + uint16_t(i + dy) * wb;
+      _transferBytes(&black[idx], w1 / 8, invert, pgm);
     }
+    else _transferFill(0xFF, w1 / 8);
   }
-  _endTransfer();
-  _writeCommand(0x26);
-  _startTransfer();
+  _transferCommand(0x26);
   for (int16_t i = 0; i < h1; i++)
   {
-    for (int16_t j = 0; j < w1 / 8; j++)
+    if (color)
     {
-      uint8_t data = 0xFF;
-      if (color)
-      {
-        // use wb, h of bitmap for index!
-        uint16_t idx = mirror_y ? j + dx / 8 + uint16_t((h - 1 - (i + dy))) * wb : j + dx / 8 + uint16_t(i + dy) * wb;
-        if (pgm)
-        {
-#if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-          data = pgm_read_byte(&color[idx]);
-#else
-          data = color[idx];
-#endif
-        }
-        else
-        {
-          data = color[idx];
-        }
-        if (invert) data = ~data;
-      }
-      _transfer(~data);
+      // use wb, h of bitmap for index!
+      uint16_t idx = mirror_y ? dx / 8 + uint16_t((h - 1 - (i + dy))) * wb : dx / 8 + uint16_t(i + dy) * wb;
+      _transferBytes(&color[idx], w1 / 8, !invert, pgm);
     }
+    else _transferFill(0x00, w1 / 8);
   }
   _endTransfer();
   delay(1); // yield() to avoid WDT on ESP8266 and ESP32
@@ -170,59 +128,24 @@ void GxEPD2_750c_Z90::writeImagePart(const uint8_t* black, const uint8_t* color,
   if ((w1 <= 0) || (h1 <= 0)) return;
   if (!_using_partial_mode) _Init_Part();
   _setPartialRamArea(x1, y1, w1, h1);
-  _writeCommand(0x24);
   _startTransfer();
+  _transferCommand(0x24);
   for (int16_t i = 0; i < h1; i++)
   {
-    for (int16_t j = 0; j < w1 / 8; j++)
-    {
-      uint8_t data;
-      // use wb_bitmap, h_bitmap of bitmap for index!
-      uint16_t idx = mirror_y ? x_part / 8 + j + dx / 8 + uint16_t((h_bitmap - 1 - (y_part + i + dy))) * wb_bitmap : x_part / 8 + j + dx / 8 + uint16_t(y_part + i + dy) * wb_bitmap;
-      if (pgm)
-      {
-#if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-        data = pgm_read_byte(&black[idx]);
-#else
-        data = black[idx];
-#endif
-      }
-      else
-      {
-        data = black[idx];
-      }
-      if (invert) data = ~data;
-      _transfer(data);
-    }
+    // use wb_bitmap, h_bitmap of bitmap for index!
+    uint16_t idx = mirror_y ? x_part / 8 + dx / 8 + uint16_t((h_bitmap - 1 - (y_part + i + dy))) * wb_bitmap : x_part / 8 + dx / 8 + uint16_t(y_part + i + dy) * wb_bitmap;
+    _transferBytes(&black[idx], w1 / 8, invert, pgm);
   }
-  _endTransfer();
-  _writeCommand(0x26);
-  _startTransfer();
+  _transferCommand(0x26);
   for (int16_t i = 0; i < h1; i++)
   {
-    for (int16_t j = 0; j < w1 / 8; j++)
+    if (color)
     {
-      uint8_t data = 0xFF;
-      if (color)
-      {
-        // use wb_bitmap, h_bitmap of bitmap for index!
-        uint16_t idx = mirror_y ? x_part / 8 + j + dx / 8 + uint16_t((h_bitmap - 1 - (y_part + i + dy))) * wb_bitmap : x_part / 8 + j + dx / 8 + uint16_t(y_part + i + dy) * wb_bitmap;
-        if (pgm)
-        {
-#if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-          data = pgm_read_byte(&color[idx]);
-#else
-          data = color[idx];
-#endif
-        }
-        else
-        {
-          data = color[idx];
-        }
-        if (invert) data = ~data;
-      }
-      _transfer(~data);
+      // use wb_bitmap, h_bitmap of bitmap for index!
+      uint16_t idx = mirror_y ? x_part / 8 + dx / 8 + uint16_t((h_bitmap - 1 - (y_part + i + dy))) * wb_bitmap : x_part / 8 + dx / 8 + uint16_t(y_part + i + dy) * wb_bitmap;
+      _transferBytes(&color[idx], w1 / 8, !invert, pgm);
     }
+    else _transferFill(0x00, w1 / 8);
   }
   _endTransfer();
   delay(1); // yield() to avoid WDT on ESP8266 and ESP32
@@ -289,8 +212,10 @@ void GxEPD2_750c_Z90::hibernate()
   _PowerOff();
   if (_rst >= 0)
   {
-    _writeCommand(0x10); // deep sleep
-    _writeData(0x11);    // deep sleep
+    _startTransfer();
+    _transferCommand(0x10); // deep sleep
+    _transfer(0x11);     // deep sleep
+    _endTransfer();
     _hibernating = true;
   }
 }
@@ -298,8 +223,10 @@ void GxEPD2_750c_Z90::hibernate()
 void GxEPD2_750c_Z90::_setPartialRamArea(uint16_t x, uint16_t y, uint16_t w, uint16_t h)
 {
   //Serial.print("_setPartialRamArea("); Serial.print(x); Serial.print(", "); Serial.print(y); Serial.print(", "); Serial.print(w); Serial.print(", "); Serial.print(h); Serial.println(")");
-  _writeCommand(0x11);  // Data entry mode
-  _writeData(entry_mode & 0x03);
+  _startTransfer();
+  _transferCommand(0x11); // Data entry mode
+  _transfer(entry_mode & 0x03);
+  _endTransfer();
   switch (entry_mode & 0x03)
   {
     case 0x00: // x decrement, y decrement
@@ -323,36 +250,42 @@ void GxEPD2_750c_Z90::_setPartialRamArea(uint16_t x, uint16_t y, uint16_t w, uin
 void GxEPD2_750c_Z90::_setRamArea(uint16_t xs, uint16_t xe, uint16_t ys, uint16_t ye)
 {
   //Serial.print("_setRamArea("); Serial.print(xs); Serial.print(", "); Serial.print(ys); Serial.print(", "); Serial.print(xe); Serial.print(", "); Serial.print(ye); Serial.println(")");
-  _writeCommand(0x44); // Set RAM X address Start/End position
-  _writeData(xs % 256);
-  _writeData(xs / 256);
-  _writeData(xe % 256);
-  _writeData(xe / 256);
-  _writeCommand(0x45); // Set RAM Y address Start/End position
-  _writeData(ys % 256);
-  _writeData(ys / 256);
-  _writeData(ye % 256);
-  _writeData(ye / 256);
+  _startTransfer();
+  _transferCommand(0x44); // Set RAM X address Start/End position
+  _transfer(xs % 256);
+  _transfer(xs / 256);
+  _transfer(xe % 256);
+  _transfer(xe / 256);
+  _transferCommand(0x45); // Set RAM Y address Start/End position
+  _transfer(ys % 256);
+  _transfer(ys / 256);
+  _transfer(ye % 256);
+  _transfer(ye / 256);
+  _endTransfer();
 }
 
 void GxEPD2_750c_Z90::_setRamPointer(uint16_t xs, uint16_t ys)
 {
   //Serial.print("_setRamPointer("); Serial.print(xs); Serial.print(", "); Serial.print(ys); Serial.println(")");
-  _writeCommand(0x4E); // Set RAM X Address Counter
-  _writeData(xs % 256);
-  _writeData(xs / 256);
-  _writeCommand(0x4F); // Set RAM Y Address Counter
-  _writeData(ys % 256);
-  _writeData(ys / 256);
+  _startTransfer();
+  _transferCommand(0x4E); // Set RAM X Address Counter
+  _transfer(xs % 256);
+  _transfer(xs / 256);
+  _transferCommand(0x4F); // Set RAM Y Address Counter
+  _transfer(ys % 256);
+  _transfer(ys / 256);
+  _endTransfer();
 }
 
 void GxEPD2_750c_Z90::_PowerOn()
 {
   if (!_power_is_on)
   {
-    _writeCommand(0x22);
-    _writeData(0xc0);
-    _writeCommand(0x20);
+    _startTransfer();
+    _transferCommand(0x22);
+    _transfer(0xc0);
+    _transferCommand(0x20);
+    _endTransfer();
     _waitWhileBusy("_PowerOn", power_on_time);
   }
   _power_is_on = true;
@@ -362,9 +295,11 @@ void GxEPD2_750c_Z90::_PowerOff()
 {
   if (_power_is_on)
   {
-    _writeCommand(0x22);
-    _writeData(0xc3);
-    _writeCommand(0x20);
+    _startTransfer();
+    _transferCommand(0x22);
+    _transfer(0xc3);
+    _transferCommand(0x20);
+    _endTransfer();
     _waitWhileBusy("_PowerOff", power_off_time);
   }
   _power_is_on = false;
@@ -376,24 +311,28 @@ void GxEPD2_750c_Z90::_InitDisplay()
   if (_hibernating) _reset();
   _writeCommand(0x12); //SWRESET
   _waitWhileBusy(0, power_on_time);
-  _writeCommand(0x0C); // Soft start setting
-  _writeData(0xAE);
-  _writeData(0xC7);
-  _writeData(0xC3);
-  _writeData(0xC0);
-  _writeData(0x40);
-  _writeCommand(0x01); // Set MUX as 527
-  _writeData(0x0F);
-  _writeData(0x02);
-  _writeData(0x00);
+  _startTransfer();
+  _transferCommand(0x0C); // Soft start setting
+  _transfer(0xAE);
+  _transfer(0xC7);
+  _transfer(0xC3);
+  _transfer(0xC0);
+  _transfer(0x40);
+  _transferCommand(0x01); // Set MUX as 527
+  _transfer(0x0F);
+  _transfer(0x02);
+  _transfer(0x00);
+  _endTransfer();
   _setPartialRamArea(0, 0, WIDTH, HEIGHT);
-  _writeCommand(0x3C); // VBD
-  _writeData(0x01);    // LUT1, for white
-  _writeCommand(0x18); // Temperature Sensor Selection
-  _writeData(0x80);    // internal temperature sensor
-  _writeCommand(0x22); // Display Update Sequence Options
-  _writeData(0xB1);    // Load Temperature and waveform setting.
-  _writeCommand(0x20); // Master Activation
+  _startTransfer();
+  _transferCommand(0x3C); // VBD
+  _transfer(0x01);     // LUT1, for white
+  _transferCommand(0x18); // Temperature Sensor Selection
+  _transfer(0x80);     // internal temperature sensor
+  _transferCommand(0x22); // Display Update Sequence Options
+  _transfer(0xB1);     // Load Temperature and waveform setting.
+  _transferCommand(0x20); // Master Activation
+  _endTransfer();
   _waitWhileBusy(0, power_on_time);
 }
 
@@ -409,18 +348,22 @@ void GxEPD2_750c_Z90::_Init_Part()
 
 void GxEPD2_750c_Z90::_Update_Full()
 {
-  _writeCommand(0x22); // Display Update Sequence Options
-  _writeData(0xC7);    //
-  _writeCommand(0x20); // Master Activation
+  _startTransfer();
+  _transferCommand(0x22); // Display Update Sequence Options
+  _transfer(0xC7);     //
+  _transferCommand(0x20); // Master Activation
+  _endTransfer();
   _waitWhileBusy("_Update_Full", full_refresh_time);
   _power_is_on = false;
 }
 
 void GxEPD2_750c_Z90::_Update_Part()
 {
-  _writeCommand(0x22); // Display Update Sequence Options
-  _writeData(0xC7);    //
-  _writeCommand(0x20); // Master Activation
+  _startTransfer();
+  _transferCommand(0x22); // Display Update Sequence Options
+  _transfer(0xC7);     //
+  _transferCommand(0x20); // Master Activation
+  _endTransfer();
   _waitWhileBusy("_Update_Part", partial_refresh_time);
   _power_is_on = false;
 }
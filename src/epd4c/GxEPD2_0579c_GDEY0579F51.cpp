@@ -47,18 +47,12 @@ void GxEPD2_0579c_GDEY0579F51::writeScreenBuffer(uint8_t black_value, uint8_t co
   _setPartialRamAreaMaster(0, 0, WIDTH / 2, HEIGHT, false);
   _writeCommand(0x10);
   _startTransfer();
-  for (uint32_t i = 0; i < uint32_t(WIDTH / 2) * uint32_t(HEIGHT) / 4; i++)
-  {
-    _transfer(0xFF == black_value ? 0x55 : 0x00);
-  }
+  _transferFill(0xFF == black_value ? 0x55 : 0x00, uint32_t(WIDTH / 2) * uint32_t(HEIGHT) / 4);
   _endTransfer();
   _setPartialRamAreaSlave(0, 0, WIDTH / 2, HEIGHT, false);
   _writeCommand(0x10);
   _startTransfer();
-  for (uint32_t i = 0; i < uint32_t(WIDTH / 2) * uint32_t(HEIGHT) / 4; i++)
-  {
-    _transfer(0xFF == black_value ? 0x55 : 0x00);
-  }
+  _transferFill(0xFF == black_value ? 0x55 : 0x00, uint32_t(WIDTH / 2) * uint32_t(HEIGHT) / 4);
   _endTransfer();
   _initial_write = false; // initial full screen buffer clean done
 }
@@ -41,10 +41,7 @@ void GxEPD2_1160c_GDEY116F51::writeScreenBuffer(uint8_t black_value, uint8_t col
   if (!_init_display_done) _InitDisplay();
   _writeCommand(0x10);
   _startTransfer();
-  for (uint32_t i = 0; i < uint32_t(WIDTH) * uint32_t(HEIGHT) / 4; i++)
-  {
-    _transfer(0xFF == black_value ? 0x55 : 0x00);
-  }
+  _transferFill(0xFF == black_value ? 0x55 : 0x00, uint32_t(WIDTH) * uint32_t(HEIGHT) / 4);
   _endTransfer();
   _initial_write = false; // initial full screen buffer clean done
 }
@@ -628,10 +625,10 @@ void GxEPD2_1160c_GDEY116F51::writeNative(const uint8_t* data1, const uint8_t* d
     {
       //Serial.println("paged");
       _startTransfer();
-      for (uint32_t i = 0; i < uint32_t(WIDTH) * uint32_t(h) / 4; i++)
+      uint32_t n = uint32_t(WIDTH) * uint32_t(h) / 4;
+      for (uint32_t i = 0; i < n; i += 0x8000) // in chunks for the 16 bit count of _transferBytes()
       {
-        uint8_t data = data1[i];
-        _transfer(data);
+        _transferBytes(&data1[i], n - i < 0x8000 ? n - i : 0x8000);
       }
       _endTransfer();
       if (y + h == HEIGHT) // last page
@@ -43,12 +43,9 @@ void GxEPD2_1020_GDEM102T91::_writeScreenBuffer(uint8_t command, uint8_t value)
 {
   if (!_init_display_done) _InitDisplay();
   _setPartialRamArea(0, 0, WIDTH, HEIGHT);
-  _writeCommand(command);
   _startTransfer();
-  for (uint32_t i = 0; i < uint32_t(WIDTH) * uint32_t(HEIGHT) / 8; i++)
-  {
-    _transfer(value);
-  }
+  _transferCommand(command);
+  _transferFill(value, uint32_t(WIDTH) * uint32_t(HEIGHT) / 8);
   _endTransfer();
 }
 
@@ -88,30 +85,13 @@ void GxEPD2_1020_GDEM102T91::_writeImage(uint8_t command, const uint8_t bitmap[]
   if (!_init_display_done) _InitDisplay();
   if (_initial_write) writeScreenBuffer(); // initial full screen buffer clean
   _setPartialRamArea(x1, y1, w1, h1);
-  _writeCommand(command);
   _startTransfer();
+  _transferCommand(command);
   for (int16_t i = 0; i < h1; i++)
   {
-    for (int16_t j = 0; j < w1 / 8; j++)
-    {
-      uint8_t data;
-      // use wb, h of bitmap for index!
-      uint32_t idx = mirror_y ? j + dx / 8 + uint32_t((h - 1 - (i + dy))) * wb : j + dx / 8 + uint32_t(i + dy) * wb;
-      if (pgm)
-      {
-#if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-        data = pgm_read_byte(&bitmap[idx]);
-#else
-        data = bitmap[idx];
-#endif
-      }
-      else
-      {
-        data = bitmap[idx];
-      }
-      if (invert) data = ~data;
-      _transfer(data);
-    }
+    // use wb, h of bitmap for index!
+    uint32_t idx = mirror_y ? dx / 8 + uint32_t((h - 1 - (i + dy))) * wb : dx / 8 + uint32_t(i + dy) * wb;
+    _transferBytes(&bitmap[idx], w1 / 8, invert, pgm);
   }
   _endTransfer();
   delay(1); // yield() to avoid WDT on ESP8266 and ESP32
@@ -155,30 +135,13 @@ void GxEPD2_1020_GDEM102T91::_writeImagePart(uint8_t command, const uint8_t bitm
   if (!_init_display_done) _InitDisplay();
   if (_initial_write) writeScreenBuffer(); // initial full screen buffer clean
   _setPartialRamArea(x1, y1, w1, h1);
-  _writeCommand(command);
   _startTransfer();
+  _transferCommand(command);
   for (int16_t i = 0; i < h1; i++)
   {
-    for (int16_t j = 0; j < w1 / 8; j++)
-    {
-      uint8_t data;
-      // use wb_bitmap, h_bitmap of bitmap for index!
-      uint32_t idx = mirror_y ? x_part / 8 + j + dx / 8 + uint32_t((h_bitmap - 1 - (y_part + i + dy))) * wb_bitmap : x_part / 8 + j + dx / 8 + uint32_t(y_part + i + dy) * wb_bitmap;
-      if (pgm)
-      {
-#if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-        data = pgm_read_byte(&bitmap[idx]);
-#else
-        data = bitmap[idx];
-#endif
-      }
-      else
-      {
-        data = bitmap[idx];
-      }
-      if (invert) data = ~data;
-      _transfer(data);
-    }
+    // use wb_bitmap, h_bitmap of bitmap for index!
+    uint32_t idx = mirror_y ? x_part / 8 + dx / 8 + uint32_t((h_bitmap - 1 - (y_part + i + dy))) * wb_bitmap : x_part / 8 + dx / 8 + uint32_t(y_part + i + dy) * wb_bitmap;
+    _transferBytes(&bitmap[idx], w1 / 8, invert, pgm);
   }
   _endTransfer();
   delay(1); // yield() to avoid WDT on ESP8266 and ESP32
@@ -288,8 +251,10 @@ void GxEPD2_1020_GDEM102T91::hibernate()
   _PowerOff();
   if (_rst >= 0)
   {
-    _writeCommand(0x10); // deep sleep mode
-    _writeData(0x3);     // enter deep sleep
+    _startTransfer();
+    _transferCommand(0x10); // deep sleep mode
+    _transfer(0x3);      // enter deep sleep
+    _endTransfer();
     _hibernating = true;
     _init_display_done = false;
   }
@@ -297,33 +262,37 @@ void GxEPD2_1020_GDEM102T91::hibernate()
 
 void GxEPD2_1020_GDEM102T91::_setPartialRamArea(uint16_t x, uint16_t y, uint16_t w, uint16_t h)
 {
-  _writeCommand(0x11); // set ram entry mode
-  _writeData(0x03);    // x increase, y increase : normal mode
-  _writeCommand(0x44);
-  _writeData(x % 256);
-  _writeData(x / 256);
-  _writeData((x + w - 1) % 256);
-  _writeData((x + w - 1) / 256);
-  _writeCommand(0x45);
-  _writeData(y % 256);
-  _writeData(y / 256);
-  _writeData((y + h - 1) % 256);
-  _writeData((y + h - 1) / 256);
-  _writeCommand(0x4e);
-  _writeData(x % 256);
-  _writeData(x / 256);
-  _writeCommand(0x4f);
-  _writeData(y % 256);
-  _writeData(y / 256);
+  _startTransfer();
+  _transferCommand(0x11); // set ram entry mode
+  _transfer(0x03);     // x increase, y increase : normal mode
+  _transferCommand(0x44);
+  _transfer(x % 256);
+  _transfer(x / 256);
+  _transfer((x + w - 1) % 256);
+  _transfer((x + w - 1) / 256);
+  _transferCommand(0x45);
+  _transfer(y % 256);
+  _transfer(y / 256);
+  _transfer((y + h - 1) % 256);
+  _transfer((y + h - 1) / 256);
+  _transferCommand(0x4e);
+  _transfer(x % 256);
+  _transfer(x / 256);
+  _transferCommand(0x4f);
+  _transfer(y % 256);
+  _transfer(y / 256);
+  _endTransfer();
 }
 
 void GxEPD2_1020_GDEM102T91::_PowerOn()
 {
   if (!_power_is_on)
   {
-    _writeCommand(0x22);
-    _writeData(0xc0);
-    _writeCommand(0x20);
+    _startTransfer();
+    _transferCommand(0x22);
+    _transfer(0xc0);
+    _transferCommand(0x20);
+    _endTransfer();
     _waitWhileBusy("_PowerOn", power_on_time);
   }
   _power_is_on = true;
@@ -333,9 +302,11 @@ void GxEPD2_1020_GDEM102T91::_PowerOff()
 {
   if (_power_is_on)
   {
-    _writeCommand(0x22);
-    _writeData(0x83);
-    _writeCommand(0x20);
+    _startTransfer();
+    _transferCommand(0x22);
+    _transfer(0x83);
+    _transferCommand(0x20);
+    _endTransfer();
     _waitWhileBusy("_PowerOff", power_off_time);
   }
   _power_is_on = false;
@@ -349,56 +320,68 @@ void GxEPD2_1020_GDEM102T91::_InitDisplay()
   _writeCommand(0x12);  //SWRESET
   delay(15); // 10ms according to specs
   //_waitWhileBusy("_InitDisplay", power_on_time);
-  _writeCommand(0x0C);  // Soft start setting
-  _writeData(0xAE);
-  _writeData(0xC7);
-  _writeData(0xC3);
-  _writeData(0xC0);
-  _writeData(0xFF);   //0x80 To 0xFF
-  _writeCommand(0x01);  // Set MUX as 527
-  _writeData(0x7F);
-  _writeData(0x02);
-  _writeData(0x00);
-      _writeCommand(0x11);  // Data entry mode
-      _writeData(0x01);
-      _writeCommand(0x44);
-      _writeData(0x00); // RAM x address start at 0
-      _writeData(0x00);
-      _writeData(0xBF); // RAM x address end at 36Fh -> 879
-      _writeData(0x03);
-      _writeCommand(0x45);
-      _writeData(0x7F); // RAM y address start at 20Fh;
-      _writeData(0x02);
-      _writeData(0x00); // RAM y address end at 00h;
-      _writeData(0x00);
-  _writeCommand(0x3C); // VBD
-  _writeData(0x01); // LUT1, for white
-  _writeCommand(0x18);
-  _writeData(0x80);
-      _writeCommand(0x4E); 
-      _writeData(0x00);
-      _writeData(0x00);
-      _writeCommand(0x4F); 
-      _writeData(0x7F);
-      _writeData(0x02);
+  _startTransfer();
+  _transferCommand(0x0C); // Soft start setting
+  _transfer(0xAE);
+  _transfer(0xC7);
+  _transfer(0xC3);
+  _transfer(0xC0);
+  _transfer(0xFF);    //0x80 To 0xFF
+  _transferCommand(0x01); // Set MUX as 527
+  _transfer(0x7F);
+  _transfer(0x02);
+  _transfer(0x00);
+  _endTransfer();
+      _startTransfer();
+      _transferCommand(0x11); // Data entry mode
+      _transfer(0x01);
+      _transferCommand(0x44);
+      _transfer(0x00);  // RAM x address start at 0
+      _transfer(0x00);
+      _transfer(0xBF);  // RAM x address end at 36Fh -> 879
+      _transfer(0x03);
+      _transferCommand(0x45);
+      _transfer(0x7F);  // RAM y address start at 20Fh;
+      _transfer(0x02);
+      _transfer(0x00);  // RAM y address end at 00h;
+      _transfer(0x00);
+      _endTransfer();
+  _startTransfer();
+  _transferCommand(0x3C); // VBD
+  _transfer(0x01);  // LUT1, for white
+  _transferCommand(0x18);
+  _transfer(0x80);
+  _endTransfer();
+      _startTransfer();
+      _transferCommand(0x4E);
+      _transfer(0x00);
+      _transfer(0x00);
+      _transferCommand(0x4F);
+      _transfer(0x7F);
+      _transfer(0x02);
+      _endTransfer();
   _setPartialRamArea(0, 0, WIDTH, HEIGHT);
   _init_display_done = true;
 }
 
 void GxEPD2_1020_GDEM102T91::_Update_Full()
 {
-  _writeCommand(0x22);
-  _writeData(0xf7);
-  _writeCommand(0x20);
+  _startTransfer();
+  _transferCommand(0x22);
+  _transfer(0xf7);
+  _transferCommand(0x20);
+  _endTransfer();
   _waitWhileBusy("_Update_Full", full_refresh_time);
   _power_is_on = false;
 }
 
 void GxEPD2_1020_GDEM102T91::_Update_Part()
 {
-  _writeCommand(0x22);
-  _writeData(hasFastPartialUpdate ? 0xfc : 0xf4);
-  _writeCommand(0x20);
+  _startTransfer();
+  _transferCommand(0x22);
+  _transfer(hasFastPartialUpdate ? 0xfc : 0xf4);
+  _transferCommand(0x20);
+  _endTransfer();
   _waitWhileBusy("_Update_Part", hasFastPartialUpdate ? partial_refresh_time : full_refresh_time);
   _power_is_on = true;
 }
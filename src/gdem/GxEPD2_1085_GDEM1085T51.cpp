@@ -67,17 +67,11 @@ void GxEPD2_1085_GDEM1085T51::_writeScreenBuffer(uint8_t command, uint8_t value)
   if (!_init_display_done) _InitDisplay();
   _writeCommandToMaster(command);
   _startTransferToMaster();
-  for (uint32_t i = 0; i < uint32_t(WIDTH / 2) * uint32_t(HEIGHT) / 8; i++)
-  {
-    _transfer(value);
-  }
+  _transferFill(value, uint32_t(WIDTH / 2) * uint32_t(HEIGHT) / 8);
   _endTransferToMaster();
   _writeCommandToSlave(command);
   _startTransferToSlave();
-  for (uint32_t i = 0; i < uint32_t(WIDTH / 2) * uint32_t(HEIGHT) / 8; i++)
-  {
-    _transfer(value);
-  }
+  _transferFill(value, uint32_t(WIDTH / 2) * uint32_t(HEIGHT) / 8);
   _endTransferToSlave();
 }
 
@@ -128,26 +122,9 @@ void GxEPD2_1085_GDEM1085T51::_writeImage(uint8_t command, const uint8_t bitmap[
     _startTransferToMaster();
     for (int16_t i = 0; i < h1; i++)
     {
-      for (int16_t j = 0; j < wm / 8; j++)
-      {
-        uint8_t data;
-        // use wb, h of bitmap for index!
-        int32_t idx = mirror_y ? j + dx / 8 + int32_t((h - 1 - (i + dy))) * wb : j + dx / 8 + int32_t(i + dy) * wb;
-        if (pgm)
-        {
-#if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-          data = pgm_read_byte(&bitmap[idx]);
-#else
-          data = bitmap[idx];
-#endif
-        }
-        else
-        {
-          data = bitmap[idx];
-        }
-        if (invert) data = ~data;
-        _transfer(data);
-      }
+      // use wb, h of bitmap for index!
+      int32_t idx = mirror_y ? dx / 8 + int32_t((h - 1 - (i + dy))) * wb : dx / 8 + int32_t(i + dy) * wb;
+      _transferBytes(&bitmap[idx], wm / 8, invert, pgm);
     }
     _endTransferToMaster();
     _writeCommandToMaster(0x92); // partial out
@@ -162,26 +139,9 @@ void GxEPD2_1085_GDEM1085T51::_writeImage(uint8_t command, const uint8_t bitmap[
     _startTransferToSlave();
     for (int16_t i = 0; i < h1; i++)
     {
-      for (int16_t j = 0; j < ws / 8; j++)
-      {
-        uint8_t data;
-        // use wb, h of bitmap for index!
-        int32_t idx = mirror_y ? (xs - x1) / 8 + j + int32_t((h - 1 - (i + dy))) * wb : (xs - x1) / 8 + j + int32_t(i + dy) * wb;
-        if (pgm)
-        {
-#if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-          data = pgm_read_byte(&bitmap[idx]);
-#else
-          data = bitmap[idx];
-#endif
-        }
-        else
-        {
-          data = bitmap[idx];
-        }
-        if (invert) data = ~data;
-        _transfer(data);
-      }
+      // use wb, h of bitmap for index!
+      int32_t idx = mirror_y ? (xs - x1) / 8 + int32_t((h - 1 - (i + dy))) * wb : (xs - x1) / 8 + int32_t(i + dy) * wb;
+      _transferBytes(&bitmap[idx], ws / 8, invert, pgm);
     }
     _endTransferToSlave();
     _writeCommandToSlave(0x92); // partial out
@@ -236,26 +196,9 @@ void GxEPD2_1085_GDEM1085T51::_writeImagePart(uint8_t command, const uint8_t bit
     _startTransferToMaster();
     for (int16_t i = 0; i < h1; i++)
     {
-      for (int16_t j = 0; j < wm / 8; j++)
-      {
-        uint8_t data;
-        // use wb_bitmap, h_bitmap of bitmap for index!
-        int32_t idx = mirror_y ? x_part / 8 + j + dx / 8 + int32_t((h_bitmap - 1 - (y_part + i + dy))) * wb_bitmap : x_part / 8 + j + dx / 8 + int32_t(y_part + i + dy) * wb_bitmap;
-        if (pgm)
-        {
-#if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-          data = pgm_read_byte(&bitmap[idx]);
-#else
-          data = bitmap[idx];
-#endif
-        }
-        else
-        {
-          data = bitmap[idx];
-        }
-        if (invert) data = ~data;
-        _transfer(data);
-      }
+      // use wb_bitmap, h_bitmap of bitmap for index!
+      int32_t idx = mirror_y ? x_part / 8 + dx / 8 + int32_t((h_bitmap - 1 - (y_part + i + dy))) * wb_bitmap : x_part / 8 + dx / 8 + int32_t(y_part + i + dy) * wb_bitmap;
+      _transferBytes(&bitmap[idx], wm / 8, invert, pgm);
     }
     _endTransferToMaster();
     _writeCommandToMaster(0x92); // partial out
@@ -270,26 +213,9 @@ void GxEPD2_1085_GDEM1085T51::_writeImagePart(uint8_t command, const uint8_t bit
     _startTransferToSlave();
     for (int16_t i = 0; i < h1; i++)
     {
-      for (int16_t j = 0; j < ws / 8; j++)
-      {
-        uint8_t data;
-        // use wb_bitmap, h_bitmap of bitmap for index!
-        int32_t idx = mirror_y ? x_part / 8 + (xs - x1) / 8 + j + dx / 8 + int32_t((h_bitmap - 1 - (y_part + i + dy))) * wb_bitmap : x_part / 8 + (xs - x1) / 8 + j + dx / 8 + int32_t(y_part + i + dy) * wb_bitmap;
-        if (pgm)
-        {
-#if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-          data = pgm_read_byte(&bitmap[idx]);
-#else
-          data = bitmap[idx];
-#endif
-        }
-        else
-        {
-          data = bitmap[idx];
-        }
-        if (invert) data = ~data;
-        _transfer(data);
-      }
+      // use wb_bitmap, h_bitmap of bitmap for index!
+      int32_t idx = mirror_y ? x_part / 8 + (xs - x1) / 8 + dx / 8 + int32_t((h_bitmap - 1 - (y_part + i + dy))) * wb_bitmap : x_part / 8 + (xs - x1) / 8 + dx / 8 + int32_t(y_part + i + dy) * wb_bitmap;
+      _transferBytes(&bitmap[idx], ws / 8, invert, pgm);
     }
     _endTransferToSlave();
     _writeCommandToSlave(0x92); // partial out
@@ -436,6 +362,7 @@ void GxEPD2_1085_GDEM1085T51::_writeCommandToMaster(uint8_t c)
 }
 void GxEPD2_1085_GDEM1085T51::_writeCommandToSlave(uint8_t c)
 {
+  _waitAsync();
   _pSPIx->beginTransaction(_spi_settings);
   if (_dc >= 0) digitalWrite(_dc, LOW);
   if (_cs2 >= 0) digitalWrite(_cs2, LOW);
@@ -446,6 +373,7 @@ void GxEPD2_1085_GDEM1085T51::_writeCommandToSlave(uint8_t c)
 }
 void GxEPD2_1085_GDEM1085T51::_writeCommandToBoth(uint8_t c)
 {
+  _waitAsync();
   _pSPIx->beginTransaction(_spi_settings);
   if (_dc >= 0) digitalWrite(_dc, LOW);
   if (_cs >= 0) digitalWrite(_cs, LOW);
@@ -462,6 +390,7 @@ void GxEPD2_1085_GDEM1085T51::_writeDataToMaster(uint8_t d)
 }
 void GxEPD2_1085_GDEM1085T51::_writeDataToSlave(uint8_t d)
 {
+  _waitAsync();
   _pSPIx->beginTransaction(_spi_settings);
   if (_cs >= 0) digitalWrite(_cs2, LOW);
   _pSPIx->transfer(d);
@@ -470,6 +399,7 @@ void GxEPD2_1085_GDEM1085T51::_writeDataToSlave(uint8_t d)
 }
 void GxEPD2_1085_GDEM1085T51::_writeDataToBoth(uint8_t d)
 {
+  _waitAsync();
   _pSPIx->beginTransaction(_spi_settings);
   if (_cs >= 0) digitalWrite(_cs, LOW);
   if (_cs >= 0) digitalWrite(_cs2, LOW);
@@ -484,6 +414,7 @@ void GxEPD2_1085_GDEM1085T51::_startTransferToMaster()
 }
 void GxEPD2_1085_GDEM1085T51::_startTransferToSlave()
 {
+  _waitAsync();
   _pSPIx->beginTransaction(_spi_settings);
   if (_cs >= 0) digitalWrite(_cs2, LOW);
 }
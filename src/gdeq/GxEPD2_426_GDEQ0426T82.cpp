@@ -43,12 +43,9 @@ void GxEPD2_426_GDEQ0426T82::_writeScreenBuffer(uint8_t command, uint8_t value)
 {
   if (!_init_display_done) _InitDisplay();
   _setPartialRamArea(0, 0, WIDTH, HEIGHT);
-  _writeCommand(command);
   _startTransfer();
-  for (uint32_t i = 0; i < uint32_t(WIDTH) * uint32_t(HEIGHT) / 8; i++)
-  {
-    _transfer(value);
-  }
+  _transferCommand(command);
+  _transferFill(value, uint32_t(WIDTH) * uint32_t(HEIGHT) / 8);
   _endTransfer();
 }
 
@@ -87,30 +84,13 @@ void GxEPD2_426_GDEQ0426T82::_writeImage(uint8_t command, const uint8_t bitmap[]
   if (!_init_display_done) _InitDisplay();
   if (_initial_write) writeScreenBuffer(); // initial full screen buffer clean
   _setPartialRamArea(x1, y1, w1, h1);
-  _writeCommand(command);
   _startTransfer();
+  _transferCommand(command);
   for (int16_t i = 0; i < h1; i++)
   {
-    for (int16_t j = 0; j < w1 / 8; j++)
-    {
-      uint8_t data;
-      // use wb, h of bitmap for index!
-      int32_t idx = mirror_y ? j + dx / 8 + ((h - 1 - int32_t(i + dy))) * wb : j + dx / 8 + int32_t(i + dy) * wb;
-      if (pgm)
-      {
-#if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-        data = pgm_read_byte(&bitmap[idx]);
-#else
-        data = bitmap[idx];
-#endif
-      }
-      else
-      {
-        data = bitmap[idx];
-      }
-      if (invert) data = ~data;
-      _transfer(data);
-    }
+    // use wb, h of bitmap for index!
+    int32_t idx = mirror_y ? dx / 8 + ((h - 1 - int32_t(i + dy))) * wb : dx / 8 + int32_t(i + dy) * wb;
+    _transferBytes(&bitmap[idx], w1 / 8, invert, pgm);
   }
   _endTransfer();
   delay(1); // yield() to avoid WDT on ESP8266 and ESP32
@@ -154,30 +134,13 @@ void GxEPD2_426_GDEQ0426T82::_writeImagePart(uint8_t command, const uint8_t bitm
   if (!_init_display_done) _InitDisplay();
   if (_initial_write) writeScreenBuffer(); // initial full screen buffer clean
   _setPartialRamArea(x1, y1, w1, h1);
-  _writeCommand(command);
   _startTransfer();
+  _transferCommand(command);
   for (int16_t i = 0; i < h1; i++)
   {
-    for (int16_t j = 0; j < w1 / 8; j++)
-    {
-      uint8_t data;
-      // use wb_bitmap, h_bitmap of bitmap for index!
-      int32_t idx = mirror_y ? x_part / 8 + j + dx / 8 + int32_t((h_bitmap - 1 - (y_part + i + dy))) * wb_bitmap : x_part / 8 + j + dx / 8 + int32_t(y_part + i + dy) * wb_bitmap;
-      if (pgm)
-      {
-#if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-        data = pgm_read_byte(&bitmap[idx]);
-#else
-        data = bitmap[idx];
-#endif
-      }
-      else
-      {
-        data = bitmap[idx];
-      }
-      if (invert) data = ~data;
-      _transfer(data);
-    }
+    // use wb_bitmap, h_bitmap of bitmap for index!
+    int32_t idx = mirror_y ? x_part / 8 + dx / 8 + int32_t((h_bitmap - 1 - (y_part + i + dy))) * wb_bitmap : x_part / 8 + dx / 8 + int32_t(y_part + i + dy) * wb_bitmap;
+    _transferBytes(&bitmap[idx], w1 / 8, invert, pgm);
   }
   _endTransfer();
   delay(1); // yield() to avoid WDT on ESP8266 and ESP32
@@ -287,8 +250,10 @@ void GxEPD2_426_GDEQ0426T82::hibernate()
   _PowerOff();
   if (_rst >= 0)
   {
-    _writeCommand(0x10); // deep sleep mode
-    _writeData(0x1);     // enter deep sleep
+    _startTransfer();
+    _transferCommand(0x10); // deep sleep mode
+    _transfer(0x1);      // enter deep sleep
+    _endTransfer();
     _hibernating = true;
     _init_display_done = false;
   }
@@ -301,33 +266,37 @@ void GxEPD2_426_GDEQ0426T82::_setPartialRamArea(uint16_t x, uint16_t y, uint16_t
   // gates are reversed on this display, but controller has no gates reverse scan
   // reverse data entry on y
   y = HEIGHT - y - h; // reversed partial window
-  _writeCommand(0x11); // set ram entry mode
-  _writeData(0x01);    // x increase, y decrease : y reversed
-  _writeCommand(0x44);
-  _writeData(x % 256);
-  _writeData(x / 256);
-  _writeData((x + w - 1) % 256);
-  _writeData((x + w - 1) / 256);
-  _writeCommand(0x45);
-  _writeData((y + h - 1) % 256);
-  _writeData((y + h - 1) / 256);
-  _writeData(y % 256);
-  _writeData(y / 256);
-  _writeCommand(0x4e);
-  _writeData(x % 256);
-  _writeData(x / 256);
-  _writeCommand(0x4f);
-  _writeData((y + h - 1) % 256);
-  _writeData((y + h - 1) / 256);
+  _startTransfer();
+  _transferCommand(0x11); // set ram entry mode
+  _transfer(0x01);     // x increase, y decrease : y reversed
+  _transferCommand(0x44);
+  _transfer(x % 256);
+  _transfer(x / 256);
+  _transfer((x + w - 1) % 256);
+  _transfer((x + w - 1) / 256);
+  _transferCommand(0x45);
+  _transfer((y + h - 1) % 256);
+  _transfer((y + h - 1) / 256);
+  _transfer(y % 256);
+  _transfer(y / 256);
+  _transferCommand(0x4e);
+  _transfer(x % 256);
+  _transfer(x / 256);
+  _transferCommand(0x4f);
+  _transfer((y + h - 1) % 256);
+  _transfer((y + h - 1) / 256);
+  _endTransfer();
 }
 
 void GxEPD2_426_GDEQ0426T82::_PowerOn()
 {
   if (!_power_is_on)
   {
-    _writeCommand(0x22);
-    _writeData(0xe0);
-    _writeCommand(0x20);
+    _startTransfer();
+    _transferCommand(0x22);
+    _transfer(0xe0);
+    _transferCommand(0x20);
+    _endTransfer();
     _waitWhileBusy("_PowerOn", power_on_time);
   }
   _power_is_on = true;
@@ -337,9 +306,11 @@ void GxEPD2_426_GDEQ0426T82::_PowerOff()
 {
   if (_power_is_on)
   {
-    _writeCommand(0x22);
-    _writeData(0x83);
-    _writeCommand(0x20);
+    _startTransfer();
+    _transferCommand(0x22);
+    _transfer(0x83);
+    _transferCommand(0x20);
+    _endTransfer();
     _waitWhileBusy("_PowerOff", power_off_time);
   }
   _power_is_on = false;
@@ -353,40 +324,48 @@ void GxEPD2_426_GDEQ0426T82::_InitDisplay()
   //_waitWhileBusy("_InitDisplay reset", power_on_time);
   _writeCommand(0x12);  //SWRESET
   delay(10); // 10ms according to specs
-  _writeCommand(0x18);
-  _writeData(0x80);
-  _writeCommand(0x0C);
-  _writeData(0xAE);
-  _writeData(0xC7);
-  _writeData(0xC3);
-  _writeData(0xC0);
-  _writeData(0x80);
-  _writeCommand(0x01); // Driver output control
-  _writeData((HEIGHT - 1) % 256); // gates A0..A7
-  _writeData((HEIGHT - 1) / 256); // gates A8, A9
-  _writeData(0x02); // SM (interlaced) ??
-  _writeCommand(0x3C); // BorderWavefrom
-  _writeData(0x01);
+  _startTransfer();
+  _transferCommand(0x18);
+  _transfer(0x80);
+  _transferCommand(0x0C);
+  _transfer(0xAE);
+  _transfer(0xC7);
+  _transfer(0xC3);
+  _transfer(0xC0);
+  _transfer(0x80);
+  _transferCommand(0x01); // Driver output control
+  _transfer((HEIGHT - 1) % 256);  // gates A0..A7
+  _transfer((HEIGHT - 1) / 256);  // gates A8, A9
+  _transfer(0x02);  // SM (interlaced) ??
+  _transferCommand(0x3C); // BorderWavefrom
+  _transfer(0x01);
+  _endTransfer();
   _setPartialRamArea(0, 0, WIDTH, HEIGHT);
   _init_display_done = true;
 }
 
 void GxEPD2_426_GDEQ0426T82::_Update_Full()
 {
-  _writeCommand(0x21); // Display Update Controll
-  _writeData(0x40);    // bypass RED as 0
-  _writeData(0x00);    // single chip application
+  _startTransfer();
+  _transferCommand(0x21); // Display Update Controll
+  _transfer(0x40);     // bypass RED as 0
+  _transfer(0x00);     // single chip application
+  _endTransfer();
   if (useFastFullUpdate)
   {
-    _writeCommand(0x1A); // Write to temperature register
-    _writeData(0x5A);
-    _writeCommand(0x22);
-    _writeData(0xd7);
+    _startTransfer();
+    _transferCommand(0x1A); // Write to temperature register
+    _transfer(0x5A);
+    _transferCommand(0x22);
+    _transfer(0xd7);
+    _endTransfer();
   }
   else
   {
-    _writeCommand(0x22);
-    _writeData(0xf7);
+    _startTransfer();
+    _transferCommand(0x22);
+    _transfer(0xf7);
+    _endTransfer();
   }
   _writeCommand(0x20);
   _waitWhileBusy("_Update_Full", full_refresh_time);
@@ -395,12 +374,14 @@ void GxEPD2_426_GDEQ0426T82::_Update_Full()
 
 void GxEPD2_426_GDEQ0426T82::_Update_Part()
 {
-  _writeCommand(0x21); // Display Update Controll
-  _writeData(0x00);    // RED normal
-  _writeData(0x00);    // single chip application
-  _writeCommand(0x22);
-  _writeData(0xfc);
-  _writeCommand(0x20);
+  _startTransfer();
+  _transferCommand(0x21); // Display Update Controll
+  _transfer(0x00);     // RED normal
+  _transfer(0x00);     // single chip application
+  _transferCommand(0x22);
+  _transfer(0xfc);
+  _transferCommand(0x20);
+  _endTransfer();
   _waitWhileBusy("_Update_Part", partial_refresh_time);
   _power_is_on = true;
 }
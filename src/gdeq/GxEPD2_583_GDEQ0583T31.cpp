@@ -35,12 +35,9 @@ void GxEPD2_583_GDEQ0583T31::writeScreenBuffer(uint8_t value)
 
 void GxEPD2_583_GDEQ0583T31::_writeScreenBuffer(uint8_t command, uint8_t value)
 {
-  _writeCommand(command);
   _startTransfer();
-  for (uint32_t i = 0; i < uint32_t(WIDTH) * uint32_t(HEIGHT) / 8; i++)
-  {
-    _transfer(value);
-  }
+  _transferCommand(command);
+  _transferFill(value, uint32_t(WIDTH) * uint32_t(HEIGHT) / 8);
   _endTransfer();
 }
 
@@ -74,30 +71,13 @@ void GxEPD2_583_GDEQ0583T31::_writeImage(uint8_t command, const uint8_t bitmap[]
   if (!_using_partial_mode) _Init_Part();
   _writeCommand(0x91); // partial in
   _setPartialRamArea(x1, y1, w1, h1);
-  _writeCommand(command);
   _startTransfer();
+  _transferCommand(command);
   for (int16_t i = 0; i < h1; i++)
   {
-    for (int16_t j = 0; j < w1 / 8; j++)
-    {
-      uint8_t data;
-      // use wb, h of bitmap for index!
-      uint16_t idx = mirror_y ? j + dx / 8 + uint16_t((h - 1 - (i + dy))) * wb : j + dx / 8 + uint16_t(i + dy) * wb;
-      if (pgm)
-      {
-#if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-        data = pgm_read_byte(&bitmap[idx]);
-#else
-        data = bitmap[idx];
-#endif
-      }
-      else
-      {
-        data = bitmap[idx];
-      }
-      if (invert) data = ~data;
-      _transfer(data);
-    }
+    // use wb, h of bitmap for index!
+    uint16_t idx = mirror_y ? dx / 8 + uint16_t((h - 1 - (i + dy))) * wb : dx / 8 + uint16_t(i + dy) * wb;
+    _transferBytes(&bitmap[idx], w1 / 8, invert, pgm);
   }
   _endTransfer();
   _writeCommand(0x92); // partial out
@@ -136,30 +116,13 @@ void GxEPD2_583_GDEQ0583T31::_writeImagePart(uint8_t command, const uint8_t bitm
   if (!_using_partial_mode) _Init_Part();
   _writeCommand(0x91); // partial in
   _setPartialRamArea(x1, y1, w1, h1);
-  _writeCommand(command);
   _startTransfer();
+  _transferCommand(command);
   for (int16_t i = 0; i < h1; i++)
   {
-    for (int16_t j = 0; j < w1 / 8; j++)
-    {
-      uint8_t data;
-      // use wb_bitmap, h_bitmap of bitmap for index!
-      uint16_t idx = mirror_y ? x_part / 8 + j + dx / 8 + uint16_t((h_bitmap - 1 - (y_part + i + dy))) * wb_bitmap : x_part / 8 + j + dx / 8 + uint16_t(y_part + i + dy) * wb_bitmap;
-      if (pgm)
-      {
-#if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-        data = pgm_read_byte(&bitmap[idx]);
-#else
-        data = bitmap[idx];
-#endif
-      }
-      else
-      {
-        data = bitmap[idx];
-      }
-      if (invert) data = ~data;
-      _transfer(data);
-    }
+    // use wb_bitmap, h_bitmap of bitmap for index!
+    uint16_t idx = mirror_y ? x_part / 8 + dx / 8 + uint16_t((h_bitmap - 1 - (y_part + i + dy))) * wb_bitmap : x_part / 8 + dx / 8 + uint16_t(y_part + i + dy) * wb_bitmap;
+    _transferBytes(&bitmap[idx], w1 / 8, invert, pgm);
   }
   _endTransfer();
   _writeCommand(0x92); // partial out
@@ -266,8 +229,10 @@ void GxEPD2_583_GDEQ0583T31::hibernate()
   _PowerOff();
   if (_rst >= 0)
   {
-    _writeCommand(0x07); // deep sleep
-    _writeData(0xA5);    // check code
+    _startTransfer();
+    _transferCommand(0x07); // deep sleep
+    _transfer(0xA5);     // check code
+    _endTransfer();
     _hibernating = true;
   }
 }
@@ -277,16 +242,18 @@ void GxEPD2_583_GDEQ0583T31::_setPartialRamArea(uint16_t x, uint16_t y, uint16_t
   uint16_t xe = (x + w - 1) | 0x0007; // byte boundary inclusive (last byte)
   uint16_t ye = y + h - 1;
   x &= 0xFFF8; // byte boundary
-  _writeCommand(0x90); // partial window
-  _writeData(x / 256);
-  _writeData(x % 256);
-  _writeData(xe / 256);
-  _writeData(xe % 256);
-  _writeData(y / 256);
-  _writeData(y % 256);
-  _writeData(ye / 256);
-  _writeData(ye % 256);
-  _writeData(0x01); // don't see any difference
+  _startTransfer();
+  _transferCommand(0x90); // partial window
+  _transfer(x / 256);
+  _transfer(x % 256);
+  _transfer(xe / 256);
+  _transfer(xe % 256);
+  _transfer(y / 256);
+  _transfer(y % 256);
+  _transfer(ye / 256);
+  _transfer(ye % 256);
+  _transfer(0x01);  // don't see any difference
+  _endTransfer();
   //_writeData(0x00); // don't see any difference
 }
 
@@ -314,11 +281,13 @@ void GxEPD2_583_GDEQ0583T31::_PowerOff()
 void GxEPD2_583_GDEQ0583T31::_InitDisplay()
 {
   if (_hibernating) _reset();
-  _writeCommand(0x00); // PANEL SETTING
-  _writeData(0x1f);    // KW: 3f, KWR: 2F, BWROTP: 0f, BWOTP: 1f
-  _writeCommand(0x50); // VCOM AND DATA INTERVAL SETTING
-  _writeData(0x29);
-  _writeData(0x07);
+  _startTransfer();
+  _transferCommand(0x00); // PANEL SETTING
+  _transfer(0x1f);     // KW: 3f, KWR: 2F, BWROTP: 0f, BWOTP: 1f
+  _transferCommand(0x50); // VCOM AND DATA INTERVAL SETTING
+  _transfer(0x29);
+  _transfer(0x07);
+  _endTransfer();
 }
 
 void GxEPD2_583_GDEQ0583T31::_Init_Full()
@@ -326,10 +295,12 @@ void GxEPD2_583_GDEQ0583T31::_Init_Full()
   _InitDisplay();
   if (useFastFullUpdate)
   {
-    _writeCommand(0xE0); // Cascade Setting (CCSET)
-    _writeData(0x02);    // TSFIX
-    _writeCommand(0xE5); // Force Temperature (TSSET)
-    _writeData(0x5A);    // 90
+    _startTransfer();
+    _transferCommand(0xE0); // Cascade Setting (CCSET)
+    _transfer(0x02);     // TSFIX
+    _transferCommand(0xE5); // Force Temperature (TSSET)
+    _transfer(0x5A);     // 90
+    _endTransfer();
   }
   _PowerOn();
   _using_partial_mode = false;
@@ -340,10 +311,12 @@ void GxEPD2_583_GDEQ0583T31::_Init_Part()
   _InitDisplay();
   if (hasFastPartialUpdate)
   {
-    _writeCommand(0xE0); // Cascade Setting (CCSET)
-    _writeData(0x02);    // TSFIX
-    _writeCommand(0xE5); // Force Temperature (TSSET)
-    _writeData(0x6E);    // 110
+    _startTransfer();
+    _transferCommand(0xE0); // Cascade Setting (CCSET)
+    _transfer(0x02);     // TSFIX
+    _transferCommand(0xE5); // Force Temperature (TSSET)
+    _transfer(0x6E);     // 110
+    _endTransfer();
   }
   _PowerOn();
   _using_partial_mode = true;
@@ -44,12 +44,9 @@ void GxEPD2_583c_GDEQ0583Z31::writeScreenBuffer(uint8_t black_value, uint8_t col
 
 void GxEPD2_583c_GDEQ0583Z31::_writeScreenBuffer(uint8_t command, uint8_t value)
 {
-  _writeCommand(command);
   _startTransfer();
-  for (uint32_t i = 0; i < uint32_t(WIDTH) * uint32_t(HEIGHT) / 8; i++)
-  {
-    _transfer(value);
-  }
+  _transferCommand(command);
+  _transferFill(value, uint32_t(WIDTH) * uint32_t(HEIGHT) / 8);
   _endTransfer();
 }
 
@@ -78,30 +75,13 @@ void GxEPD2_583c_GDEQ0583Z31::_writeImage(uint8_t command, const uint8_t bitmap[
   if (!_init_display_done) _InitDisplay();
   _writeCommand(0x91); // partial in
   _setPartialRamArea(x1, y1, w1, h1);
-  _writeCommand(command);
   _startTransfer();
+  _transferCommand(command);
   for (int16_t i = 0; i < h1; i++)
   {
-    for (int16_t j = 0; j < w1 / 8; j++)
-    {
-      uint8_t data;
-      // use wb, h of bitmap for index!
-      uint16_t idx = mirror_y ? j + dx / 8 + uint16_t((h - 1 - (i + dy))) * wb : j + dx / 8 + uint16_t(i + dy) * wb;
-      if (pgm)
-      {
-#if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-        data = pgm_read_byte(&bitmap[idx]);
-#else
-        data = bitmap[idx];
-#endif
-      }
-      else
-      {
-        data = bitmap[idx];
-      }
-      if (invert) data = ~data;
-      _transfer(data);
-    }
+    // use wb, h of bitmap for index!
+    uint16_t idx = mirror_y ? dx / 8 + uint16_t((h - 1 - (i + dy))) * wb : dx / 8 + uint16_t(i + dy) * wb;
+    _transferBytes(&bitmap[idx], w1 / 8, invert, pgm);
   }
   _endTransfer();
   _writeCommand(0x92); // partial out
@@ -140,30 +120,13 @@ void GxEPD2_583c_GDEQ0583Z31::_writeImagePart(uint8_t command, const uint8_t bit
   if (!_init_display_done) _InitDisplay();
   _writeCommand(0x91); // partial in
   _setPartialRamArea(x1, y1, w1, h1);
-  _writeCommand(command);
   _startTransfer();
+  _transferCommand(command);
   for (int16_t i = 0; i < h1; i++)
   {
-    for (int16_t j = 0; j < w1 / 8; j++)
-    {
-      uint8_t data;
-      // use wb_bitmap, h_bitmap of bitmap for index!
-      uint16_t idx = mirror_y ? x_part / 8 + j + dx / 8 + uint16_t((h_bitmap - 1 - (y_part + i + dy))) * wb_bitmap : x_part / 8 + j + dx / 8 + uint16_t(y_part + i + dy) * wb_bitmap;
-      if (pgm)
-      {
-#if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-        data = pgm_read_byte(&bitmap[idx]);
-#else
-        data = bitmap[idx];
-#endif
-      }
-      else
-      {
-        data = bitmap[idx];
-      }
-      if (invert) data = ~data;
-      _transfer(data);
-    }
+    // use wb_bitmap, h_bitmap of bitmap for index!
+    uint16_t idx = mirror_y ? x_part / 8 + dx / 8 + uint16_t((h_bitmap - 1 - (y_part + i + dy))) * wb_bitmap : x_part / 8 + dx / 8 + uint16_t(y_part + i + dy) * wb_bitmap;
+    _transferBytes(&bitmap[idx], w1 / 8, invert, pgm);
   }
   _endTransfer();
   _writeCommand(0x92); // partial out
@@ -262,8 +225,10 @@ void GxEPD2_583c_GDEQ0583Z31::hibernate()
   _PowerOff();
   if (_rst >= 0)
   {
-    _writeCommand(0x07); // deep sleep
-    _writeData(0xA5);    // check code
+    _startTransfer();
+    _transferCommand(0x07); // deep sleep
+    _transfer(0xA5);     // check code
+    _endTransfer();
     _hibernating = true;
     _init_display_done = false;
   }
@@ -274,16 +239,18 @@ void GxEPD2_583c_GDEQ0583Z31::_setPartialRamArea(uint16_t x, uint16_t y, uint16_
   uint16_t xe = (x + w - 1) | 0x0007; // byte boundary inclusive (last byte)
   uint16_t ye = y + h - 1;
   x &= 0xFFF8; // byte boundary
-  _writeCommand(0x90); // partial window
-  _writeData(x / 256);
-  _writeData(x % 256);
-  _writeData(xe / 256);
-  _writeData(xe % 256);
-  _writeData(y / 256);
-  _writeData(y % 256);
-  _writeData(ye / 256);
-  _writeData(ye % 256);
-  _writeData(0x01);
+  _startTransfer();
+  _transferCommand(0x90); // partial window
+  _transfer(x / 256);
+  _transfer(x % 256);
+  _transfer(xe / 256);
+  _transfer(xe % 256);
+  _transfer(y / 256);
+  _transfer(y % 256);
+  _transfer(ye / 256);
+  _transfer(ye % 256);
+  _transfer(0x01);
+  _endTransfer();
 }
 
 void GxEPD2_583c_GDEQ0583Z31::_PowerOn()
@@ -310,16 +277,20 @@ void GxEPD2_583c_GDEQ0583Z31::_InitDisplay()
 {
   if (_hibernating) _reset();
   _waitWhileBusy("_InitDisplay", power_on_time);
-  _writeCommand(0x00); // PANEL SETTING
-  _writeData(0x0f);    // KW: 3f, KWR: 2F, BWROTP: 0f, BWOTP: 1f
+  _startTransfer();
+  _transferCommand(0x00); // PANEL SETTING
+  _transfer(0x0f);     // KW: 3f, KWR: 2F, BWROTP: 0f, BWOTP: 1f
+  _endTransfer();
   //  _writeCommand(0x61);      // tres (not needed, OTP)
   //  _writeData (WIDTH / 256); // source
   //  _writeData (WIDTH % 256);
   //  _writeData (HEIGHT / 256); // gate
   //  _writeData (HEIGHT % 256);
-  _writeCommand(0x50); // VCOM AND DATA INTERVAL SETTING
-  _writeData(0x11);    // border LUTW, default polarity
-  _writeData(0x07);
+  _startTransfer();
+  _transferCommand(0x50); // VCOM AND DATA INTERVAL SETTING
+  _transfer(0x11);     // border LUTW, default polarity
+  _transfer(0x07);
+  _endTransfer();
   _init_display_done = true;
 }
 
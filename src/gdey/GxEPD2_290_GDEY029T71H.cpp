@@ -43,12 +43,9 @@ void GxEPD2_290_GDEY029T71H::_writeScreenBuffer(uint8_t command, uint8_t value)
 {
   if (!_init_display_done) _InitDisplay();
   _setPartialRamArea(0, 0, WIDTH, HEIGHT);
-  _writeCommand(command);
   _startTransfer();
-  for (uint32_t i = 0; i < uint32_t(WIDTH) * uint32_t(HEIGHT) / 8; i++)
-  {
-    _transfer(value);
-  }
+  _transferCommand(command);
+  _transferFill(value, uint32_t(WIDTH) * uint32_t(HEIGHT) / 8);
   _endTransfer();
 }
 
@@ -88,30 +85,13 @@ void GxEPD2_290_GDEY029T71H::_writeImage(uint8_t command, const uint8_t bitmap[]
   if (!_init_display_done) _InitDisplay();
   if (_initial_write) writeScreenBuffer(); // initial full screen buffer clean
   _setPartialRamArea(x1, y1, w1, h1);
-  _writeCommand(command);
   _startTransfer();
+  _transferCommand(command);
   for (int16_t i = 0; i < h1; i++)
   {
-    for (int16_t j = 0; j < w1 / 8; j++)
-    {
-      uint8_t data;
-      // use wb, h of bitmap for index!
-      int16_t idx = mirror_y ? j + dx / 8 + ((h - 1 - (i + dy))) * wb : j + dx / 8 + (i + dy) * wb;
-      if (pgm)
-      {
-#if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-        data = pgm_read_byte(&bitmap[idx]);
-#else
-        data = bitmap[idx];
-#endif
-      }
-      else
-      {
-        data = bitmap[idx];
-      }
-      if (invert) data = ~data;
-      _transfer(data);
-    }
+    // use wb, h of bitmap for index!
+    int16_t idx = mirror_y ? dx / 8 + ((h - 1 - (i + dy))) * wb : dx / 8 + (i + dy) * wb;
+    _transferBytes(&bitmap[idx], w1 / 8, invert, pgm);
   }
   _endTransfer();
   delay(1); // yield() to avoid WDT on ESP8266 and ESP32
@@ -155,30 +135,13 @@ void GxEPD2_290_GDEY029T71H::_writeImagePart(uint8_t command, const uint8_t bitm
   if (!_init_display_done) _InitDisplay();
   if (_initial_write) writeScreenBuffer(); // initial full screen buffer clean
   _setPartialRamArea(x1, y1, w1, h1);
-  _writeCommand(command);
   _startTransfer();
+  _transferCommand(command);
   for (int16_t i = 0; i < h1; i++)
   {
-    for (int16_t j = 0; j < w1 / 8; j++)
-    {
-      uint8_t data;
-      // use wb_bitmap, h_bitmap of bitmap for index!
-      int16_t idx = mirror_y ? x_part / 8 + j + dx / 8 + ((h_bitmap - 1 - (y_part + i + dy))) * wb_bitmap : x_part / 8 + j + dx / 8 + (y_part + i + dy) * wb_bitmap;
-      if (pgm)
-      {
-#if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-        data = pgm_read_byte(&bitmap[idx]);
-#else
-        data = bitmap[idx];
-#endif
-      }
-      else
-      {
-        data = bitmap[idx];
-      }
-      if (invert) data = ~data;
-      _transfer(data);
-    }
+    // use wb_bitmap, h_bitmap of bitmap for index!
+    int16_t idx = mirror_y ? x_part / 8 + dx / 8 + ((h_bitmap - 1 - (y_part + i + dy))) * wb_bitmap : x_part / 8 + dx / 8 + (y_part + i + dy) * wb_bitmap;
+    _transferBytes(&bitmap[idx], w1 / 8, invert, pgm);
   }
   _endTransfer();
   delay(1); // yield() to avoid WDT on ESP8266 and ESP32
@@ -288,8 +251,10 @@ void GxEPD2_290_GDEY029T71H::hibernate()
   _PowerOff();
   if (_rst >= 0)
   {
-    _writeCommand(0x10); // deep sleep mode
-    _writeData(0x1);     // enter deep sleep
+    _startTransfer();
+    _transferCommand(0x10); // deep sleep mode
+    _transfer(0x1);      // enter deep sleep
+    _endTransfer();
     _hibernating = true;
     _init_display_done = false;
   }
@@ -300,36 +265,40 @@ void GxEPD2_290_GDEY029T71H::_setPartialRamArea(uint16_t x, uint16_t y, uint16_t
   x += SOURCE_SHIFT;
 #if 1 // normal, top opposite connection
   _writeCommand(0x11); // set ram entry mode
-  _writeData(0x03);    // x increase, y increase : normal mode
-  _writeCommand(0x44);
-  _writeData(x / 8);
-  _writeData((x + w - 1) / 8);
-  _writeCommand(0x45);
-  _writeData(y % 256);
-  _writeData(y / 256);
-  _writeData((y + h - 1) % 256);
-  _writeData((y + h - 1) / 256);
-  _writeCommand(0x4e);
-  _writeData(x / 8);
-  _writeCommand(0x4f);
-  _writeData(y % 256);
-  _writeData(y / 256);
+  _startTransfer();
+  _transfer(0x03);     // x increase, y increase : normal mode
+  _transferCommand(0x44);
+  _transfer(x / 8);
+  _transfer((x + w - 1) / 8);
+  _transferCommand(0x45);
+  _transfer(y % 256);
+  _transfer(y / 256);
+  _transfer((y + h - 1) % 256);
+  _transfer((y + h - 1) / 256);
+  _transferCommand(0x4e);
+  _transfer(x / 8);
+  _transferCommand(0x4f);
+  _transfer(y % 256);
+  _transfer(y / 256);
+  _endTransfer();
 #else // rotated 180, top near connection
   _writeCommand(0x11); // set ram entry mode
-  _writeData(0x00);    // x decrease, y decrease
-  _writeCommand(0x44);
-  _writeData((x + w - 1) / 8);
-  _writeData(x / 8);
-  _writeCommand(0x45);
-  _writeData((y + h - 1) % 256);
-  _writeData((y + h - 1) / 256);
-  _writeData(y % 256);
-  _writeData(y / 256);
-  _writeCommand(0x4e);
-  _writeData((x + w - 1) / 8);
-  _writeCommand(0x4f);
-  _writeData((y + h - 1) % 256);
-  _writeData((y + h - 1) / 256);
+  _startTransfer();
+  _transfer(0x00);     // x decrease, y decrease
+  _transferCommand(0x44);
+  _transfer((x + w - 1) / 8);
+  _transfer(x / 8);
+  _transferCommand(0x45);
+  _transfer((y + h - 1) % 256);
+  _transfer((y + h - 1) / 256);
+  _transfer(y % 256);
+  _transfer(y / 256);
+  _transferCommand(0x4e);
+  _transfer((x + w - 1) / 8);
+  _transferCommand(0x4f);
+  _transfer((y + h - 1) % 256);
+  _transfer((y + h - 1) / 256);
+  _endTransfer();
 #endif
 }
 
@@ -337,9 +306,11 @@ void GxEPD2_290_GDEY029T71H::_PowerOn()
 {
   if (!_power_is_on)
   {
-    _writeCommand(0x22);
-    _writeData(0xe0);
-    _writeCommand(0x20);
+    _startTransfer();
+    _transferCommand(0x22);
+    _transfer(0xe0);
+    _transferCommand(0x20);
+    _endTransfer();
     _waitWhileBusy("_PowerOn", power_on_time);
   }
   _power_is_on = true;
@@ -349,9 +320,11 @@ void GxEPD2_290_GDEY029T71H::_PowerOff()
 {
   if (_power_is_on)
   {
-    _writeCommand(0x22);
-    _writeData(0x83);
-    _writeCommand(0x20);
+    _startTransfer();
+    _transferCommand(0x22);
+    _transfer(0x83);
+    _transferCommand(0x20);
+    _endTransfer();
     _waitWhileBusy("_PowerOff", power_off_time);
   }
   _power_is_on = false;
@@ -364,45 +337,57 @@ void GxEPD2_290_GDEY029T71H::_InitDisplay()
   delay(10); // 10ms according to specs
   _writeCommand(0x12);  //SWRESET
   delay(10); // 10ms according to specs
-  _writeCommand(0x01); //Driver output control
-  _writeData((HEIGHT - 1) % 256);
-  _writeData((HEIGHT - 1) / 256);
-  _writeData(0x00);
-  _writeCommand(0x3C); //BorderWavefrom
-  _writeData(0x05);
-  _writeCommand(0x18); //Read built-in temperature sensor
-  _writeData(0x80);
+  _startTransfer();
+  _transferCommand(0x01); //Driver output control
+  _transfer((HEIGHT - 1) % 256);
+  _transfer((HEIGHT - 1) / 256);
+  _transfer(0x00);
+  _transferCommand(0x3C); //BorderWavefrom
+  _transfer(0x05);
+  _transferCommand(0x18); //Read built-in temperature sensor
+  _transfer(0x80);
+  _endTransfer();
   // NEEDED before first _setPartialRamArea
   // reason: OTP set for 168x384, but TFT shifted: S8..S175 connected to TFT sources
-  _writeCommand(0x21); // Display Update Controll
-  _writeData(0x00);    // RED normal
-  _writeData(0x00);    // 200x384
+  _startTransfer();
+  _transferCommand(0x21); // Display Update Controll
+  _transfer(0x00);     // RED normal
+  _transfer(0x00);     // 200x384
+  _endTransfer();
   _setPartialRamArea(0, 0, WIDTH, HEIGHT);
   _init_display_done = true;
 }
 
 void GxEPD2_290_GDEY029T71H::_Update_Full()
 {
-  _writeCommand(0x21); // Display Update Controll
-  _writeData(0x40);    // bypass RED as 0
-  _writeData(0x00);    // 200x384
+  _startTransfer();
+  _transferCommand(0x21); // Display Update Controll
+  _transfer(0x40);     // bypass RED as 0
+  _transfer(0x00);     // 200x384
+  _endTransfer();
   if (useFastFullUpdate)
   {
-    _writeCommand(0x1A); // Write to temperature register
-    _writeData(0x6E);
-    _writeData(0x00);
-    _writeCommand(0x22); // Load temperature value
-    _writeData(0x91);
-    _writeCommand(0x20);
+    _startTransfer();
+    _transferCommand(0x1A); // Write to temperature register
+    _transfer(0x6E);
+    _transfer(0x00);
+    _transferCommand(0x22); // Load temperature value
+    _transfer(0x91);
+    _transferCommand(0x20);
+    _endTransfer();
     //_waitWhileBusy("_Update_Full Load temperature", full_refresh_time); // 15us
     delay(2);
-    _writeCommand(0x22); // Display Update Control
-    _writeData(0xC7);
+    _startTransfer();
+    _transferCommand(0x22); // Display Update Control
+    _transfer(0xC7);
+    _endTransfer();
   }
   else
   {
-    _writeCommand(0x22);
-    _writeData(0xf7);
+    _startTransfer();
+    _transferCommand(0x22);
+    _transfer(0xf7);
+    _endTransfer();
   }
   _writeCommand(0x20);
   _waitWhileBusy("_Update_Full", full_refresh_time);
@@ -411,12 +396,14 @@ void GxEPD2_290_GDEY029T71H::_Update_Full()
 
 void GxEPD2_290_GDEY029T71H::_Update_Part()
 {
-  _writeCommand(0x21); // Display Update Controll
-  _writeData(0x00);    // RED normal
-  _writeData(0x00);    // 200x384
-  _writeCommand(0x22);
-  _writeData(0xdc);
-  _writeCommand(0x20);
+  _startTransfer();
+  _transferCommand(0x21); // Display Update Controll
+  _transfer(0x00);     // RED normal
+  _transfer(0x00);     // 200x384
+  _transferCommand(0x22);
+  _transfer(0xdc);
+  _transferCommand(0x20);
+  _endTransfer();
   _waitWhileBusy("_Update_Part", partial_refresh_time);
   _power_is_on = true;
 }
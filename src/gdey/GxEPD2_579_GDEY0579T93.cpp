@@ -43,36 +43,24 @@ void GxEPD2_579_GDEY0579T93::_writeScreenBuffer(uint8_t command, uint8_t value)
 {
   if (!_init_display_done) _InitDisplay();
   _setPartialRamAreaMaster(0, 0, WIDTH / 2, HEIGHT);
-  _writeCommand(command);
   _startTransfer();
-  for (uint32_t i = 0; i < uint32_t(WIDTH / 2) * uint32_t(HEIGHT) / 8; i++)
-  {
-    _transfer(value);
-  }
+  _transferCommand(command);
+  _transferFill(value, uint32_t(WIDTH / 2) * uint32_t(HEIGHT) / 8);
   _endTransfer();
   _setPartialRamAreaMaster(0, HEIGHT / 2, WIDTH / 2, HEIGHT);
-  _writeCommand(command);
   _startTransfer();
-  for (uint32_t i = 0; i < uint32_t(WIDTH / 2) * uint32_t(HEIGHT) / 8; i++)
-  {
-    _transfer(value);
-  }
+  _transferCommand(command);
+  _transferFill(value, uint32_t(WIDTH / 2) * uint32_t(HEIGHT) / 8);
   _endTransfer();
   _setPartialRamAreaSlave(0, 0, WIDTH / 2, HEIGHT / 2);
-  _writeCommand(command | 0x80);
   _startTransfer();
-  for (uint32_t i = 0; i < uint32_t(WIDTH / 2) * uint32_t(HEIGHT) / 8; i++)
-  {
-    _transfer(value);
-  }
+  _transferCommand(command | 0x80);
+  _transferFill(value, uint32_t(WIDTH / 2) * uint32_t(HEIGHT) / 8);
   _endTransfer();
   _setPartialRamAreaSlave(0, HEIGHT / 2, WIDTH / 2, HEIGHT);
-  _writeCommand(command | 0x80);
   _startTransfer();
-  for (uint32_t i = 0; i < uint32_t(WIDTH / 2) * uint32_t(HEIGHT) / 8; i++)
-  {
-    _transfer(value);
-  }
+  _transferCommand(command | 0x80);
+  _transferFill(value, uint32_t(WIDTH / 2) * uint32_t(HEIGHT) / 8);
   _endTransfer();
 }
 
@@ -172,26 +160,9 @@ void GxEPD2_579_GDEY0579T93::_writeDataFromImage(const uint8_t bitmap[], int16_t
   _startTransfer();
   for (int16_t i = 0; i < h; i++)
   {
-    for (int16_t j = 0; j < w; j += 8)
-    {
-      uint8_t data;
-      // use wbb, h of bitmap for index!
-      int16_t idx = mirror_y ? ((j + dx) / 8 + ((hb - 1 - (i + dy))) * wbb) : ((j + dx) / 8 + (i + dy) * wbb);
-      if (pgm)
-      {
-#if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-        data = pgm_read_byte(&bitmap[idx]);
-#else
-        data = bitmap[idx];
-#endif
-      }
-      else
-      {
-        data = bitmap[idx];
-      }
-      if (invert) data = ~data;
-      _transfer(data);
-    }
+    // use wbb, h of bitmap for index! dx is multiple of 8
+    int16_t idx = mirror_y ? (dx / 8 + ((hb - 1 - (i + dy))) * wbb) : (dx / 8 + (i + dy) * wbb);
+    _transferBytes(&bitmap[idx], (w + 7) / 8, invert, pgm);
   }
   _endTransfer();
 }
@@ -348,8 +319,10 @@ void GxEPD2_579_GDEY0579T93::hibernate()
   _PowerOff();
   if (_rst >= 0)
   {
-    _writeCommand(0x10); // deep sleep mode
-    _writeData(0x1);     // enter deep sleep
+    _startTransfer();
+    _transferCommand(0x10); // deep sleep mode
+    _transfer(0x1);      // enter deep sleep
+    _endTransfer();
     _hibernating = true;
     _init_display_done = false;
   }
@@ -371,69 +344,79 @@ void GxEPD2_579_GDEY0579T93::_setPartialRamAreaSlave(uint16_t x, uint16_t y, uin
 
 void GxEPD2_579_GDEY0579T93::_setPartialRamArea(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint8_t mode, uint8_t target)
 {
-  _writeCommand(0x11 | target); // set ram entry mode
-  _writeData(mode);
+  _startTransfer();
+  _transferCommand(0x11 | target); // set ram entry mode
+  _transfer(mode);
+  _endTransfer();
   switch (mode)
   {
     case 0x00: // x decrement, y decrement
       _writeCommand(0x44 | target);
-      _writeData((x + w - 1) / 8);
-      _writeData(x / 8);
-      _writeCommand(0x45 | target);
-      _writeData((y + h - 1) % 256);
-      _writeData((y + h - 1) / 256);
-      _writeData(y % 256);
-      _writeData(y / 256);
-      _writeCommand(0x4e | target);
-      _writeData((x + w - 1) / 8);
-      _writeCommand(0x4f | target);
-      _writeData((y + h - 1) % 256);
-      _writeData((y + h - 1) / 256);
+      _startTransfer();
+      _transfer((x + w - 1) / 8);
+      _transfer(x / 8);
+      _transferCommand(0x45 | target);
+      _transfer((y + h - 1) % 256);
+      _transfer((y + h - 1) / 256);
+      _transfer(y % 256);
+      _transfer(y / 256);
+      _transferCommand(0x4e | target);
+      _transfer((x + w - 1) / 8);
+      _transferCommand(0x4f | target);
+      _transfer((y + h - 1) % 256);
+      _transfer((y + h - 1) / 256);
+      _endTransfer();
       break;
     case 0x01: // x increment, y decrement
       _writeCommand(0x44 | target);
-      _writeData(x / 8);
-      _writeData((x + w - 1) / 8);
-      _writeCommand(0x45 | target);
-      _writeData((y + h - 1) % 256);
-      _writeData((y + h - 1) / 256);
-      _writeData(y % 256);
-      _writeData(y / 256);
-      _writeCommand(0x4e | target);
-      _writeData(x / 8);
-      _writeCommand(0x4f | target);
-      _writeData((y + h - 1) % 256);
-      _writeData((y + h - 1) / 256);
+      _startTransfer();
+      _transfer(x / 8);
+      _transfer((x + w - 1) / 8);
+      _transferCommand(0x45 | target);
+      _transfer((y + h - 1) % 256);
+      _transfer((y + h - 1) / 256);
+      _transfer(y % 256);
+      _transfer(y / 256);
+      _transferCommand(0x4e | target);
+      _transfer(x / 8);
+      _transferCommand(0x4f | target);
+      _transfer((y + h - 1) % 256);
+      _transfer((y + h - 1) / 256);
+      _endTransfer();
       break;
     case 0x02: // x decrement, y increment
       _writeCommand(0x44 | target);
-      _writeData((x + w - 1) / 8);
-      _writeData(x / 8);
-      _writeCommand(0x45 | target);
-      _writeData(y % 256);
-      _writeData(y / 256);
-      _writeData((y + h - 1) % 256);
-      _writeData((y + h - 1) / 256);
-      _writeCommand(0x4e | target);
-      _writeData((x + w - 1) / 8);
-      _writeCommand(0x4f | target);
-      _writeData(y % 256);
-      _writeData(y / 256);
+      _startTransfer();
+      _transfer((x + w - 1) / 8);
+      _transfer(x / 8);
+      _transferCommand(0x45 | target);
+      _transfer(y % 256);
+      _transfer(y / 256);
+      _transfer((y + h - 1) % 256);
+      _transfer((y + h - 1) / 256);
+      _transferCommand(0x4e | target);
+      _transfer((x + w - 1) / 8);
+      _transferCommand(0x4f | target);
+      _transfer(y % 256);
+      _transfer(y / 256);
+      _endTransfer();
       break;
     case 0x03: // x increment, y increment
       _writeCommand(0x44 | target);
-      _writeData(x / 8);
-      _writeData((x + w - 1) / 8);
-      _writeCommand(0x45 | target);
-      _writeData(y % 256);
-      _writeData(y / 256);
-      _writeData((y + h - 1) % 256);
-      _writeData((y + h - 1) / 256);
-      _writeCommand(0x4e | target);
-      _writeData(x / 8);
-      _writeCommand(0x4f | target);
-      _writeData(y % 256);
-      _writeData(y / 256);
+      _startTransfer();
+      _transfer(x / 8);
+      _transfer((x + w - 1) / 8);
+      _transferCommand(0x45 | target);
+      _transfer(y % 256);
+      _transfer(y / 256);
+      _transfer((y + h - 1) % 256);
+      _transfer((y + h - 1) / 256);
+      _transferCommand(0x4e | target);
+      _transfer(x / 8);
+      _transferCommand(0x4f | target);
+      _transfer(y % 256);
+      _transfer(y / 256);
+      _endTransfer();
       break;
   }
   delay(2);
@@ -443,9 +426,11 @@ void GxEPD2_579_GDEY0579T93::_PowerOn()
 {
   if (!_power_is_on)
   {
-    _writeCommand(0x22);
-    _writeData(0xe0);
-    _writeCommand(0x20);
+    _startTransfer();
+    _transferCommand(0x22);
+    _transfer(0xe0);
+    _transferCommand(0x20);
+    _endTransfer();
     _waitWhileBusy("_PowerOn", power_on_time);
   }
   _power_is_on = true;
@@ -455,9 +440,11 @@ void GxEPD2_579_GDEY0579T93::_PowerOff()
 {
   if (_power_is_on)
   {
-    _writeCommand(0x22);
-    _writeData(0x83);
-    _writeCommand(0x20);
+    _startTransfer();
+    _transferCommand(0x22);
+    _transfer(0x83);
+    _transferCommand(0x20);
+    _endTransfer();
     _waitWhileBusy("_PowerOff", power_off_time);
   }
   _power_is_on = false;
@@ -469,40 +456,50 @@ void GxEPD2_579_GDEY0579T93::_InitDisplay()
   if (_hibernating) _reset();
   _writeCommand(0x12);  //SWRESET
   delay(10); // 10ms according to specs, 4ms measured
-  _writeCommand(0x18); // Temperature Sensor Control
-  _writeData(0x80);    // Internal temperature sensor
-  _writeCommand(0x22); // Display Update Control 2
+  _startTransfer();
+  _transferCommand(0x18); // Temperature Sensor Control
+  _transfer(0x80);     // Internal temperature sensor
+  _transferCommand(0x22); // Display Update Control 2
   //_writeData(0xB1);    // Enable clock signal, Load temperature value, Load LUT (3-color mode), Disable clock signal
-  _writeData(0xB1);    // Enable clock signal, Load temperature value, Load LUT (black/white mode), Disable clock signal
-  _writeCommand(0x20); // Master Activation
+  _transfer(0xB1);     // Enable clock signal, Load temperature value, Load LUT (black/white mode), Disable clock signal
+  _transferCommand(0x20); // Master Activation
+  _endTransfer();
   delay(10); // 4ms measured
-  _writeCommand(0x1A); // Write to temperature register
-  _writeData(0x64);
-  _writeData(0x00);
-  _writeCommand(0x22); // Display Update Control 2
-  _writeData(0x91);    // Load temperature value, Load LUT (black/white mode), Disable clock signal
-  _writeCommand(0x20); // Master Activation
+  _startTransfer();
+  _transferCommand(0x1A); // Write to temperature register
+  _transfer(0x64);
+  _transfer(0x00);
+  _transferCommand(0x22); // Display Update Control 2
+  _transfer(0x91);     // Load temperature value, Load LUT (black/white mode), Disable clock signal
+  _transferCommand(0x20); // Master Activation
+  _endTransfer();
   delay(10); // 4ms measured
   _init_display_done = true;
 }
 
 void GxEPD2_579_GDEY0579T93::_Update_Full()
 {
-  _writeCommand(0x21); // Display Update Control
-  _writeData(0x40);    // bypass RED as 0
-  _writeData(0x10);    // cascade application
+  _startTransfer();
+  _transferCommand(0x21); // Display Update Control
+  _transfer(0x40);     // bypass RED as 0
+  _transfer(0x10);     // cascade application
+  _endTransfer();
   if (useFastFullUpdate)
   {
-    _writeCommand(0x1A); // Write to temperature register
-    _writeData(0x64);
-    _writeData(0x00);
-    _writeCommand(0x22); // Display Update Control 2
-    _writeData(0xd7);
+    _startTransfer();
+    _transferCommand(0x1A); // Write to temperature register
+    _transfer(0x64);
+    _transfer(0x00);
+    _transferCommand(0x22); // Display Update Control 2
+    _transfer(0xd7);
+    _endTransfer();
   }
   else
   {
-    _writeCommand(0x22); // Display Update Control 2
-    _writeData(0xF7);
+    _startTransfer();
+    _transferCommand(0x22); // Display Update Control 2
+    _transfer(0xF7);
+    _endTransfer();
   }
   _writeCommand(0x20); // Master Activation
   _waitWhileBusy("_Update_Full", full_refresh_time);
@@ -511,14 +508,16 @@ void GxEPD2_579_GDEY0579T93::_Update_Full()
 
 void GxEPD2_579_GDEY0579T93::_Update_Part()
 {
-  _writeCommand(0x3C); // Border Waveform Control
-  _writeData(0x80);    // VCOM
-  _writeCommand(0x21); // Display Update Control
-  _writeData(0x00);    // RED normal
-  _writeData(0x10);    // cascade application
-  _writeCommand(0x22); // Display Update Control 2
-  _writeData(0xFF);
-  _writeCommand(0x20);
+  _startTransfer();
+  _transferCommand(0x3C); // Border Waveform Control
+  _transfer(0x80);     // VCOM
+  _transferCommand(0x21); // Display Update Control
+  _transfer(0x00);     // RED normal
+  _transfer(0x10);     // cascade application
+  _transferCommand(0x22); // Display Update Control 2
+  _transfer(0xFF);
+  _transferCommand(0x20);
+  _endTransfer();
   _waitWhileBusy("_Update_Part", partial_refresh_time);
   _power_is_on = false;
 }
@@ -35,12 +35,9 @@ void GxEPD2_750_GDEY075T7::writeScreenBuffer(uint8_t value)
 
 void GxEPD2_750_GDEY075T7::_writeScreenBuffer(uint8_t command, uint8_t value)
 {
-  _writeCommand(command);
   _startTransfer();
-  for (uint32_t i = 0; i < uint32_t(WIDTH) * uint32_t(HEIGHT) / 8; i++)
-  {
-    _transfer(value);
-  }
+  _transferCommand(command);
+  _transferFill(value, uint32_t(WIDTH) * uint32_t(HEIGHT) / 8);
   _endTransfer();
 }
 
@@ -73,30 +70,13 @@ void GxEPD2_750_GDEY075T7::_writeImage(uint8_t command, const uint8_t bitmap[],
   if (!_using_partial_mode) _Init_Part();
   _writeCommand(0x91); // partial in
   _setPartialRamArea(x1, y1, w1, h1);
-  _writeCommand(command);
   _startTransfer();
+  _transferCommand(command);
   for (int16_t i = 0; i < h1; i++)
   {
-    for (int16_t j = 0; j < w1 / 8; j++)
-    {
-      uint8_t data;
-      // use wb, h of bitmap for index!
-      uint16_t idx = mirror_y ? j + dx / 8 + uint16_t((h - 1 - (i + dy))) * wb : j + dx / 8 + uint16_t(i + dy) * wb;
-      if (pgm)
-      {
-#if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-        data = pgm_read_byte(&bitmap[idx]);
-#else
-        data = bitmap[idx];
-#endif
-      }
-      else
-      {
-        data = bitmap[idx];
-      }
-      if (invert) data = ~data;
-      _transfer(data);
-    }
+    // use wb, h of bitmap for index!
+    uint16_t idx = mirror_y ? dx / 8 + uint16_t((h - 1 - (i + dy))) * wb : dx / 8 + uint16_t(i + dy) * wb;
+    _transferBytes(&bitmap[idx], w1 / 8, invert, pgm);
   }
   _endTransfer();
   _writeCommand(0x92); // partial out
@@ -135,30 +115,13 @@ void GxEPD2_750_GDEY075T7::_writeImagePart(uint8_t command, const uint8_t bitmap
   if (!_using_partial_mode) _Init_Part();
   _writeCommand(0x91); // partial in
   _setPartialRamArea(x1, y1, w1, h1);
-  _writeCommand(command);
   _startTransfer();
+  _transferCommand(command);
   for (int16_t i = 0; i < h1; i++)
   {
-    for (int16_t j = 0; j < w1 / 8; j++)
-    {
-      uint8_t data;
-      // use wb_bitmap, h_bitmap of bitmap for index!
-      uint16_t idx = mirror_y ? x_part / 8 + j + dx / 8 + uint16_t((h_bitmap - 1 - (y_part + i + dy))) * wb_bitmap : x_part / 8 + j + dx / 8 + uint16_t(y_part + i + dy) * wb_bitmap;
-      if (pgm)
-      {
-#if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-        data = pgm_read_byte(&bitmap[idx]);
-#else
-        data = bitmap[idx];
-#endif
-      }
-      else
-      {
-        data = bitmap[idx];
-      }
-      if (invert) data = ~data;
-      _transfer(data);
-    }
+    // use wb_bitmap, h_bitmap of bitmap for index!
+    uint16_t idx = mirror_y ? x_part / 8 + dx / 8 + uint16_t((h_bitmap - 1 - (y_part + i + dy))) * wb_bitmap : x_part / 8 + dx / 8 + uint16_t(y_part + i + dy) * wb_bitmap;
+    _transferBytes(&bitmap[idx], w1 / 8, invert, pgm);
   }
   _endTransfer();
   _writeCommand(0x92); // partial out
@@ -265,8 +228,10 @@ void GxEPD2_750_GDEY075T7::hibernate()
   _PowerOff();
   if (_rst >= 0)
   {
-    _writeCommand(0x07); // deep sleep
-    _writeData(0xA5);    // check code
+    _startTransfer();
+    _transferCommand(0x07); // deep sleep
+    _transfer(0xA5);     // check code
+    _endTransfer();
     _hibernating = true;
   }
 }
@@ -276,16 +241,18 @@ void GxEPD2_750_GDEY075T7::_setPartialRamArea(uint16_t x, uint16_t y, uint16_t w
   uint16_t xe = (x + w - 1) | 0x0007; // byte boundary inclusive (last byte)
   uint16_t ye = y + h - 1;
   x &= 0xFFF8; // byte boundary
-  _writeCommand(0x90); // partial window
-  _writeData(x / 256);
-  _writeData(x % 256);
-  _writeData(xe / 256);
-  _writeData(xe % 256);
-  _writeData(y / 256);
-  _writeData(y % 256);
-  _writeData(ye / 256);
-  _writeData(ye % 256);
-  _writeData(0x01);
+  _startTransfer();
+  _transferCommand(0x90); // partial window
+  _transfer(x / 256);
+  _transfer(x % 256);
+  _transfer(xe / 256);
+  _transfer(xe % 256);
+  _transfer(y / 256);
+  _transfer(y % 256);
+  _transfer(ye / 256);
+  _transfer(ye % 256);
+  _transfer(0x01);
+  _endTransfer();
 }
 
 void GxEPD2_750_GDEY075T7::_PowerOn()
@@ -309,38 +276,25 @@ void GxEPD2_750_GDEY075T7::_PowerOff()
   _using_partial_mode = false;
 }
 
-void GxEPD2_750_GDEY075T7::_InitDisplay()
+// command, number of parameters, parameters
+const unsigned char GxEPD2_750_GDEY075T7::init_sequence[] PROGMEM =
 {
-  if (_hibernating) _reset();
-  _writeCommand(0x00); // PANEL SETTING
-  _writeData(0x1f);    // KW: 3f, KWR: 2F, BWROTP: 0f, BWOTP: 1f
+  0x00, 1, 0x1f, // PANEL SETTING, KW: 3f, KWR: 2F, BWROTP: 0f, BWOTP: 1f
   // same POWER SETTING as from OTP
-  _writeCommand(0x01); // POWER SETTING
-  _writeData (0x07); // enable internal
-  _writeData (0x07); // VGH=20V,VGL=-20V
-  _writeData (0x3f); // VDH=15V
-  _writeData (0x3f); // VDL=-15V
-  _writeData (0x09); // VDHR=4.2V
+  0x01, 5, 0x07, 0x07, 0x3f, 0x3f, 0x09, // POWER SETTING, enable internal, VGH=20V,VGL=-20V, VDH=15V, VDL=-15V, VDHR=4.2V
   //Enhanced display drive(Add 0x06 command)
-  _writeCommand(0x06); //Booster Soft Start
-  _writeData (0x17);
-  _writeData (0x17);
-  _writeData (0x28);
-  _writeData (0x17);
-  _writeCommand(0x61); //tres
-  _writeData (WIDTH / 256); //source 800
-  _writeData (WIDTH % 256);
-  _writeData (HEIGHT / 256); //gate 480
-  _writeData (HEIGHT % 256);
-  _writeCommand(0x15); // DUSPI
-  _writeData(0x00);    // disabled
-  _writeCommand(0x50); // VCOM AND DATA INTERVAL SETTING
-  _writeData(0x29);    // LUTKW, N2OCP: copy new to old
-  _writeData(0x07);    // CDI 10hsynch (default)
-  _writeCommand(0x60); // TCON SETTING
-  _writeData(0x22);    // S2G G2S, 12 (default)
-  _writeCommand(0xE3); // PWS
-  _writeData(0x22);    // VCOM 2 line period, Source 2 * 660ns
+  0x06, 4, 0x17, 0x17, 0x28, 0x17, // Booster Soft Start
+  0x61, 4, WIDTH / 256, WIDTH % 256, HEIGHT / 256, HEIGHT % 256, // tres, source 800, gate 480
+  0x15, 1, 0x00, // DUSPI disabled
+  0x50, 2, 0x29, 0x07, // VCOM AND DATA INTERVAL SETTING, LUTKW, N2OCP: copy new to old, CDI 10hsynch (default)
+  0x60, 1, 0x22, // TCON SETTING, S2G G2S, 12 (default)
+  0xE3, 1, 0x22 // PWS, VCOM 2 line period, Source 2 * 660ns
+};
+
+void GxEPD2_750_GDEY075T7::_InitDisplay()
+{
+  if (_hibernating) _reset();
+  _writeCommandsPGM(init_sequence, sizeof(init_sequence));
 }
 
 // experimental partial screen update LUTs with balanced charge
@@ -386,8 +340,10 @@ const unsigned char GxEPD2_750_GDEY075T7::lut_25_LUTBD_partial[] PROGMEM =
 void GxEPD2_750_GDEY075T7::_Init_Full()
 {
   _InitDisplay();
-  _writeCommand(0x00); // panel setting
-  _writeData(0x1f);    // full update LUT from OTP
+  _startTransfer();
+  _transferCommand(0x00); // panel setting
+  _transfer(0x1f);     // full update LUT from OTP
+  _endTransfer();
   _PowerOn();
   _using_partial_mode = false;
 }
@@ -399,21 +355,25 @@ void GxEPD2_750_GDEY075T7::_Init_Part()
   {
     if (useFastPartialUpdateFromOTP)
     {
-      _writeCommand(0xE0); // Cascade Setting (CCSET)
-      _writeData(0x02);    // TSFIX
-      _writeCommand(0xE5); // Force Temperature (TSSET)
-      _writeData(0x6E);    // 110
+      _startTransfer();
+      _transferCommand(0xE0); // Cascade Setting (CCSET)
+      _transfer(0x02);     // TSFIX
+      _transferCommand(0xE5); // Force Temperature (TSSET)
+      _transfer(0x6E);     // 110
+      _endTransfer();
     }
     else
     {
-      _writeCommand(0x00); //panel setting
-      _writeData(0x3f); // partial update LUT from registers
-      _writeCommand(0x82); // vcom_DC setting
-      _writeData (0x30); // -2.5V same value as in OTP
-      _writeCommand(0x50); // VCOM AND DATA INTERVAL SETTING
-      _writeData(0x39);    // LUTBD, N2OCP: copy new to old
-      _writeData(0x07);
-      _writeCommand(0x20);
+      _startTransfer();
+      _transferCommand(0x00); //panel setting
+      _transfer(0x3f);  // partial update LUT from registers
+      _transferCommand(0x82); // vcom_DC setting
+      _transfer(0x30);   // -2.5V same value as in OTP
+      _transferCommand(0x50); // VCOM AND DATA INTERVAL SETTING
+      _transfer(0x39);     // LUTBD, N2OCP: copy new to old
+      _transfer(0x07);
+      _transferCommand(0x20);
+      _endTransfer();
       _writeDataPGM(lut_20_LUTC_partial, sizeof(lut_20_LUTC_partial), 42 - sizeof(lut_20_LUTC_partial));
       _writeCommand(0x21);
       _writeDataPGM(lut_21_LUTWW_partial, sizeof(lut_21_LUTWW_partial), 42 - sizeof(lut_21_LUTWW_partial));
@@ -435,17 +395,21 @@ void GxEPD2_750_GDEY075T7::_Update_Full()
 {
   if (useFastFullUpdate)
   {
-    _writeCommand(0xE0); // Cascade Setting (CCSET)
-    _writeData(0x02);    // TSFIX
-    _writeCommand(0xE5); // Force Temperature (TSSET)
-    _writeData(0x5A);    // 90
+    _startTransfer();
+    _transferCommand(0xE0); // Cascade Setting (CCSET)
+    _transfer(0x02);     // TSFIX
+    _transferCommand(0xE5); // Force Temperature (TSSET)
+    _transfer(0x5A);     // 90
+    _endTransfer();
   }
   else
   {
-    _writeCommand(0xE0); // Cascade Setting (CCSET)
-    _writeData(0x00);    // no TSFIX, Temperature value is defined by internal temperature sensor
-    _writeCommand(0x41); // TSE, Enable Temperature Sensor
-    _writeData(0x00);    // TSE, Internal temperature sensor switch
+    _startTransfer();
+    _transferCommand(0xE0); // Cascade Setting (CCSET)
+    _transfer(0x00);     // no TSFIX, Temperature value is defined by internal temperature sensor
+    _transferCommand(0x41); // TSE, Enable Temperature Sensor
+    _transfer(0x00);     // TSE, Internal temperature sensor switch
+    _endTransfer();
   }
   _writeCommand(0x12); //display refresh
   _waitWhileBusy("_Update_Full", full_refresh_time);
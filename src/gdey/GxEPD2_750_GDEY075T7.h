@@ -82,6 +82,7 @@ class GxEPD2_750_GDEY075T7 : public GxEPD2_EPD
     void _Update_Full();
     void _Update_Part();
   private:
+    static const unsigned char init_sequence[];
     static const unsigned char lut_20_LUTC_partial[];
     static const unsigned char lut_21_LUTWW_partial[];
     static const unsigned char lut_22_LUTKW_partial[];
@@ -51,12 +51,9 @@ void GxEPD2_420c_GDEY042Z98::writeScreenBuffer(uint8_t black_value, uint8_t colo
 void GxEPD2_420c_GDEY042Z98::_writeScreenBuffer(uint8_t command, uint8_t value)
 {
   _setPartialRamArea(0, 0, WIDTH, HEIGHT);
-  _writeCommand(command);
   _startTransfer();
-  for (uint32_t i = 0; i < uint32_t(WIDTH) * uint32_t(HEIGHT) / 8; i++)
-  {
-    _transfer(value);
-  }
+  _transferCommand(command);
+  _transferFill(value, uint32_t(WIDTH) * uint32_t(HEIGHT) / 8);
   _endTransfer();
 }
 
@@ -84,30 +81,13 @@ void GxEPD2_420c_GDEY042Z98::_writeImage(uint8_t command, const uint8_t bitmap[]
   if ((w1 <= 0) || (h1 <= 0)) return;
   if (!_init_display_done) _InitDisplay();
   _setPartialRamArea(x1, y1, w1, h1);
-  _writeCommand(command);
   _startTransfer();
+  _transferCommand(command);
   for (int16_t i = 0; i < h1; i++)
   {
-    for (int16_t j = 0; j < w1 / 8; j++)
-    {
-      uint8_t data;
-      // use wb, h of bitmap for index!
-      uint32_t idx = mirror_y ? j + dx / 8 + uint32_t((h - 1 - (i + dy))) * wb : j + dx / 8 + uint32_t(i + dy) * wb;
-      if (pgm)
-      {
-#if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-        data = pgm_read_byte(&bitmap[idx]);
-#else
-        data = bitmap[idx];
-#endif
-      }
-      else
-      {
-        data = bitmap[idx];
-      }
-      if (invert) data = ~data;
-      _transfer(data);
-    }
+    // use wb, h of bitmap for index!
+    uint32_t idx = mirror_y ? dx / 8 + uint32_t((h - 1 - (i + dy))) * wb : dx / 8 + uint32_t(i + dy) * wb;
+    _transferBytes(&bitmap[idx], w1 / 8, invert, pgm);
   }
   _endTransfer();
   delay(1); // yield() to avoid WDT on ESP8266 and ESP32
@@ -154,30 +134,13 @@ void GxEPD2_420c_GDEY042Z98::_writeImagePart(uint8_t command, const uint8_t bitm
   if ((w1 <= 0) || (h1 <= 0)) return;
   if (!_init_display_done) _InitDisplay();
   _setPartialRamArea(x1, y1, w1, h1);
-  _writeCommand(command);
   _startTransfer();
+  _transferCommand(command);
   for (int16_t i = 0; i < h1; i++)
   {
-    for (int16_t j = 0; j < w1 / 8; j++)
-    {
-      uint8_t data;
-      // use wb_bitmap, h_bitmap of bitmap for index!
-      uint32_t idx = mirror_y ? x_part / 8 + j + dx / 8 + uint32_t((h_bitmap - 1 - (y_part + i + dy))) * wb_bitmap : x_part / 8 + j + dx / 8 + uint32_t(y_part + i + dy) * wb_bitmap;
-      if (pgm)
-      {
-#if defined(__AVR) || defined(ESP8266) || defined(ESP32)
-        data = pgm_read_byte(&bitmap[idx]);
-#else
-        data = bitmap[idx];
-#endif
-      }
-      else
-      {
-        data = bitmap[idx];
-      }
-      if (invert) data = ~data;
-      _transfer(data);
-    }
+    // use wb_bitmap, h_bitmap of bitmap for index!
+    uint32_t idx = mirror_y ? x_part / 8 + dx / 8 + uint32_t((h_bitmap - 1 - (y_part + i + dy))) * wb_bitmap : x_part / 8 + dx / 8 + uint32_t(y_part + i + dy) * wb_bitmap;
+    _transferBytes(&bitmap[idx], w1 / 8, invert, pgm);
   }
   _endTransfer();
   delay(1); // yield() to avoid WDT on ESP8266 and ESP32
@@ -268,8 +231,10 @@ void GxEPD2_420c_GDEY042Z98::hibernate()
   _PowerOff();
   if (_rst >= 0)
   {
-    _writeCommand(0x10); // deep sleep
-    _writeData(0x11);    // deep sleep
+    _startTransfer();
+    _transferCommand(0x10); // deep sleep
+    _transfer(0x11);     // deep sleep
+    _endTransfer();
     _hibernating = true;
     _init_display_done = false;
   }
@@ -277,30 +242,34 @@ void GxEPD2_420c_GDEY042Z98::hibernate()
 
 void GxEPD2_420c_GDEY042Z98::_setPartialRamArea(uint16_t x, uint16_t y, uint16_t w, uint16_t h)
 {
-  _writeCommand(0x11); // set ram entry mode
-  _writeData(0x03);    // x increase, y increase : normal mode
-  _writeCommand(0x44);
-  _writeData(x / 8);
-  _writeData((x + w - 1) / 8);
-  _writeCommand(0x45);
-  _writeData(y % 256);
-  _writeData(y / 256);
-  _writeData((y + h - 1) % 256);
-  _writeData((y + h - 1) / 256);
-  _writeCommand(0x4e);
-  _writeData(x / 8);
-  _writeCommand(0x4f);
-  _writeData(y % 256);
-  _writeData(y / 256);
+  _startTransfer();
+  _transferCommand(0x11); // set ram entry mode
+  _transfer(0x03);     // x increase, y increase : normal mode
+  _transferCommand(0x44);
+  _transfer(x / 8);
+  _transfer((x + w - 1) / 8);
+  _transferCommand(0x45);
+  _transfer(y % 256);
+  _transfer(y / 256);
+  _transfer((y + h - 1) % 256);
+  _transfer((y + h - 1) / 256);
+  _transferCommand(0x4e);
+  _transfer(x / 8);
+  _transferCommand(0x4f);
+  _transfer(y % 256);
+  _transfer(y / 256);
+  _endTransfer();
 }
 
 void GxEPD2_420c_GDEY042Z98::_PowerOn()
 {
   if (!_power_is_on)
   {
-    _writeCommand(0x22);
-    _writeData(0xc0);
-    _writeCommand(0x20);
+    _startTransfer();
+    _transferCommand(0x22);
+    _transfer(0xc0);
+    _transferCommand(0x20);
+    _endTransfer();
     _waitWhileBusy("_PowerOn", power_on_time);
   }
   _power_is_on = true;
@@ -310,9 +279,11 @@ void GxEPD2_420c_GDEY042Z98::_PowerOff()
 {
   if (_power_is_on)
   {
-    _writeCommand(0x22);
-    _writeData(0xc3);
-    _writeCommand(0x20);
+    _startTransfer();
+    _transferCommand(0x22);
+    _transfer(0xc3);
+    _transferCommand(0x20);
+    _endTransfer();
     _waitWhileBusy("_PowerOff", power_off_time);
   }
   _power_is_on = false;
@@ -324,14 +295,16 @@ void GxEPD2_420c_GDEY042Z98::_InitDisplay()
   _writeCommand(0x12); // SWRESET
   delay(10);           // 4ms meaured
   //_waitWhileBusy("_InitDisplay", power_off_time);
-  _writeCommand(0x01); //Driver output control
-  _writeData((HEIGHT - 1) % 256);
-  _writeData((HEIGHT - 1) / 256);
-  _writeData(0x00);
-  _writeCommand(0x3C); //BorderWavefrom
-  _writeData(0x05);
-  _writeCommand(0x18); //Read built-in temperature sensor
-  _writeData(0x80);
+  _startTransfer();
+  _transferCommand(0x01); //Driver output control
+  _transfer((HEIGHT - 1) % 256);
+  _transfer((HEIGHT - 1) / 256);
+  _transfer(0x00);
+  _transferCommand(0x3C); //BorderWavefrom
+  _transfer(0x05);
+  _transferCommand(0x18); //Read built-in temperature sensor
+  _transfer(0x80);
+  _endTransfer();
   _setPartialRamArea(0, 0, WIDTH, HEIGHT);
   _init_display_done = true;
 }
@@ -340,23 +313,29 @@ void GxEPD2_420c_GDEY042Z98::_Update_Full()
 {
   if (_use_fast_update)
   {
-    _writeCommand(0x1A); // Write to temperature register
-    _writeData(0x5a);    // 90
-    _writeData(0x00);
-    _writeCommand(0x22); // Display Update Sequence Options
-    _writeData(0x91);    // Load LUT for temperature value
-    _writeCommand(0x20); // Master Activation
+    _startTransfer();
+    _transferCommand(0x1A); // Write to temperature register
+    _transfer(0x5a);     // 90
+    _transfer(0x00);
+    _transferCommand(0x22); // Display Update Sequence Options
+    _transfer(0x91);     // Load LUT for temperature value
+    _transferCommand(0x20); // Master Activation
+    _endTransfer();
     delay(2);            // less than 1 ms measured
-    _writeCommand(0x22); // Display Update Sequence Options
-    _writeData(0xC7);    //
-    _writeCommand(0x20); // Master Activation
+    _startTransfer();
+    _transferCommand(0x22); // Display Update Sequence Options
+    _transfer(0xC7);     //
+    _transferCommand(0x20); // Master Activation
+    _endTransfer();
     _waitWhileBusy("_Update_Fast", full_refresh_time);
   }
   else
   {
-    _writeCommand(0x22); // Display Update Sequence Options
-    _writeData(0xF7);    //
-    _writeCommand(0x20); // Master Activation
+    _startTransfer();
+    _transferCommand(0x22); // Display Update Sequence Options
+    _transfer(0xF7);     //
+    _transferCommand(0x20); // Master Activation
+    _endTransfer();
     _waitWhileBusy("_Update_Full", full_refresh_time);
   }
   _power_is_on = false;
@@ -373,8 +352,10 @@ void GxEPD2_420c_GDEY042Z98::refresh_bw(int16_t x, int16_t y, int16_t w, int16_t
   w1 -= x1 - x;
   h1 -= y1 - y;
   _setPartialRamArea(x1, y1, w1, h1);
-  _writeCommand(0x22); // Display Update Sequence Options
-  _writeData(0xdc);    //
-  _writeCommand(0x20); // Master Activation
+  _startTransfer();
+  _transferCommand(0x22); // Display Update Sequence Options
+  _transfer(0xdc);     //
+  _transferCommand(0x20); // Master Activation
+  _endTransfer();
   _waitWhileBusy("refresh_bw", full_refresh_time);
 }
@@ -54,12 +54,24 @@
 #define I80CPCR (SYS_REG_BASE + 0x04)
 #define MCSR_BASE_ADDR 0x0200
 #define LISAR (MCSR_BASE_ADDR + 0x0008)
+#define LUTAFSR (SYS_REG_BASE + 0x1224)
+
+// 2 bpp pixel values of 4 pixels of 1 bpp data, first pixel in bit 3, bit set is black;
+// first pixel in the low bits, as the IT8951 takes packed pixels of big endian loads
+static const uint8_t pixels2bpp[16] =
+{
+  0xFF, 0x3F, 0xCF, 0x0F, 0xF3, 0x33, 0xC3, 0x03, 0xFC, 0x3C, 0xCC, 0x0C, 0xF0, 0x30, 0xC0, 0x00
+};
 
 GxEPD2_it60::GxEPD2_it60(int16_t cs, int16_t dc, int16_t rst, int16_t busy) :
   GxEPD2_EPD(cs, dc, rst, busy, LOW, 10000000, WIDTH, HEIGHT, panel, hasColor, hasPartialUpdate, hasFastPartialUpdate),
   _spi_settings(24000000, MSBFIRST, SPI_MODE0),
-  _spi_settings_for_read(1000000, MSBFIRST, SPI_MODE0)
+  _spi_settings_for_read(1000000, MSBFIRST, SPI_MODE0),
+  _waveform(WaveformDefault), _a2_mode(6),
+  _image_buffers(1), _shown(0), _load_index(0), _frame_rows(0), _frame_load(false), _display_pending(false), _power_off_pending(false)
 {
+  _loaded_gray = Area();
+  _shown_gray = Area();
 }
 
 void GxEPD2_it60::init(uint32_t serial_diag_bitrate)
@@ -93,6 +105,15 @@ void GxEPD2_it60::init(uint32_t serial_diag_bitrate, bool initial, uint16_t rese
     Serial.print("FW Version = "); Serial.println((char*)IT8951DevInfo.usFWVersion);
     Serial.print("LUT Version = "); Serial.println((char*)IT8951DevInfo.usLUTVersion);
   }
+  _a2_mode = strncmp((const char*)IT8951DevInfo.usLUTVersion, "M641", 4) == 0 ? 4 : 6; // 6" panels
+  _loaded_gray = Area();
+  _shown_gray = Area();
+  _addArea(_shown_gray, 0, 0, WIDTH, HEIGHT); // unknown after reset
+  _shown = 0;
+  _load_index = 0;
+  _frame_rows = 0;
+  _display_pending = false;
+  _power_off_pending = false;
   //Set to Enable I80 Packed mode
   _IT8951WriteReg(I80CPCR, 0x0001);
   if (VCOM != _IT8951GetVCOM())
@@ -106,18 +127,27 @@ void GxEPD2_it60::init(uint32_t serial_diag_bitrate, bool initial, uint16_t rese
   //Serial.print("set VCOM = -"); Serial.println((float)_IT8951GetVCOM() / 1000);
 }
 
+void GxEPD2_it60::setImageBuffers(uint8_t count)
+{
+  _waitDisplayReady();
+  _image_buffers = count > 1 ? 2 : 1;
+  _shown = 0;
+  _frame_rows = 0;
+}
+
 void GxEPD2_it60::clearScreen(uint8_t value)
 {
   _initial_write = false; // initial full screen buffer clean done
   if (_initial_refresh) _Init_Full();
   else _Init_Part();
   _initial_refresh = false;
-  _setPartialRamArea(0, 0, WIDTH, HEIGHT);
+  bool packed = (value >> 4) == (value & 0x0F); // value is two 4 bpp pixels
+  _setPartialRamArea(0, 0, WIDTH, HEIGHT, packed ? IT8951_4BPP : IT8951_8BPP);
   SPI.beginTransaction(_spi_settings);
   if (_cs >= 0) digitalWrite(_cs, LOW);
   _transfer16(0x0000); // preamble for write data
   _waitWhileBusy2("clearScreen preamble", default_wait_time);
-  for (uint32_t i = 0; i < uint32_t(WIDTH) * uint32_t(HEIGHT); i++)
+  for (uint32_t i = 0; i < uint32_t(WIDTH) * uint32_t(HEIGHT) / (packed ? 2 : 1); i++)
   {
     SPI.transfer(value);
 #if defined(ESP8266) || defined(ESP32)
@@ -128,6 +158,8 @@ void GxEPD2_it60::clearScreen(uint8_t value)
   SPI.endTransaction();
   _writeCommand16(IT8951_TCON_LD_IMG_END);
   _waitWhileBusy2("clearScreen load end", default_wait_time);
+  _loaded_gray = Area();
+  if (_isGray(value >> 4)) _addArea(_loaded_gray, 0, 0, WIDTH, HEIGHT);
   _refresh(0, 0, WIDTH, HEIGHT, false);
 }
 
@@ -141,12 +173,13 @@ void GxEPD2_it60::_writeScreenBuffer(uint8_t value)
 {
   _initial_write = false; // initial full screen buffer clean done
   if (!_using_partial_mode) _Init_Part();
-  _setPartialRamArea(0, 0, WIDTH, HEIGHT);
+  bool packed = (value >> 4) == (value & 0x0F); // value is two 4 bpp pixels
+  _setPartialRamArea(0, 0, WIDTH, HEIGHT, packed ? IT8951_4BPP : IT8951_8BPP);
   SPI.beginTransaction(_spi_settings);
   if (_cs >= 0) digitalWrite(_cs, LOW);
   _transfer16(0x0000); // preamble for write data
   _waitWhileBusy2("clearScreen preamble", default_wait_time);
-  for (uint32_t i = 0; i < uint32_t(WIDTH) * uint32_t(HEIGHT); i++)
+  for (uint32_t i = 0; i < uint32_t(WIDTH) * uint32_t(HEIGHT) / (packed ? 2 : 1); i++)
   {
     SPI.transfer(value);
 #if defined(ESP8266) || defined(ESP32)
@@ -157,6 +190,8 @@ void GxEPD2_it60::_writeScreenBuffer(uint8_t value)
   SPI.endTransaction();
   _writeCommand16(IT8951_TCON_LD_IMG_END);
   _waitWhileBusy2("_writeScreenBuffer load end", default_wait_time);
+  _loaded_gray = Area();
+  if (_isGray(value >> 4)) _addArea(_loaded_gray, 0, 0, WIDTH, HEIGHT);
 }
 
 void GxEPD2_it60::writeImage(const uint8_t bitmap[], int16_t x, int16_t y, int16_t w, int16_t h, bool invert, bool mirror_y, bool pgm)
@@ -176,7 +211,7 @@ void GxEPD2_it60::writeImage(const uint8_t bitmap[], int16_t x, int16_t y, int16
   h1 -= dy;
   if ((w1 <= 0) || (h1 <= 0)) return;
   if (!_using_partial_mode) _Init_Part();
-  _setPartialRamArea(x1, y1, w1, h1);
+  _setPartialRamArea(x1, y1, w1, h1, IT8951_2BPP);
   SPI.beginTransaction(_spi_settings);
   if (_cs >= 0) digitalWrite(_cs, LOW);
   _transfer16(0x0000); // preamble for write data
@@ -211,6 +246,7 @@ void GxEPD2_it60::writeImage(const uint8_t bitmap[], int16_t x, int16_t y, int16
   SPI.endTransaction();
   _writeCommand16(IT8951_TCON_LD_IMG_END);
   _waitWhileBusy2("writeImage load end", default_wait_time);
+  _removeArea(_loaded_gray, x1, y1, w1, h1);
   delay(1); // yield() to avoid WDT on ESP8266 and ESP32
 }
 
@@ -238,7 +274,7 @@ void GxEPD2_it60::writeImagePart(const uint8_t bitmap[], int16_t x_part, int16_t
   h1 -= dy;
   if ((w1 <= 0) || (h1 <= 0)) return;
   if (!_using_partial_mode) _Init_Part();
-  _setPartialRamArea(x1, y1, w1, h1);
+  _setPartialRamArea(x1, y1, w1, h1, IT8951_2BPP);
   SPI.beginTransaction(_spi_settings);
   if (_cs >= 0) digitalWrite(_cs, LOW);
   _transfer16(0x0000); // preamble for write data
@@ -270,9 +306,28 @@ void GxEPD2_it60::writeImagePart(const uint8_t bitmap[], int16_t x_part, int16_t
   SPI.endTransaction();
   _writeCommand16(IT8951_TCON_LD_IMG_END);
   _waitWhileBusy2("writeImage load end", default_wait_time);
+  _removeArea(_loaded_gray, x1, y1, w1, h1);
   delay(1); // yield() to avoid WDT on ESP8266 and ESP32
 }
 
+void GxEPD2_it60::writeImageForFullRefresh(const uint8_t bitmap[], int16_t x, int16_t y, int16_t w, int16_t h, bool invert, bool mirror_y, bool pgm)
+{
+  _frame_load = _image_buffers > 1;
+  writeImage(bitmap, x, y, w, h, invert, mirror_y, pgm);
+  _frame_load = false;
+}
+
+void GxEPD2_it60::writeImageAgain(const uint8_t bitmap[], int16_t x, int16_t y, int16_t w, int16_t h, bool invert, bool mirror_y, bool pgm)
+{
+  if (_image_buffers == 1) writeImage(bitmap, x, y, w, h, invert, mirror_y, pgm);
+}
+
+void GxEPD2_it60::writeImagePartAgain(const uint8_t bitmap[], int16_t x_part, int16_t y_part, int16_t w_bitmap, int16_t h_bitmap,
+                                      int16_t x, int16_t y, int16_t w, int16_t h, bool invert, bool mirror_y, bool pgm)
+{
+  if (_image_buffers == 1) writeImagePart(bitmap, x_part, y_part, w_bitmap, h_bitmap, x, y, w, h, invert, mirror_y, pgm);
+}
+
 void GxEPD2_it60::writeImage(const uint8_t* black, const uint8_t* color, int16_t x, int16_t y, int16_t w, int16_t h, bool invert, bool mirror_y, bool pgm)
 {
   if (black)
@@ -306,11 +361,12 @@ void GxEPD2_it60::writeNative(const uint8_t* data1, const uint8_t* data2, int16_
     h1 -= dy;
     if ((w1 <= 0) || (h1 <= 0)) return;
     if (!_using_partial_mode) _Init_Part();
-    _setPartialRamArea(x1, y1, w1, h1);
+    _setPartialRamArea(x1, y1, w1, h1, IT8951_8BPP);
     SPI.beginTransaction(_spi_settings);
     if (_cs >= 0) digitalWrite(_cs, LOW);
     _transfer16(0x0000); // preamble for write data
     _waitWhileBusy2("writeNative preamble", default_wait_time);
+    bool gray = false;
     for (int16_t i = 0; i < h1; i++)
     {
       for (int16_t j = 0; j < w1; j++)
@@ -331,6 +387,7 @@ void GxEPD2_it60::writeNative(const uint8_t* data1, const uint8_t* data2, int16_
           data = data1[idx];
         }
         if (invert) data = ~data;
+        gray = gray || _isGray(data >> 4);
         SPI.transfer(data);
       }
 #if defined(ESP8266) || defined(ESP32)
@@ -341,10 +398,91 @@ void GxEPD2_it60::writeNative(const uint8_t* data1, const uint8_t* data2, int16_
     SPI.endTransaction();
     _writeCommand16(IT8951_TCON_LD_IMG_END);
     _waitWhileBusy2("writeNative load end", default_wait_time);
+    if (gray) _addArea(_loaded_gray, x1, y1, w1, h1);
+    else _removeArea(_loaded_gray, x1, y1, w1, h1);
     delay(1); // yield() to avoid WDT on ESP8266 and ESP32
   }
 }
 
+void GxEPD2_it60::writeGray(const uint8_t* data, int16_t x, int16_t y, int16_t w, int16_t h, bool invert, bool mirror_y, bool pgm)
+{
+  writeGrayPart(data, 0, 0, w, h, x, y, w, h, invert, mirror_y, pgm);
+}
+
+void GxEPD2_it60::writeGrayForFullRefresh(const uint8_t* data, int16_t x, int16_t y, int16_t w, int16_t h, bool invert, bool mirror_y, bool pgm)
+{
+  _frame_load = _image_buffers > 1;
+  writeGray(data, x, y, w, h, invert, mirror_y, pgm);
+  _frame_load = false;
+}
+
+void GxEPD2_it60::writeGrayPart(const uint8_t* data, int16_t x_part, int16_t y_part, int16_t w_bitmap, int16_t h_bitmap,
+                                int16_t x, int16_t y, int16_t w, int16_t h, bool invert, bool mirror_y, bool pgm)
+{
+  if (_initial_write) writeScreenBuffer(); // initial full screen buffer clean
+  delay(1); // yield() to avoid WDT on ESP8266 and ESP32
+  if ((w_bitmap < 0) || (h_bitmap < 0) || (w < 0) || (h < 0)) return;
+  if ((x_part < 0) || (x_part >= w_bitmap)) return;
+  if ((y_part < 0) || (y_part >= h_bitmap)) return;
+  int16_t wb_bitmap = (w_bitmap + 1) / 2; // width bytes, 2 pixels per byte, rows are padded
+  x_part -= x_part % 2; // byte boundary
+  w = w_bitmap - x_part < w ? w_bitmap - x_part : w; // limit
+  h = h_bitmap - y_part < h ? h_bitmap - y_part : h; // limit
+  x -= x % 2; // byte boundary
+  w = 2 * ((w + 1) / 2); // byte boundary, rows are padded
+  int16_t x1 = x < 0 ? 0 : x; // limit
+  int16_t y1 = y < 0 ? 0 : y; // limit
+  int16_t w1 = x + w < int16_t(WIDTH) ? w : int16_t(WIDTH) - x; // limit
+  int16_t h1 = y + h < int16_t(HEIGHT) ? h : int16_t(HEIGHT) - y; // limit
+  int16_t dx = x1 - x;
+  int16_t dy = y1 - y;
+  w1 -= dx;
+  h1 -= dy;
+  if ((w1 <= 0) || (h1 <= 0)) return;
+  if (!_using_partial_mode) _Init_Part();
+  _setPartialRamArea(x1, y1, w1, h1, IT8951_4BPP);
+  SPI.beginTransaction(_spi_settings);
+  if (_cs >= 0) digitalWrite(_cs, LOW);
+  _transfer16(0x0000); // preamble for write data
+  _waitWhileBusy2("writeGray preamble", default_wait_time);
+  bool gray = false;
+  for (int16_t i = 0; i < h1; i++)
+  {
+    for (int16_t j = 0; j < w1 / 2; j++)
+    {
+      uint8_t value;
+      // use wb_bitmap, h_bitmap of bitmap for index!
+      uint32_t idx = mirror_y ? x_part / 2 + (j + dx / 2) + uint32_t((h_bitmap - 1 - (y_part + i + dy))) * uint32_t(wb_bitmap) : x_part / 2 + j + dx / 2 + uint32_t(y_part + i + dy) * uint32_t(wb_bitmap);
+      if (pgm)
+      {
+#if defined(__AVR) || defined(ESP8266) || defined(ESP32)
+        value = pgm_read_byte(&data[idx]);
+#else
+        value = data[idx];
+#endif
+      }
+      else
+      {
+        value = data[idx];
+      }
+      if (invert) value = ~value;
+      gray = gray || _isGray(value >> 4) || _isGray(value & 0x0F);
+      SPI.transfer((value << 4) | (value >> 4)); // big endian load has the first pixel in the low nibble
+    }
+    if ((w1 / 2) % 2) SPI.transfer(0xFF); // rows start at word boundaries
+#if defined(ESP8266) || defined(ESP32)
+    yield();
+#endif
+  }
+  if (_cs >= 0) digitalWrite(_cs, HIGH);
+  SPI.endTransaction();
+  _writeCommand16(IT8951_TCON_LD_IMG_END);
+  _waitWhileBusy2("writeGray load end", default_wait_time);
+  if (gray) _addArea(_loaded_gray, x1, y1, w1, h1);
+  else _removeArea(_loaded_gray, x1, y1, w1, h1);
+  delay(1); // yield() to avoid WDT on ESP8266 and ESP32
+}
+
 void GxEPD2_it60::drawImage(const uint8_t bitmap[], int16_t x, int16_t y, int16_t w, int16_t h, bool invert, bool mirror_y, bool pgm)
 {
   writeImage(bitmap, x, y, w, h, invert, mirror_y, pgm);
@@ -377,6 +515,12 @@ void GxEPD2_it60::drawNative(const uint8_t* data1, const uint8_t* data2, int16_t
   _refresh(x, y, w, h, false);
 }
 
+void GxEPD2_it60::drawGray(const uint8_t* data, int16_t x, int16_t y, int16_t w, int16_t h, bool invert, bool mirror_y, bool pgm)
+{
+  writeGray(data, x, y, w, h, invert, mirror_y, pgm);
+  _refresh(x, y, w, h, false);
+}
+
 void GxEPD2_it60::refresh(bool partial_update_mode)
 {
   _refresh(0, 0, WIDTH, HEIGHT, partial_update_mode);
@@ -387,8 +531,24 @@ void GxEPD2_it60::refresh(int16_t x, int16_t y, int16_t w, int16_t h)
   _refresh(x, y, w, h, true);
 }
 
+void GxEPD2_it60::setWaveform(Waveform waveform)
+{
+  _waveform = waveform;
+}
+
+void GxEPD2_it60::refresh(int16_t x, int16_t y, int16_t w, int16_t h, Waveform waveform)
+{
+  _refresh(x, y, w, h, waveform);
+}
+
 void GxEPD2_it60::_refresh(int16_t x, int16_t y, int16_t w, int16_t h, bool partial_update_mode)
 {
+  _refresh(x, y, w, h, partial_update_mode ? _waveform : WaveformGC16);
+}
+
+void GxEPD2_it60::_refresh(int16_t x, int16_t y, int16_t w, int16_t h, Waveform waveform)
+{
+  _power_off_pending = false;
   //x -= x % 8; // byte boundary
   //w -= x % 8; // byte boundary
   int16_t x1 = x < 0 ? 0 : x; // limit
@@ -397,8 +557,31 @@ void GxEPD2_it60::_refresh(int16_t x, int16_t y, int16_t w, int16_t h, bool part
   int16_t h1 = y + h < int16_t(HEIGHT) ? h : int16_t(HEIGHT) - y; // limit
   w1 -= x1 - x;
   h1 -= y1 - y;
+  if ((waveform == WaveformAuto) || (waveform == WaveformDefault)) // fastest waveform valid for the area
+  {
+    if (_intersects(_loaded_gray, x1, y1, w1, h1)) waveform = WaveformGC16;
+    else if ((waveform == WaveformDefault) || _intersects(_shown_gray, x1, y1, w1, h1)) waveform = WaveformDU;
+    else waveform = WaveformA2;
+  }
+  // the area shows the image buffer, gray only with the gray waveforms
+  if ((x1 <= _shown_gray.x1) && (y1 <= _shown_gray.y1) && (x1 + w1 >= _shown_gray.x2) && (y1 + h1 >= _shown_gray.y2)) _shown_gray = Area();
+  if (((waveform == WaveformGC16) || (waveform == WaveformGL16)) && _intersects(_loaded_gray, x1, y1, w1, h1))
+  {
+    int16_t gx1 = x1 > _loaded_gray.x1 ? x1 : _loaded_gray.x1;
+    int16_t gy1 = y1 > _loaded_gray.y1 ? y1 : _loaded_gray.y1;
+    int16_t gx2 = x1 + w1 < _loaded_gray.x2 ? x1 + w1 : _loaded_gray.x2;
+    int16_t gy2 = y1 + h1 < _loaded_gray.y2 ? y1 + h1 : _loaded_gray.y2;
+    _addArea(_shown_gray, gx1, gy1, gx2 - gx1, gy2 - gy1);
+  }
+  _waitDisplayReady(); // of a page flip
+  bool flip = (_image_buffers > 1) && (_frame_rows >= HEIGHT) && (x1 == 0) && (y1 == 0) && (w1 == int16_t(WIDTH)) && (h1 == int16_t(HEIGHT));
+  if (flip)
+  {
+    _shown = 1 - _shown;
+    _frame_rows = 0;
+  }
   //Send I80 Display Command (User defined command of IT8951)
-  _writeCommand16(USDEF_I80_CMD_DPY_AREA); //0x0034
+  _writeCommand16(_image_buffers > 1 ? USDEF_I80_CMD_DPY_BUF_AREA : USDEF_I80_CMD_DPY_AREA); //0x0037 or 0x0034
   _waitWhileBusy2("refresh cmd", refresh_cmd_time);
   //Write arguments
   _writeData16(x1);
@@ -409,17 +592,73 @@ void GxEPD2_it60::_refresh(int16_t x, int16_t y, int16_t w, int16_t h, bool part
   _waitWhileBusy2("refresh w", refresh_par_time);
   _writeData16(h1);
   _waitWhileBusy2("refresh h", refresh_par_time);
-  _writeData16(partial_update_mode ? 1 : 2); // mode
-  _waitWhileBusy("refresh", full_refresh_time);
+  _writeData16(waveform == WaveformA2 ? _a2_mode : uint16_t(waveform)); // mode
+  if (_image_buffers > 1)
+  {
+    uint32_t address = _imageBufferAddress(_shown);
+    _waitWhileBusy2("refresh mode", refresh_par_time);
+    _writeData16(address & 0xFFFF);
+    _waitWhileBusy2("refresh address", refresh_par_time);
+    _writeData16(address >> 16);
+    _waitWhileBusy("refresh", refresh_cmd_time);
+    _display_pending = true;
+    if (!flip) _waitDisplayReady();
+  }
+  else _waitWhileBusy("refresh", full_refresh_time);
+}
+
+void GxEPD2_it60::_addArea(Area& area, int16_t x, int16_t y, int16_t w, int16_t h)
+{
+  if ((w <= 0) || (h <= 0)) return;
+  if (area.x2 <= area.x1)
+  {
+    area.x1 = x;
+    area.y1 = y;
+    area.x2 = x + w;
+    area.y2 = y + h;
+    return;
+  }
+  if (x < area.x1) area.x1 = x;
+  if (y < area.y1) area.y1 = y;
+  if (x + w > area.x2) area.x2 = x + w;
+  if (y + h > area.y2) area.y2 = y + h;
+}
+
+// black and white loaded over area, area shrinks if covered on one side, e.g. by pages in sequence
+void GxEPD2_it60::_removeArea(Area& area, int16_t x, int16_t y, int16_t w, int16_t h)
+{
+  if ((area.x2 <= area.x1) || (w <= 0) || (h <= 0)) return;
+  bool covers_x = (x <= area.x1) && (x + w >= area.x2);
+  bool covers_y = (y <= area.y1) && (y + h >= area.y2);
+  if (covers_x && covers_y) area = Area();
+  else if (covers_x && (y <= area.y1) && (y + h > area.y1)) area.y1 = y + h;
+  else if (covers_x && (y < area.y2) && (y + h >= area.y2)) area.y2 = y;
+  else if (covers_y && (x <= area.x1) && (x + w > area.x1)) area.x1 = x + w;
+  else if (covers_y && (x < area.x2) && (x + w >= area.x2)) area.x2 = x;
+}
+
+bool GxEPD2_it60::_intersects(const Area& area, int16_t x, int16_t y, int16_t w, int16_t h)
+{
+  return (area.x2 > area.x1) && (x < area.x2) && (x + w > area.x1) && (y < area.y2) && (y + h > area.y1);
 }
 
 void GxEPD2_it60::powerOff(void)
 {
+  // after a page flip, the refresh runs on while the next frame loads: power off is deferred to the end of the refresh,
+  // done by the next call that waits for it, e.g. powerOff() again or hibernate(), or cancelled by the next load or refresh
+  if (_display_pending && !_power_off_pending && (_IT8951ReadReg(LUTAFSR) != 0))
+  {
+    _power_off_pending = true;
+    return;
+  }
+  _power_off_pending = false;
+  _waitDisplayReady();
   _PowerOff();
 }
 
 void GxEPD2_it60::hibernate()
 {
+  _waitDisplayReady();
   if (_power_is_on) _PowerOff();
   if (_rst >= 0)
   {
@@ -433,20 +672,34 @@ void GxEPD2_it60::hibernate()
 
 void GxEPD2_it60::_send8pixel(uint8_t data)
 {
-  for (uint8_t j = 0; j < 8; j++)
-  {
-    SPI.transfer(data & 0x80 ? 0x00 : 0xFF);
-    data <<= 1;
-  }
+  // 8 pixels of 1 bpp, bit set is black, as 2 bpp in 2 bytes
+  SPI.transfer(pixels2bpp[data >> 4]);
+  SPI.transfer(pixels2bpp[data & 0x0F]);
 }
 
-void GxEPD2_it60::_setPartialRamArea(uint16_t x, uint16_t y, uint16_t w, uint16_t h)
+// bpp IT8951_2BPP, IT8951_4BPP or IT8951_8BPP; packed rows start at word boundaries
+void GxEPD2_it60::_setPartialRamArea(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t bpp)
 {
-  //_IT8951WriteReg(LISAR + 2 , IT8951DevInfo.usImgBufAddrH);
-  //_IT8951WriteReg(LISAR , IT8951DevInfo.usImgBufAddrL);
+  // the next frame loads to the buffer not shown, while the panel may still refresh; other loads wait for the refresh to end
+  _power_off_pending = false; // power stays on for the frame
+  uint8_t index = _shown;
+  if (_frame_load)
+  {
+    index = 1 - _shown;
+    if (y == 0) _frame_rows = 0;
+    if ((x == 0) && (w == WIDTH) && (y == _frame_rows)) _frame_rows = y + h;
+  }
+  else _waitDisplayReady();
+  if (index != _load_index)
+  {
+    uint32_t address = _imageBufferAddress(index);
+    _IT8951WriteReg(LISAR + 2, address >> 16);
+    _IT8951WriteReg(LISAR, address & 0xFFFF);
+    _load_index = index;
+  }
   uint16_t usArg[5];
   //usArg[0] = (IT8951_LDIMG_L_ENDIAN << 8 ) | (IT8951_8BPP << 4) | (IT8951_ROTATE_0);
-  usArg[0] = (IT8951_LDIMG_B_ENDIAN << 8 ) | (IT8951_8BPP << 4) | (IT8951_ROTATE_0);
+  usArg[0] = (IT8951_LDIMG_B_ENDIAN << 8 ) | (bpp << 4) | (IT8951_ROTATE_0);
   usArg[1] = x;
   usArg[2] = y;
   usArg[3] = w;
@@ -454,8 +707,37 @@ void GxEPD2_it60::_setPartialRamArea(uint16_t x, uint16_t y, uint16_t w, uint16_
   _writeCommandData16(IT8951_TCON_LD_IMG_AREA , usArg , 5);
 }
 
+uint32_t GxEPD2_it60::_imageBufferAddress(uint8_t index)
+{
+  uint32_t address = uint32_t(IT8951DevInfo.usImgBufAddrL) | (uint32_t(IT8951DevInfo.usImgBufAddrH) << 16);
+  return address + index * uint32_t(WIDTH) * uint32_t(HEIGHT); // 8 bpp
+}
+
+// waits for the end of the refresh started with 2 image buffers, the LUT engines are free with LUTAFSR 0
+void GxEPD2_it60::_waitDisplayReady()
+{
+  if (!_display_pending) return;
+  unsigned long start = micros();
+  while (_IT8951ReadReg(LUTAFSR) != 0)
+  {
+    delay(1);
+    if (micros() - start > _busy_timeout)
+    {
+      Serial.println("Busy Timeout!");
+      break;
+    }
+  }
+  _display_pending = false;
+  if (_power_off_pending)
+  {
+    _power_off_pending = false;
+    _PowerOff();
+  }
+}
+
 void GxEPD2_it60::_PowerOn()
 {
+  _power_off_pending = false;
   if (!_power_is_on)
   {
     _IT8951SystemRun();
@@ -500,6 +782,7 @@ void GxEPD2_it60::_Init_Part()
 
 void GxEPD2_it60::_waitWhileBusy2(const char* comment, uint16_t busy_time)
 {
+  _waitAsync(); // before any transfer
   if (_busy >= 0)
   {
     unsigned long start = micros();
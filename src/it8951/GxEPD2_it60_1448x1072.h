@@ -46,17 +46,33 @@ class GxEPD2_it60_1448x1072 : public GxEPD2_EPD
     void init(uint32_t serial_diag_bitrate = 0); // serial_diag_bitrate = 0 : disabled
     void init(uint32_t serial_diag_bitrate, bool initial, uint16_t reset_duration = 20, bool pulldown_rst_mode = false);
     //  Support for Bitmaps (Sprites) to Controller Buffer and to Screen
+    // image buffers in controller memory, 1 (default) or 2 for page flip: the loads for a full refresh, of display() or of paged
+    // drawing of the full screen, go to the buffer not shown, and the full refresh shows it and returns before it ends;
+    // the next frame loads while the panel refreshes, other loads and refreshes wait for the end of the refresh;
+    // powerOff() during this refresh is deferred to its end, call powerOff() again or hibernate() after the last frame
+    void setImageBuffers(uint8_t count);
     void clearScreen(uint8_t value = 0x33); // init controller memory and screen (default white)
     void writeScreenBuffer(uint8_t value = 0x33); // init controller memory (default white)
     // write to controller memory, without screen refresh; x and w should be multiple of 8
     void writeImage(const uint8_t bitmap[], int16_t x, int16_t y, int16_t w, int16_t h, bool invert = false, bool mirror_y = false, bool pgm = false);
     void writeImagePart(const uint8_t bitmap[], int16_t x_part, int16_t y_part, int16_t w_bitmap, int16_t h_bitmap,
                         int16_t x, int16_t y, int16_t w, int16_t h, bool invert = false, bool mirror_y = false, bool pgm = false);
+    // with 2 image buffers: part of the next frame, and the writes again are not needed
+    void writeImageForFullRefresh(const uint8_t bitmap[], int16_t x, int16_t y, int16_t w, int16_t h, bool invert = false, bool mirror_y = false, bool pgm = false);
+    void writeImageAgain(const uint8_t bitmap[], int16_t x, int16_t y, int16_t w, int16_t h, bool invert = false, bool mirror_y = false, bool pgm = false);
+    void writeImagePartAgain(const uint8_t bitmap[], int16_t x_part, int16_t y_part, int16_t w_bitmap, int16_t h_bitmap,
+                             int16_t x, int16_t y, int16_t w, int16_t h, bool invert = false, bool mirror_y = false, bool pgm = false);
     void writeImage(const uint8_t* black, const uint8_t* color, int16_t x, int16_t y, int16_t w, int16_t h, bool invert = false, bool mirror_y = false, bool pgm = false);
     void writeImagePart(const uint8_t* black, const uint8_t* color, int16_t x_part, int16_t y_part, int16_t w_bitmap, int16_t h_bitmap,
                         int16_t x, int16_t y, int16_t w, int16_t h, bool invert = false, bool mirror_y = false, bool pgm = false);
     // write sprite of native data to controller memory, without screen refresh; x and w should be multiple of 8
     void writeNative(const uint8_t* data1, const uint8_t* data2, int16_t x, int16_t y, int16_t w, int16_t h, bool invert = false, bool mirror_y = false, bool pgm = false);
+    // write 4 bpp grayscale to controller memory, without screen refresh; 2 pixels per byte, first in the high nibble, 0 black to 15 white
+    // x and w should be multiple of 2, rows of the sprite are padded to bytes
+    void writeGray(const uint8_t* data, int16_t x, int16_t y, int16_t w, int16_t h, bool invert = false, bool mirror_y = false, bool pgm = false);
+    void writeGrayPart(const uint8_t* data, int16_t x_part, int16_t y_part, int16_t w_bitmap, int16_t h_bitmap,
+                       int16_t x, int16_t y, int16_t w, int16_t h, bool invert = false, bool mirror_y = false, bool pgm = false);
+    void writeGrayForFullRefresh(const uint8_t* data, int16_t x, int16_t y, int16_t w, int16_t h, bool invert = false, bool mirror_y = false, bool pgm = false);
     // write to controller memory, with screen refresh; x and w should be multiple of 8
     void drawImage(const uint8_t bitmap[], int16_t x, int16_t y, int16_t w, int16_t h, bool invert = false, bool mirror_y = false, bool pgm = false);
     void drawImagePart(const uint8_t bitmap[], int16_t x_part, int16_t y_part, int16_t w_bitmap, int16_t h_bitmap,
@@ -66,8 +82,16 @@ class GxEPD2_it60_1448x1072 : public GxEPD2_EPD
                        int16_t x, int16_t y, int16_t w, int16_t h, bool invert = false, bool mirror_y = false, bool pgm = false);
     // write sprite of native data to controller memory, with screen refresh; x and w should be multiple of 8
     void drawNative(const uint8_t* data1, const uint8_t* data2, int16_t x, int16_t y, int16_t w, int16_t h, bool invert = false, bool mirror_y = false, bool pgm = false);
+    // write 4 bpp grayscale to controller memory, with screen refresh; x and w should be multiple of 2
+    void drawGray(const uint8_t* data, int16_t x, int16_t y, int16_t w, int16_t h, bool invert = false, bool mirror_y = false, bool pgm = false);
     void refresh(bool partial_update_mode = false); // screen refresh from controller memory to full screen
     void refresh(int16_t x, int16_t y, int16_t w, int16_t h); // screen refresh from controller memory, partial screen
+    // IT8951 waveforms of partial refreshes, full refresh uses GC16; A2 and DU are fast but black and white only
+    // WaveformAuto uses the fastest waveform valid for the content: GC16 where gray was loaded, DU where gray is shown, else A2
+    // WaveformDefault is as WaveformAuto, but DU instead of A2
+    enum Waveform {WaveformINIT = 0, WaveformDU = 1, WaveformGC16 = 2, WaveformGL16 = 3, WaveformA2, WaveformAuto, WaveformDefault};
+    void setWaveform(Waveform waveform); // for the following partial refreshes
+    void refresh(int16_t x, int16_t y, int16_t w, int16_t h, Waveform waveform); // screen refresh from controller memory, partial screen
     void powerOff(); // turns off generation of panel driving voltages, avoids screen fading over time
     void hibernate(); // turns powerOff() and sets controller to deep sleep for minimum power use, ONLY if wakeable by RST (rst >= 0)
   private:
@@ -83,11 +107,31 @@ class GxEPD2_it60_1448x1072 : public GxEPD2_EPD
     IT8951DevInfoStruct IT8951DevInfo;
     SPISettings _spi_settings;
     SPISettings _spi_settings_for_read;
+    struct Area
+    {
+      int16_t x1, y1, x2, y2; // x2, y2 exclusive, empty if x2 <= x1
+    };
+    Area _loaded_gray, _shown_gray; // may contain gray: image buffer, screen
+    Waveform _waveform;
+    uint16_t _a2_mode; // display mode of A2, depends on the LUT
+    uint8_t _image_buffers, _shown, _load_index; // count, index of the buffer shown and of the buffer in LISAR
+    uint16_t _frame_rows; // rows of the next frame loaded to the buffer not shown
+    bool _frame_load, _display_pending, _power_off_pending;
   private:
     void _writeScreenBuffer(uint8_t value);
     void _refresh(int16_t x, int16_t y, int16_t w, int16_t h, bool partial_update_mode);
+    void _refresh(int16_t x, int16_t y, int16_t w, int16_t h, Waveform waveform);
+    void _addArea(Area& area, int16_t x, int16_t y, int16_t w, int16_t h);
+    void _removeArea(Area& area, int16_t x, int16_t y, int16_t w, int16_t h);
+    static bool _intersects(const Area& area, int16_t x, int16_t y, int16_t w, int16_t h);
+    static bool _isGray(uint8_t level) // 4 bit level neither black nor white
+    {
+      return ((level + 1) & 0x0F) > 1;
+    };
     void _send8pixel(uint8_t data);
-    void _setPartialRamArea(uint16_t x, uint16_t y, uint16_t w, uint16_t h);
+    void _setPartialRamArea(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t bpp);
+    uint32_t _imageBufferAddress(uint8_t index);
+    void _waitDisplayReady();
     void _PowerOn();
     void _PowerOff();
     void _InitDisplay();